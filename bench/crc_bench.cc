@@ -0,0 +1,60 @@
+// Micro-benchmark for the CRC32C implementations used by the record framing.
+//
+// Usage: crc_bench [min_seconds_per_case]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "crc.h"
+
+using namespace std;
+
+// Runs `fn` over `len` bytes until at least `min_seconds` elapsed, returns
+// the throughput in GB/s.
+double measure(crc32c_fn fn, const char* buf, size_t len, double min_seconds) {
+    size_t iterations = 1;
+    volatile uint32_t sink = 0;
+    for (;;) {
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) sink = fn(sink, buf, len);
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        if (elapsed.count() >= min_seconds) {
+            return static_cast<double>(len) * iterations / elapsed.count() /
+                   1e9;
+        }
+        iterations *= 2;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    double min_seconds = argc > 1 ? atof(argv[1]) : 0.2;
+    const size_t kMinLen = 16, kMaxLen = 64 << 20;
+
+    vector<char> buf(kMaxLen);
+    mt19937 generator(42);
+    for (auto& c : buf) c = static_cast<char>(generator());
+
+    const char* impls[] = {"portable", "sse4.2", "sse4.2+pclmul"};
+    printf("dispatch: %s\n", crc32c_implementation());
+    printf("%10s", "bytes");
+    for (auto name : impls) printf(" %14s", name);
+    printf("  (GB/s)\n");
+
+    for (size_t len = kMinLen; len <= kMaxLen; len *= 4) {
+        printf("%10zu", len);
+        for (auto name : impls) {
+            crc32c_fn fn = crc32c_lookup(name);
+            if (fn == nullptr) {
+                printf(" %14s", "n/a");
+                continue;
+            }
+            printf(" %14.2f", measure(fn, buf.data(), len, min_seconds));
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+// Throughput of the event file sinks, logging scalars and larger histogram
+// events through a TensorBoardLogger.
+//
+// Usage: sink_bench [num_scalars] [output_dir]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "shm_ring.h"
+#include "tensorboard_logger.h"
+
+using namespace std;
+
+struct Case {
+    const char* name;
+    TensorBoardLoggerOptions options;
+};
+
+// Logs `num` events with `log` and closes the logger, returns the events
+// per second.
+template <typename F>
+double measure(const string& file, const TensorBoardLoggerOptions& options,
+               size_t num, F log) {
+    auto start = chrono::steady_clock::now();
+    {
+        TensorBoardLogger logger(file, options);
+        for (size_t i = 0; i < num; ++i) log(logger, i);
+        logger.close();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return num / elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+    size_t num_scalars = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    string dir = argc > 2 ? argv[2] : ".";
+    string file = dir + "/sink_bench.tfevents.pb";
+    size_t num_histograms = num_scalars / 1000 + 1;
+
+    vector<float> values(100000);
+    mt19937 generator(42);
+    normal_distribution<float> normal;
+    for (auto& v : values) v = normal(generator);
+
+    size_t bytes = 0;
+    auto discard = [&bytes](const string&, bool) {
+        return unique_ptr<Sink>(new CallbackSink(
+            [&bytes](const char*, size_t size) { bytes += size; }));
+    };
+    vector<Case> cases = {
+        {"stream", TensorBoardLoggerOptions().sink(SinkType::kStream)},
+        {"posix", TensorBoardLoggerOptions().sink(SinkType::kPosix)},
+        {"posix+prealloc", TensorBoardLoggerOptions()
+                               .sink(SinkType::kPosix)
+                               .preallocate_bytes(64 << 20)},
+        {"io_uring", TensorBoardLoggerOptions().sink(SinkType::kIoUring)},
+        {"callback", TensorBoardLoggerOptions().sink_factory(discard)},
+    };
+
+    printf("%16s %16s %16s %16s\n", "sink", "scalars/s", "async scalars/s",
+           "histograms/s");
+    for (auto& c : cases) {
+        auto scalar = [](TensorBoardLogger& logger, size_t i) {
+            logger.add_scalar("bench/scalar", static_cast<int>(i), i * 0.5);
+        };
+        auto histogram = [&values](TensorBoardLogger& logger, size_t i) {
+            logger.add_histogram("bench/histogram", static_cast<int>(i),
+                                 values);
+        };
+        auto async_options = c.options;
+        async_options.async(true);
+        printf("%16s %16.0f %16.0f %16.0f\n", c.name,
+               measure(file, c.options, num_scalars, scalar),
+               measure(file, async_options, num_scalars, scalar),
+               measure(file, c.options, num_histograms, histogram));
+    }
+
+    // a worker logging into a shared memory ring, drained into the file by
+    // a collector thread as the tb_shm_collector daemon would
+    auto ring = ShmRing::create("/tbl_sink_bench", 64 << 20);
+    double per_second;
+    {
+        TensorBoardLogger collector_logger(file);
+        ShmRingCollector collector(*ring, collector_logger);
+        per_second = measure(
+            file + ".worker",
+            TensorBoardLoggerOptions().sink_factory(shm_ring_sink(ring)),
+            num_scalars, [](TensorBoardLogger& logger, size_t i) {
+                logger.add_scalar("bench/scalar", static_cast<int>(i),
+                                  i * 0.5);
+            });
+    }
+    ring->unlink();
+    printf("%16s %16.0f  (%.0f ns per scalar in the worker)\n", "shm ring",
+           per_second, 1e9 / per_second);
+    remove(file.c_str());
+
+    return 0;
+}
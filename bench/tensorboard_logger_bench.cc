@@ -0,0 +1,634 @@
+// Benchmarks of the public logging paths: throughput, bytes written, per-call
+// latency and heap allocations per call, reported as a table and optionally
+// as JSON for tracking regressions between releases.
+//
+// Usage: tensorboard_logger_bench [--filter=SUBSTR] [--scale=X]
+//                                 [--json=FILE] [--dir=DIR]
+//
+// Every case does a fixed amount of work with fixed seeds, multiplied by
+// --scale. Event files go to DIR (default /tmp) and are removed afterwards.
+// Allocations are counted on the calling threads only, not in the logger's
+// own threads.
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "crc.h"
+#include "embedding_writer.h"
+#include "pr_curve.h"
+#include "tensorboard_logger.h"
+#include "wav_encoder.h"
+
+using namespace std;
+
+static thread_local uint64_t num_allocations = 0;
+
+// Not inlined, so that the compiler does not pair malloc() and free() with
+// new and delete.
+__attribute__((noinline)) void* operator new(size_t size) {
+    ++num_allocations;
+    void* p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr) throw bad_alloc();
+    return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+struct Result {
+    uint64_t ops = 0;
+    double seconds = 0;
+    uint64_t bytes = 0;
+    double p50_ns = 0;
+    double p99_ns = 0;
+    double allocs_per_op = 0;
+};
+
+// Runs op(thread, i) for i < ops_per_thread on `num_threads` threads started
+// together, timing every call; prepare(thread, i), if given, runs before
+// each call and is neither timed nor counted.
+Result measure(size_t num_threads, size_t ops_per_thread,
+               const function<void(size_t, size_t)>& op,
+               const function<void(size_t, size_t)>& prepare = nullptr) {
+    vector<vector<uint64_t>> latencies(num_threads);
+    vector<uint64_t> allocations(num_threads);
+    for (auto& l : latencies) l.resize(ops_per_thread);
+    atomic<bool> go{false};
+
+    auto run = [&](size_t t) {
+        while (!go.load()) this_thread::yield();
+        uint64_t allocations_before = num_allocations, untimed = 0;
+        for (size_t i = 0; i < ops_per_thread; ++i) {
+            if (prepare) {
+                uint64_t before = num_allocations;
+                prepare(t, i);
+                untimed += num_allocations - before;
+            }
+            auto start = chrono::steady_clock::now();
+            op(t, i);
+            latencies[t][i] = chrono::duration_cast<chrono::nanoseconds>(
+                                  chrono::steady_clock::now() - start)
+                                  .count();
+        }
+        allocations[t] = num_allocations - allocations_before - untimed;
+    };
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for (size_t t = 1; t < num_threads; ++t) threads.emplace_back(run, t);
+    go = true;
+    run(0);
+    for (auto& thread : threads) thread.join();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    Result result;
+    result.ops = num_threads * ops_per_thread;
+    result.seconds = elapsed.count();
+    vector<uint64_t> all;
+    all.reserve(result.ops);
+    for (auto& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    auto percentile = [&all](double p) {
+        if (all.empty()) return 0.0;
+        auto it = all.begin() + static_cast<size_t>(p * (all.size() - 1));
+        nth_element(all.begin(), it, all.end());
+        return static_cast<double>(*it);
+    };
+    result.p50_ns = percentile(0.5);
+    result.p99_ns = percentile(0.99);
+    uint64_t total_allocations = 0;
+    for (auto a : allocations) total_allocations += a;
+    result.allocs_per_op =
+        result.ops ? static_cast<double>(total_allocations) / result.ops : 0;
+    return result;
+}
+
+uint64_t file_size(const string& filename) {
+    struct stat st;
+    return stat(filename.c_str(), &st) == 0 ? st.st_size : 0;
+}
+
+class Bench {
+   public:
+    Bench(const string& filter, double scale, const string& dir)
+        : filter_(filter), scale_(scale), dir_(dir) {}
+
+    // Whether `name` is selected by --filter.
+    bool enabled(const string& name) const {
+        return name.find(filter_) != string::npos;
+    }
+
+    // At least `min`, `ops` scaled by --scale.
+    size_t scaled(double ops, size_t min = 1) const {
+        auto n = static_cast<size_t>(ops * scale_);
+        return n < min ? min : n;
+    }
+
+    string event_file() const { return dir_ + "/bench.tfevents.pb"; }
+    const string& dir() const { return dir_; }
+
+    // Logs with op(logger, thread, i), `ops` calls spread over the threads.
+    // The time includes closing the logger, the bytes are those of the
+    // event file.
+    void logger_case(
+        const string& name, const string& params, size_t num_threads,
+        size_t ops, const TensorBoardLoggerOptions& options,
+        const function<void(TensorBoardLogger&, size_t, size_t)>& op) {
+        if (!enabled(name)) return;
+        string file = event_file();
+        Result result;
+        {
+            TensorBoardLogger logger(file, options);
+            auto start = chrono::steady_clock::now();
+            result = measure(num_threads, (ops + num_threads - 1) / num_threads,
+                             [&](size_t t, size_t i) { op(logger, t, i); });
+            logger.close();
+            chrono::duration<double> elapsed =
+                chrono::steady_clock::now() - start;
+            result.seconds = elapsed.count();
+        }
+        result.bytes = file_size(file);
+        remove(file.c_str());
+        report(name, params, result);
+    }
+
+    void report(const string& name, const string& params,
+                const Result& result) {
+        double ops_per_s = result.ops / result.seconds;
+        double bytes_per_s = result.bytes / result.seconds;
+        string plain_params = params;
+        plain_params.erase(
+            remove(plain_params.begin(), plain_params.end(), '"'),
+            plain_params.end());
+        printf("%-22s %-28s %12.0f %10.1f %10.0f %10.0f %8.2f\n",
+               name.c_str(), plain_params.c_str(), ops_per_s,
+               bytes_per_s / 1e6,
+               result.p50_ns, result.p99_ns, result.allocs_per_op);
+        fflush(stdout);
+
+        ostringstream json;
+        json << "    {\"name\": \"" << name << "\", \"params\": {" << params
+             << "}, \"ops\": " << result.ops
+             << ", \"seconds\": " << result.seconds
+             << ", \"ops_per_s\": " << ops_per_s
+             << ", \"bytes\": " << result.bytes
+             << ", \"bytes_per_s\": " << bytes_per_s
+             << ", \"p50_ns\": " << result.p50_ns
+             << ", \"p99_ns\": " << result.p99_ns
+             << ", \"allocs_per_op\": " << result.allocs_per_op << "}";
+        json_results_.push_back(json.str());
+    }
+
+    void write_json(const string& filename) const {
+        ofstream out(filename);
+        out << "{\n  \"crc32c\": \"" << crc32c_implementation()
+            << "\",\n  \"pcm16\": \"" << pcm16_implementation()
+            << "\",\n  \"pr_curve\": \"" << pr_curve_implementation()
+            << "\",\n  \"float16\": \"" << float16_implementation()
+            << "\",\n  \"hardware_threads\": "
+            << thread::hardware_concurrency() << ",\n  \"scale\": " << scale_
+            << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < json_results_.size(); ++i) {
+            out << json_results_[i]
+                << (i + 1 < json_results_.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+        if (!out) {
+            fprintf(stderr, "failed to write %s\n", filename.c_str());
+            exit(1);
+        }
+    }
+
+   private:
+    string filter_;
+    double scale_;
+    string dir_;
+    vector<string> json_results_;
+};
+
+string param(const string& key, size_t value) {
+    return "\"" + key + "\": " + to_string(value);
+}
+
+string param(const string& key, const string& value) {
+    return "\"" + key + "\": \"" + value + "\"";
+}
+
+string random_bytes(size_t size, mt19937& generator) {
+    string bytes(size, '\0');
+    for (auto& c : bytes) c = static_cast<char>(generator());
+    return bytes;
+}
+
+// Values of a normal distribution of deviation 100, in type T.
+template <typename T>
+T normal_value(mt19937& generator) {
+    return static_cast<T>(normal_distribution<double>(0, 100)(generator));
+}
+
+template <>
+int8_t normal_value<int8_t>(mt19937& generator) {
+    double v = normal_distribution<double>(0, 100)(generator);
+    return static_cast<int8_t>(v < -128 ? -128 : (v > 127 ? 127 : v));
+}
+
+template <>
+BFloat16 normal_value<BFloat16>(mt19937& generator) {
+    float f = normal_value<float>(generator);
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return BFloat16{static_cast<uint16_t>(bits >> 16)};
+}
+
+// finite halves of all magnitudes, rather than a normal distribution
+template <>
+Float16 normal_value<Float16>(mt19937& generator) {
+    auto bits = static_cast<uint16_t>(generator());
+    if ((bits & 0x7c00) == 0x7c00) bits ^= 0x4000;
+    return Float16{bits};
+}
+
+template <typename T>
+void histogram_cases(Bench& bench, const char* type, mt19937& generator) {
+    for (size_t size : {100, 10000, 1000000}) {
+        vector<T> values(size);
+        for (auto& v : values) v = normal_value<T>(generator);
+        bench.logger_case(
+            "add_histogram",
+            param("type", type) + ", " + param("size", size), 1,
+            bench.scaled(2e7 / size, 4), TensorBoardLoggerOptions(),
+            [&values](TensorBoardLogger& logger, size_t, size_t i) {
+                logger.add_histogram("bench/histogram", static_cast<int>(i),
+                                     values);
+            });
+    }
+}
+
+void scalar_cases(Bench& bench) {
+    for (size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+        bench.logger_case("add_scalar", param("threads", threads), threads,
+                          bench.scaled(2e5), TensorBoardLoggerOptions(),
+                          [](TensorBoardLogger& logger, size_t, size_t i) {
+                              logger.add_scalar("bench/scalar",
+                                                static_cast<int>(i), i * 0.5);
+                          });
+    }
+    for (size_t threads : {1, 8}) {
+        bench.logger_case("add_scalar_async", param("threads", threads),
+                          threads, bench.scaled(2e5),
+                          TensorBoardLoggerOptions().async(true),
+                          [](TensorBoardLogger& logger, size_t, size_t i) {
+                              logger.add_scalar("bench/scalar",
+                                                static_cast<int>(i), i * 0.5);
+                          });
+    }
+    unique_ptr<ScalarHandle> handle;
+    bench.logger_case(
+        "scalar_handle", param("threads", 1), 1, bench.scaled(2e5),
+        TensorBoardLoggerOptions(),
+        [&handle](TensorBoardLogger& logger, size_t, size_t i) {
+            if (!handle) {
+                handle.reset(
+                    new ScalarHandle(logger.scalar_handle("bench/scalar")));
+            }
+            handle->log(static_cast<int>(i), i * 0.5);
+        });
+    bench.logger_case("step_batch", param("scalars", 10), 1,
+                      bench.scaled(5e4), TensorBoardLoggerOptions(),
+                      [](TensorBoardLogger& logger, size_t, size_t i) {
+                          auto batch = logger.begin_step(static_cast<int>(i));
+                          for (int j = 0; j < 10; ++j) {
+                              batch.scalar("bench/scalar", j);
+                          }
+                          batch.commit();
+                      });
+}
+
+void histogram_cases(Bench& bench, mt19937& generator) {
+    histogram_cases<float>(bench, "float", generator);
+    histogram_cases<double>(bench, "double", generator);
+    histogram_cases<int>(bench, "int32", generator);
+    histogram_cases<int8_t>(bench, "int8", generator);
+    histogram_cases<Float16>(bench, "float16", generator);
+    histogram_cases<BFloat16>(bench, "bfloat16", generator);
+
+    // one column of a row-major matrix, read in place
+    const size_t kRows = 1 << 20, kColumns = 4;
+    vector<float> matrix(kRows * kColumns);
+    for (auto& v : matrix) v = normal_value<float>(generator);
+    vector<uint8_t> mask(kRows);
+    for (auto& m : mask) m = generator() % 2;
+    for (bool masked : {false, true}) {
+        HistogramView<float> column(matrix.data(), kRows, kColumns,
+                                    masked ? mask.data() : nullptr);
+        bench.logger_case(
+            "add_histogram_view",
+            param("stride", kColumns) + ", " + param("rows", kRows) + ", " +
+                param("masked", masked ? "true" : "false"),
+            1, bench.scaled(20, 2), TensorBoardLoggerOptions(),
+            [column](TensorBoardLogger& logger, size_t, size_t i) {
+                logger.add_histogram("bench/column", static_cast<int>(i),
+                                     column);
+            });
+    }
+
+    const size_t kTensors = 16, kSize = 1 << 20;
+    vector<float> values(kTensors * kSize);
+    normal_distribution<float> normal;
+    for (auto& v : values) v = normal(generator);
+    vector<HistogramInput> inputs;
+    for (size_t i = 0; i < kTensors; ++i) {
+        inputs.emplace_back("bench/tensor" + to_string(i),
+                            values.data() + i * kSize, kSize);
+    }
+    bench.logger_case(
+        "add_histograms", param("tensors", kTensors) + ", " +
+        param("size", kSize), 1, bench.scaled(8, 2),
+        TensorBoardLoggerOptions(),
+        [&inputs](TensorBoardLogger& logger, size_t, size_t i) {
+            logger.add_histograms(static_cast<int>(i), inputs);
+        });
+
+    // a sketch fed with a tensor, then logged
+    for (double accuracy : {0.01, 0.001}) {
+        bench.logger_case(
+            "add_histogram_sketch",
+            param("size", kSize) + ", " +
+                param("accuracy", to_string(accuracy).substr(0, 5)),
+            1, bench.scaled(32, 2), TensorBoardLoggerOptions(),
+            [&values, accuracy](TensorBoardLogger& logger, size_t, size_t i) {
+                QuantileSketch sketch(accuracy);
+                sketch.add(values.data() + (i % kTensors) * kSize, kSize);
+                logger.add_histogram("bench/sketch", static_cast<int>(i),
+                                     sketch);
+            });
+    }
+}
+
+void payload_cases(Bench& bench, mt19937& generator) {
+    for (size_t size : {4 << 10, 64 << 10, 1 << 20, 16 << 20}) {
+        string image = random_bytes(size, generator);
+        bench.logger_case(
+            "add_image", param("bytes", size), 1,
+            bench.scaled((64 << 20) / size, 4), TensorBoardLoggerOptions(),
+            [&image](TensorBoardLogger& logger, size_t, size_t i) {
+                logger.add_image("bench/image", static_cast<int>(i), image,
+                                 256, 256, 3);
+            });
+        bench.logger_case(
+            "add_audio", param("bytes", size), 1,
+            bench.scaled((64 << 20) / size, 4), TensorBoardLoggerOptions(),
+            [&image](TensorBoardLogger& logger, size_t, size_t i) {
+                logger.add_audio("bench/audio", static_cast<int>(i), image,
+                                 16000, 1, 16000, "audio/wav");
+            });
+    }
+
+    const size_t kImages = 64;
+    vector<string> images;
+    for (size_t i = 0; i < kImages; ++i) {
+        images.push_back(random_bytes(16 << 10, generator));
+    }
+    bench.logger_case(
+        "add_images", param("images", kImages) + ", " +
+        param("bytes", 16 << 10), 1, bench.scaled(200, 4),
+        TensorBoardLoggerOptions(),
+        [&images](TensorBoardLogger& logger, size_t, size_t i) {
+            logger.add_images("bench/images", static_cast<int>(i), images, 64,
+                              64);
+        });
+
+    // gradients, which compress like typical images
+    const int kSide = 64;
+    vector<uint8_t> pixels(kImages * kSide * kSide * 3);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i / 3 % 256 + generator() % 4);
+    }
+    bench.logger_case(
+        "add_image_raw", param("side", kSide), 1, bench.scaled(500, 4),
+        TensorBoardLoggerOptions(),
+        [&pixels](TensorBoardLogger& logger, size_t, size_t i) {
+            logger.add_image_raw("bench/raw", static_cast<int>(i),
+                                 pixels.data(), kSide, kSide, 3)
+                .get();
+        });
+    bench.logger_case(
+        "add_images_raw", param("images", kImages) + ", " +
+        param("side", kSide), 1, bench.scaled(20, 2),
+        TensorBoardLoggerOptions(),
+        [&pixels](TensorBoardLogger& logger, size_t, size_t i) {
+            logger.add_images_raw("bench/raw", static_cast<int>(i),
+                                  pixels.data(), kImages, kSide, kSide, 3)
+                .get();
+        });
+
+    for (size_t seconds : {1, 60}) {
+        const size_t kRate = 16000;
+        vector<float> samples(seconds * kRate);
+        normal_distribution<float> normal(0, 0.3f);
+        for (auto& s : samples) s = normal(generator);
+        bench.logger_case(
+            "add_audio_pcm", param("seconds", seconds), 1,
+            bench.scaled(600 / seconds, 4), TensorBoardLoggerOptions(),
+            [&samples](TensorBoardLogger& logger, size_t, size_t i) {
+                logger.add_audio_pcm("bench/pcm", static_cast<int>(i),
+                                     samples.data(), samples.size(), 1,
+                                     kRate);
+            });
+    }
+
+    string text = random_bytes(1 << 10, generator);
+    for (auto& c : text) c = 'a' + static_cast<unsigned char>(c) % 26;
+    bench.logger_case("add_text", param("bytes", text.size()), 1,
+                      bench.scaled(1e5), TensorBoardLoggerOptions(),
+                      [&text](TensorBoardLogger& logger, size_t, size_t i) {
+                          logger.add_text("bench/text", static_cast<int>(i),
+                                          text.c_str());
+                      });
+
+    for (size_t size : {size_t(1) << 20, size_t(50000000)}) {
+        // 250 MB of inputs for the largest size, only made when needed
+        if (!bench.enabled("add_pr_curve")) break;
+        uniform_real_distribution<float> uniform;
+        vector<float> predictions(size);
+        vector<uint8_t> labels(size);
+        for (size_t i = 0; i < size; ++i) {
+            predictions[i] = uniform(generator);
+            labels[i] = predictions[i] + uniform(generator) > 1.0f;
+        }
+        bench.logger_case(
+            "add_pr_curve", param("predictions", size), 1,
+            bench.scaled(2e8 / size, 2), TensorBoardLoggerOptions(),
+            [&](TensorBoardLogger& logger, size_t, size_t i) {
+                logger.add_pr_curve("bench/pr", static_cast<int>(i),
+                                    predictions.data(), labels.data(), size);
+            });
+    }
+}
+
+void embedding_cases(Bench& bench, mt19937& generator) {
+    const size_t kRows = 10000, kDim = 128;
+    vector<float> tensor(kRows * kDim);
+    normal_distribution<float> normal;
+    for (auto& v : tensor) v = normal(generator);
+    vector<string> labels;
+    for (size_t i = 0; i < kRows; ++i) labels.push_back(to_string(i));
+
+    bench.logger_case(
+        "add_embedding", param("rows", kRows) + ", " + param("dim", kDim), 1,
+        bench.scaled(20, 2), TensorBoardLoggerOptions(),
+        [&](TensorBoardLogger& logger, size_t, size_t) {
+            logger.add_embedding("bench", tensor.data(),
+                                 {static_cast<uint32_t>(kRows),
+                                  static_cast<uint32_t>(kDim)},
+                                 "bench_embedding.bin", labels,
+                                 "bench_embedding.tsv");
+        });
+    bench.logger_case(
+        "embedding_writer", param("rows", kRows) + ", " + param("dim", kDim),
+        1, bench.scaled(20, 2), TensorBoardLoggerOptions(),
+        [&](TensorBoardLogger& logger, size_t, size_t) {
+            EmbeddingWriter writer(logger, "bench", kDim,
+                                   "bench_embedding.bin",
+                                   "bench_embedding.tsv");
+            for (size_t row = 0; row < kRows; row += 1000) {
+                writer.append_rows(tensor.data() + row * kDim, 1000,
+                                   labels.data() + row);
+            }
+            writer.close();
+        });
+    for (const char* name : {"bench_embedding.bin", "bench_embedding.tsv",
+                             "projector_config.pbtxt"}) {
+        remove((bench.dir() + "/" + name).c_str());
+    }
+}
+
+void crc_cases(Bench& bench, mt19937& generator) {
+    if (!bench.enabled("masked_crc32c")) return;
+    for (size_t size : {64, 4 << 10, 1 << 20, 64 << 20}) {
+        string buffer = random_bytes(size, generator);
+        volatile uint32_t crc = 0;
+        Result result = measure(
+            1, bench.scaled((1 << 30) / size, 4), [&](size_t, size_t) {
+                crc = masked_crc32c(buffer.data(), buffer.size());
+            });
+        result.bytes = result.ops * size;
+        bench.report("masked_crc32c", param("bytes", size), result);
+    }
+}
+
+// Latency of flush(), sync_until() and close() after a burst of scalars.
+void durability_cases(Bench& bench) {
+    const size_t kScalars = 1000;
+    auto burst = [](TensorBoardLogger& logger, size_t i) {
+        for (size_t j = 0; j < kScalars; ++j) {
+            logger.add_scalar("bench/scalar", static_cast<int>(i), j * 0.5);
+        }
+    };
+    for (bool async : {false, true}) {
+        string params = param("scalars", kScalars) + ", " +
+                        param("async", async ? "true" : "false");
+        if (bench.enabled("flush")) {
+            TensorBoardLogger logger(bench.event_file(),
+                                     TensorBoardLoggerOptions().async(async));
+            Result result = measure(
+                1, bench.scaled(200, 4),
+                [&](size_t, size_t) { logger.flush(); },
+                [&](size_t, size_t i) { burst(logger, i); });
+            logger.close();
+            result.bytes = file_size(bench.event_file());
+            bench.report("flush", params, result);
+        }
+        if (bench.enabled("sync_until")) {
+            TensorBoardLogger logger(bench.event_file(),
+                                     TensorBoardLoggerOptions().async(async));
+            Result result = measure(
+                1, bench.scaled(50, 4),
+                [&](size_t, size_t i) {
+                    logger.sync_until(static_cast<int64_t>(i));
+                },
+                [&](size_t, size_t i) { burst(logger, i); });
+            logger.close();
+            result.bytes = file_size(bench.event_file());
+            bench.report("sync_until", params, result);
+        }
+        if (bench.enabled("close")) {
+            unique_ptr<TensorBoardLogger> logger;
+            uint64_t bytes = 0;
+            Result result = measure(
+                1, bench.scaled(50, 4),
+                [&](size_t, size_t) {
+                    logger->close();
+                    bytes += file_size(bench.event_file());
+                },
+                [&](size_t, size_t i) {
+                    logger.reset(new TensorBoardLogger(
+                        bench.event_file(),
+                        TensorBoardLoggerOptions().async(async)));
+                    burst(*logger, i);
+                });
+            logger.reset();
+            result.bytes = bytes;
+            bench.report("close", params, result);
+        }
+        remove(bench.event_file().c_str());
+    }
+}
+
+int main(int argc, char* argv[]) {
+    string filter, json, dir = "/tmp";
+    double scale = 1.0;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        auto value = [&arg](const char* flag) -> const char* {
+            size_t n = strlen(flag);
+            return arg.compare(0, n, flag) == 0 ? arg.c_str() + n : nullptr;
+        };
+        if (value("--filter=")) {
+            filter = value("--filter=");
+        } else if (value("--scale=")) {
+            scale = atof(value("--scale="));
+        } else if (value("--json=")) {
+            json = value("--json=");
+        } else if (value("--dir=")) {
+            dir = value("--dir=");
+        } else {
+            fprintf(stderr,
+                    "usage: %s [--filter=SUBSTR] [--scale=X] [--json=FILE] "
+                    "[--dir=DIR]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    Bench bench(filter, scale, dir);
+    mt19937 generator(42);
+    printf("%-22s %-28s %12s %10s %10s %10s %8s\n", "case", "params",
+           "ops/s", "MB/s", "p50 ns", "p99 ns", "allocs");
+    scalar_cases(bench);
+    histogram_cases(bench, generator);
+    payload_cases(bench, generator);
+    embedding_cases(bench, generator);
+    crc_cases(bench, generator);
+    durability_cases(bench);
+
+    if (!json.empty()) bench.write_json(json);
+    return 0;
+}
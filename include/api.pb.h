@@ -0,0 +1,5912 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: api.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_api_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_api_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/struct.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_api_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_api_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_api_2eproto;
+namespace tensorboard {
+namespace hparams {
+class ColParams;
+struct ColParamsDefaultTypeInternal;
+extern ColParamsDefaultTypeInternal _ColParams_default_instance_;
+class Experiment;
+struct ExperimentDefaultTypeInternal;
+extern ExperimentDefaultTypeInternal _Experiment_default_instance_;
+class GetExperimentRequest;
+struct GetExperimentRequestDefaultTypeInternal;
+extern GetExperimentRequestDefaultTypeInternal _GetExperimentRequest_default_instance_;
+class HParamInfo;
+struct HParamInfoDefaultTypeInternal;
+extern HParamInfoDefaultTypeInternal _HParamInfo_default_instance_;
+class Interval;
+struct IntervalDefaultTypeInternal;
+extern IntervalDefaultTypeInternal _Interval_default_instance_;
+class ListMetricEvalsRequest;
+struct ListMetricEvalsRequestDefaultTypeInternal;
+extern ListMetricEvalsRequestDefaultTypeInternal _ListMetricEvalsRequest_default_instance_;
+class ListSessionGroupsRequest;
+struct ListSessionGroupsRequestDefaultTypeInternal;
+extern ListSessionGroupsRequestDefaultTypeInternal _ListSessionGroupsRequest_default_instance_;
+class ListSessionGroupsResponse;
+struct ListSessionGroupsResponseDefaultTypeInternal;
+extern ListSessionGroupsResponseDefaultTypeInternal _ListSessionGroupsResponse_default_instance_;
+class MetricInfo;
+struct MetricInfoDefaultTypeInternal;
+extern MetricInfoDefaultTypeInternal _MetricInfo_default_instance_;
+class MetricName;
+struct MetricNameDefaultTypeInternal;
+extern MetricNameDefaultTypeInternal _MetricName_default_instance_;
+class MetricValue;
+struct MetricValueDefaultTypeInternal;
+extern MetricValueDefaultTypeInternal _MetricValue_default_instance_;
+class Session;
+struct SessionDefaultTypeInternal;
+extern SessionDefaultTypeInternal _Session_default_instance_;
+class SessionGroup;
+struct SessionGroupDefaultTypeInternal;
+extern SessionGroupDefaultTypeInternal _SessionGroup_default_instance_;
+class SessionGroup_HparamsEntry_DoNotUse;
+struct SessionGroup_HparamsEntry_DoNotUseDefaultTypeInternal;
+extern SessionGroup_HparamsEntry_DoNotUseDefaultTypeInternal _SessionGroup_HparamsEntry_DoNotUse_default_instance_;
+}  // namespace hparams
+}  // namespace tensorboard
+PROTOBUF_NAMESPACE_OPEN
+template<> ::tensorboard::hparams::ColParams* Arena::CreateMaybeMessage<::tensorboard::hparams::ColParams>(Arena*);
+template<> ::tensorboard::hparams::Experiment* Arena::CreateMaybeMessage<::tensorboard::hparams::Experiment>(Arena*);
+template<> ::tensorboard::hparams::GetExperimentRequest* Arena::CreateMaybeMessage<::tensorboard::hparams::GetExperimentRequest>(Arena*);
+template<> ::tensorboard::hparams::HParamInfo* Arena::CreateMaybeMessage<::tensorboard::hparams::HParamInfo>(Arena*);
+template<> ::tensorboard::hparams::Interval* Arena::CreateMaybeMessage<::tensorboard::hparams::Interval>(Arena*);
+template<> ::tensorboard::hparams::ListMetricEvalsRequest* Arena::CreateMaybeMessage<::tensorboard::hparams::ListMetricEvalsRequest>(Arena*);
+template<> ::tensorboard::hparams::ListSessionGroupsRequest* Arena::CreateMaybeMessage<::tensorboard::hparams::ListSessionGroupsRequest>(Arena*);
+template<> ::tensorboard::hparams::ListSessionGroupsResponse* Arena::CreateMaybeMessage<::tensorboard::hparams::ListSessionGroupsResponse>(Arena*);
+template<> ::tensorboard::hparams::MetricInfo* Arena::CreateMaybeMessage<::tensorboard::hparams::MetricInfo>(Arena*);
+template<> ::tensorboard::hparams::MetricName* Arena::CreateMaybeMessage<::tensorboard::hparams::MetricName>(Arena*);
+template<> ::tensorboard::hparams::MetricValue* Arena::CreateMaybeMessage<::tensorboard::hparams::MetricValue>(Arena*);
+template<> ::tensorboard::hparams::Session* Arena::CreateMaybeMessage<::tensorboard::hparams::Session>(Arena*);
+template<> ::tensorboard::hparams::SessionGroup* Arena::CreateMaybeMessage<::tensorboard::hparams::SessionGroup>(Arena*);
+template<> ::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse* Arena::CreateMaybeMessage<::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace tensorboard {
+namespace hparams {
+
+enum DataType : int {
+  DATA_TYPE_UNSET = 0,
+  DATA_TYPE_STRING = 1,
+  DATA_TYPE_BOOL = 2,
+  DATA_TYPE_FLOAT64 = 3,
+  DataType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  DataType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool DataType_IsValid(int value);
+constexpr DataType DataType_MIN = DATA_TYPE_UNSET;
+constexpr DataType DataType_MAX = DATA_TYPE_FLOAT64;
+constexpr int DataType_ARRAYSIZE = DataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataType_descriptor();
+template<typename T>
+inline const std::string& DataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DataType_descriptor(), enum_t_value);
+}
+inline bool DataType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DataType>(
+    DataType_descriptor(), name, value);
+}
+enum DatasetType : int {
+  DATASET_UNKNOWN = 0,
+  DATASET_TRAINING = 1,
+  DATASET_VALIDATION = 2,
+  DatasetType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  DatasetType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool DatasetType_IsValid(int value);
+constexpr DatasetType DatasetType_MIN = DATASET_UNKNOWN;
+constexpr DatasetType DatasetType_MAX = DATASET_VALIDATION;
+constexpr int DatasetType_ARRAYSIZE = DatasetType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetType_descriptor();
+template<typename T>
+inline const std::string& DatasetType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DatasetType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DatasetType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DatasetType_descriptor(), enum_t_value);
+}
+inline bool DatasetType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DatasetType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DatasetType>(
+    DatasetType_descriptor(), name, value);
+}
+enum Status : int {
+  STATUS_UNKNOWN = 0,
+  STATUS_SUCCESS = 1,
+  STATUS_FAILURE = 2,
+  STATUS_RUNNING = 3,
+  Status_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Status_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Status_IsValid(int value);
+constexpr Status Status_MIN = STATUS_UNKNOWN;
+constexpr Status Status_MAX = STATUS_RUNNING;
+constexpr int Status_ARRAYSIZE = Status_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Status_descriptor();
+template<typename T>
+inline const std::string& Status_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Status>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Status_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Status_descriptor(), enum_t_value);
+}
+inline bool Status_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Status* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Status>(
+    Status_descriptor(), name, value);
+}
+enum SortOrder : int {
+  ORDER_UNSPECIFIED = 0,
+  ORDER_ASC = 1,
+  ORDER_DESC = 2,
+  SortOrder_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SortOrder_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool SortOrder_IsValid(int value);
+constexpr SortOrder SortOrder_MIN = ORDER_UNSPECIFIED;
+constexpr SortOrder SortOrder_MAX = ORDER_DESC;
+constexpr int SortOrder_ARRAYSIZE = SortOrder_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SortOrder_descriptor();
+template<typename T>
+inline const std::string& SortOrder_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SortOrder>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SortOrder_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SortOrder_descriptor(), enum_t_value);
+}
+inline bool SortOrder_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SortOrder* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SortOrder>(
+    SortOrder_descriptor(), name, value);
+}
+enum AggregationType : int {
+  AGGREGATION_UNSET = 0,
+  AGGREGATION_AVG = 1,
+  AGGREGATION_MEDIAN = 2,
+  AGGREGATION_MIN = 3,
+  AGGREGATION_MAX = 4,
+  AggregationType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  AggregationType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool AggregationType_IsValid(int value);
+constexpr AggregationType AggregationType_MIN = AGGREGATION_UNSET;
+constexpr AggregationType AggregationType_MAX = AGGREGATION_MAX;
+constexpr int AggregationType_ARRAYSIZE = AggregationType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* AggregationType_descriptor();
+template<typename T>
+inline const std::string& AggregationType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, AggregationType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function AggregationType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    AggregationType_descriptor(), enum_t_value);
+}
+inline bool AggregationType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, AggregationType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<AggregationType>(
+    AggregationType_descriptor(), name, value);
+}
+// ===================================================================
+
+class Experiment final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.Experiment) */ {
+ public:
+  inline Experiment() : Experiment(nullptr) {}
+  ~Experiment() override;
+  explicit PROTOBUF_CONSTEXPR Experiment(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Experiment(const Experiment& from);
+  Experiment(Experiment&& from) noexcept
+    : Experiment() {
+    *this = ::std::move(from);
+  }
+
+  inline Experiment& operator=(const Experiment& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Experiment& operator=(Experiment&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Experiment& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Experiment* internal_default_instance() {
+    return reinterpret_cast<const Experiment*>(
+               &_Experiment_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Experiment& a, Experiment& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Experiment* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Experiment* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Experiment* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Experiment>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Experiment& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Experiment& from) {
+    Experiment::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Experiment* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.Experiment";
+  }
+  protected:
+  explicit Experiment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHparamInfosFieldNumber = 4,
+    kMetricInfosFieldNumber = 5,
+    kDescriptionFieldNumber = 1,
+    kUserFieldNumber = 2,
+    kNameFieldNumber = 6,
+    kTimeCreatedSecsFieldNumber = 3,
+  };
+  // repeated .tensorboard.hparams.HParamInfo hparam_infos = 4;
+  int hparam_infos_size() const;
+  private:
+  int _internal_hparam_infos_size() const;
+  public:
+  void clear_hparam_infos();
+  ::tensorboard::hparams::HParamInfo* mutable_hparam_infos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::HParamInfo >*
+      mutable_hparam_infos();
+  private:
+  const ::tensorboard::hparams::HParamInfo& _internal_hparam_infos(int index) const;
+  ::tensorboard::hparams::HParamInfo* _internal_add_hparam_infos();
+  public:
+  const ::tensorboard::hparams::HParamInfo& hparam_infos(int index) const;
+  ::tensorboard::hparams::HParamInfo* add_hparam_infos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::HParamInfo >&
+      hparam_infos() const;
+
+  // repeated .tensorboard.hparams.MetricInfo metric_infos = 5;
+  int metric_infos_size() const;
+  private:
+  int _internal_metric_infos_size() const;
+  public:
+  void clear_metric_infos();
+  ::tensorboard::hparams::MetricInfo* mutable_metric_infos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricInfo >*
+      mutable_metric_infos();
+  private:
+  const ::tensorboard::hparams::MetricInfo& _internal_metric_infos(int index) const;
+  ::tensorboard::hparams::MetricInfo* _internal_add_metric_infos();
+  public:
+  const ::tensorboard::hparams::MetricInfo& metric_infos(int index) const;
+  ::tensorboard::hparams::MetricInfo* add_metric_infos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricInfo >&
+      metric_infos() const;
+
+  // string description = 1;
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // string user = 2;
+  void clear_user();
+  const std::string& user() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user();
+  PROTOBUF_NODISCARD std::string* release_user();
+  void set_allocated_user(std::string* user);
+  private:
+  const std::string& _internal_user() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user(const std::string& value);
+  std::string* _internal_mutable_user();
+  public:
+
+  // string name = 6;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // double time_created_secs = 3;
+  void clear_time_created_secs();
+  double time_created_secs() const;
+  void set_time_created_secs(double value);
+  private:
+  double _internal_time_created_secs() const;
+  void _internal_set_time_created_secs(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.Experiment)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::HParamInfo > hparam_infos_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricInfo > metric_infos_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double time_created_secs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HParamInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.HParamInfo) */ {
+ public:
+  inline HParamInfo() : HParamInfo(nullptr) {}
+  ~HParamInfo() override;
+  explicit PROTOBUF_CONSTEXPR HParamInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HParamInfo(const HParamInfo& from);
+  HParamInfo(HParamInfo&& from) noexcept
+    : HParamInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline HParamInfo& operator=(const HParamInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HParamInfo& operator=(HParamInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HParamInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  enum DomainCase {
+    kDomainDiscrete = 5,
+    kDomainInterval = 6,
+    DOMAIN_NOT_SET = 0,
+  };
+
+  static inline const HParamInfo* internal_default_instance() {
+    return reinterpret_cast<const HParamInfo*>(
+               &_HParamInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(HParamInfo& a, HParamInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HParamInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HParamInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HParamInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HParamInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HParamInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HParamInfo& from) {
+    HParamInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HParamInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.HParamInfo";
+  }
+  protected:
+  explicit HParamInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kDisplayNameFieldNumber = 2,
+    kDescriptionFieldNumber = 3,
+    kTypeFieldNumber = 4,
+    kDiffersFieldNumber = 7,
+    kDomainDiscreteFieldNumber = 5,
+    kDomainIntervalFieldNumber = 6,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string display_name = 2;
+  void clear_display_name();
+  const std::string& display_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_display_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_display_name();
+  PROTOBUF_NODISCARD std::string* release_display_name();
+  void set_allocated_display_name(std::string* display_name);
+  private:
+  const std::string& _internal_display_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_display_name(const std::string& value);
+  std::string* _internal_mutable_display_name();
+  public:
+
+  // string description = 3;
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // .tensorboard.hparams.DataType type = 4;
+  void clear_type();
+  ::tensorboard::hparams::DataType type() const;
+  void set_type(::tensorboard::hparams::DataType value);
+  private:
+  ::tensorboard::hparams::DataType _internal_type() const;
+  void _internal_set_type(::tensorboard::hparams::DataType value);
+  public:
+
+  // bool differs = 7;
+  void clear_differs();
+  bool differs() const;
+  void set_differs(bool value);
+  private:
+  bool _internal_differs() const;
+  void _internal_set_differs(bool value);
+  public:
+
+  // .google.protobuf.ListValue domain_discrete = 5;
+  bool has_domain_discrete() const;
+  private:
+  bool _internal_has_domain_discrete() const;
+  public:
+  void clear_domain_discrete();
+  const ::PROTOBUF_NAMESPACE_ID::ListValue& domain_discrete() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::ListValue* release_domain_discrete();
+  ::PROTOBUF_NAMESPACE_ID::ListValue* mutable_domain_discrete();
+  void set_allocated_domain_discrete(::PROTOBUF_NAMESPACE_ID::ListValue* domain_discrete);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::ListValue& _internal_domain_discrete() const;
+  ::PROTOBUF_NAMESPACE_ID::ListValue* _internal_mutable_domain_discrete();
+  public:
+  void unsafe_arena_set_allocated_domain_discrete(
+      ::PROTOBUF_NAMESPACE_ID::ListValue* domain_discrete);
+  ::PROTOBUF_NAMESPACE_ID::ListValue* unsafe_arena_release_domain_discrete();
+
+  // .tensorboard.hparams.Interval domain_interval = 6;
+  bool has_domain_interval() const;
+  private:
+  bool _internal_has_domain_interval() const;
+  public:
+  void clear_domain_interval();
+  const ::tensorboard::hparams::Interval& domain_interval() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::Interval* release_domain_interval();
+  ::tensorboard::hparams::Interval* mutable_domain_interval();
+  void set_allocated_domain_interval(::tensorboard::hparams::Interval* domain_interval);
+  private:
+  const ::tensorboard::hparams::Interval& _internal_domain_interval() const;
+  ::tensorboard::hparams::Interval* _internal_mutable_domain_interval();
+  public:
+  void unsafe_arena_set_allocated_domain_interval(
+      ::tensorboard::hparams::Interval* domain_interval);
+  ::tensorboard::hparams::Interval* unsafe_arena_release_domain_interval();
+
+  void clear_domain();
+  DomainCase domain_case() const;
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.HParamInfo)
+ private:
+  class _Internal;
+  void set_has_domain_discrete();
+  void set_has_domain_interval();
+
+  inline bool has_domain() const;
+  inline void clear_has_domain();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr display_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    int type_;
+    bool differs_;
+    union DomainUnion {
+      constexpr DomainUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::ListValue* domain_discrete_;
+      ::tensorboard::hparams::Interval* domain_interval_;
+    } domain_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Interval final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.Interval) */ {
+ public:
+  inline Interval() : Interval(nullptr) {}
+  ~Interval() override;
+  explicit PROTOBUF_CONSTEXPR Interval(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Interval(const Interval& from);
+  Interval(Interval&& from) noexcept
+    : Interval() {
+    *this = ::std::move(from);
+  }
+
+  inline Interval& operator=(const Interval& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Interval& operator=(Interval&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Interval& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Interval* internal_default_instance() {
+    return reinterpret_cast<const Interval*>(
+               &_Interval_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Interval& a, Interval& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Interval* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Interval* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Interval* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Interval>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Interval& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Interval& from) {
+    Interval::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Interval* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.Interval";
+  }
+  protected:
+  explicit Interval(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMinValueFieldNumber = 1,
+    kMaxValueFieldNumber = 2,
+  };
+  // double min_value = 1;
+  void clear_min_value();
+  double min_value() const;
+  void set_min_value(double value);
+  private:
+  double _internal_min_value() const;
+  void _internal_set_min_value(double value);
+  public:
+
+  // double max_value = 2;
+  void clear_max_value();
+  double max_value() const;
+  void set_max_value(double value);
+  private:
+  double _internal_max_value() const;
+  void _internal_set_max_value(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.Interval)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double min_value_;
+    double max_value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricName final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.MetricName) */ {
+ public:
+  inline MetricName() : MetricName(nullptr) {}
+  ~MetricName() override;
+  explicit PROTOBUF_CONSTEXPR MetricName(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricName(const MetricName& from);
+  MetricName(MetricName&& from) noexcept
+    : MetricName() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricName& operator=(const MetricName& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricName& operator=(MetricName&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricName& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricName* internal_default_instance() {
+    return reinterpret_cast<const MetricName*>(
+               &_MetricName_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MetricName& a, MetricName& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricName* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricName* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricName>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricName& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricName& from) {
+    MetricName::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricName* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.MetricName";
+  }
+  protected:
+  explicit MetricName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGroupFieldNumber = 1,
+    kTagFieldNumber = 2,
+  };
+  // string group = 1;
+  void clear_group();
+  const std::string& group() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_group(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_group();
+  PROTOBUF_NODISCARD std::string* release_group();
+  void set_allocated_group(std::string* group);
+  private:
+  const std::string& _internal_group() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group(const std::string& value);
+  std::string* _internal_mutable_group();
+  public:
+
+  // string tag = 2;
+  void clear_tag();
+  const std::string& tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tag();
+  PROTOBUF_NODISCARD std::string* release_tag();
+  void set_allocated_tag(std::string* tag);
+  private:
+  const std::string& _internal_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tag(const std::string& value);
+  std::string* _internal_mutable_tag();
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.MetricName)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tag_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.MetricInfo) */ {
+ public:
+  inline MetricInfo() : MetricInfo(nullptr) {}
+  ~MetricInfo() override;
+  explicit PROTOBUF_CONSTEXPR MetricInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricInfo(const MetricInfo& from);
+  MetricInfo(MetricInfo&& from) noexcept
+    : MetricInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricInfo& operator=(const MetricInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricInfo& operator=(MetricInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricInfo* internal_default_instance() {
+    return reinterpret_cast<const MetricInfo*>(
+               &_MetricInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(MetricInfo& a, MetricInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricInfo& from) {
+    MetricInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.MetricInfo";
+  }
+  protected:
+  explicit MetricInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDisplayNameFieldNumber = 3,
+    kDescriptionFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kDatasetTypeFieldNumber = 5,
+  };
+  // string display_name = 3;
+  void clear_display_name();
+  const std::string& display_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_display_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_display_name();
+  PROTOBUF_NODISCARD std::string* release_display_name();
+  void set_allocated_display_name(std::string* display_name);
+  private:
+  const std::string& _internal_display_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_display_name(const std::string& value);
+  std::string* _internal_mutable_display_name();
+  public:
+
+  // string description = 4;
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
+
+  // .tensorboard.hparams.MetricName name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const ::tensorboard::hparams::MetricName& name() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::MetricName* release_name();
+  ::tensorboard::hparams::MetricName* mutable_name();
+  void set_allocated_name(::tensorboard::hparams::MetricName* name);
+  private:
+  const ::tensorboard::hparams::MetricName& _internal_name() const;
+  ::tensorboard::hparams::MetricName* _internal_mutable_name();
+  public:
+  void unsafe_arena_set_allocated_name(
+      ::tensorboard::hparams::MetricName* name);
+  ::tensorboard::hparams::MetricName* unsafe_arena_release_name();
+
+  // .tensorboard.hparams.DatasetType dataset_type = 5;
+  void clear_dataset_type();
+  ::tensorboard::hparams::DatasetType dataset_type() const;
+  void set_dataset_type(::tensorboard::hparams::DatasetType value);
+  private:
+  ::tensorboard::hparams::DatasetType _internal_dataset_type() const;
+  void _internal_set_dataset_type(::tensorboard::hparams::DatasetType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.MetricInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr display_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::tensorboard::hparams::MetricName* name_;
+    int dataset_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionGroup_HparamsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SessionGroup_HparamsEntry_DoNotUse, 
+    std::string, ::PROTOBUF_NAMESPACE_ID::Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SessionGroup_HparamsEntry_DoNotUse, 
+    std::string, ::PROTOBUF_NAMESPACE_ID::Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  SessionGroup_HparamsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR SessionGroup_HparamsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit SessionGroup_HparamsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SessionGroup_HparamsEntry_DoNotUse& other);
+  static const SessionGroup_HparamsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SessionGroup_HparamsEntry_DoNotUse*>(&_SessionGroup_HparamsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "tensorboard.hparams.SessionGroup.HparamsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_api_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class SessionGroup final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.SessionGroup) */ {
+ public:
+  inline SessionGroup() : SessionGroup(nullptr) {}
+  ~SessionGroup() override;
+  explicit PROTOBUF_CONSTEXPR SessionGroup(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionGroup(const SessionGroup& from);
+  SessionGroup(SessionGroup&& from) noexcept
+    : SessionGroup() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionGroup& operator=(const SessionGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionGroup& operator=(SessionGroup&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionGroup& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionGroup* internal_default_instance() {
+    return reinterpret_cast<const SessionGroup*>(
+               &_SessionGroup_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SessionGroup& a, SessionGroup& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionGroup* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionGroup* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionGroup* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionGroup>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionGroup& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionGroup& from) {
+    SessionGroup::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionGroup* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.SessionGroup";
+  }
+  protected:
+  explicit SessionGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHparamsFieldNumber = 2,
+    kMetricValuesFieldNumber = 3,
+    kSessionsFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kMonitorUrlFieldNumber = 5,
+  };
+  // map<string, .google.protobuf.Value> hparams = 2;
+  int hparams_size() const;
+  private:
+  int _internal_hparams_size() const;
+  public:
+  void clear_hparams();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+      _internal_hparams() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+      _internal_mutable_hparams();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+      hparams() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+      mutable_hparams();
+
+  // repeated .tensorboard.hparams.MetricValue metric_values = 3;
+  int metric_values_size() const;
+  private:
+  int _internal_metric_values_size() const;
+  public:
+  void clear_metric_values();
+  ::tensorboard::hparams::MetricValue* mutable_metric_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >*
+      mutable_metric_values();
+  private:
+  const ::tensorboard::hparams::MetricValue& _internal_metric_values(int index) const;
+  ::tensorboard::hparams::MetricValue* _internal_add_metric_values();
+  public:
+  const ::tensorboard::hparams::MetricValue& metric_values(int index) const;
+  ::tensorboard::hparams::MetricValue* add_metric_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >&
+      metric_values() const;
+
+  // repeated .tensorboard.hparams.Session sessions = 4;
+  int sessions_size() const;
+  private:
+  int _internal_sessions_size() const;
+  public:
+  void clear_sessions();
+  ::tensorboard::hparams::Session* mutable_sessions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::Session >*
+      mutable_sessions();
+  private:
+  const ::tensorboard::hparams::Session& _internal_sessions(int index) const;
+  ::tensorboard::hparams::Session* _internal_add_sessions();
+  public:
+  const ::tensorboard::hparams::Session& sessions(int index) const;
+  ::tensorboard::hparams::Session* add_sessions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::Session >&
+      sessions() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string monitor_url = 5;
+  void clear_monitor_url();
+  const std::string& monitor_url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_monitor_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_monitor_url();
+  PROTOBUF_NODISCARD std::string* release_monitor_url();
+  void set_allocated_monitor_url(std::string* monitor_url);
+  private:
+  const std::string& _internal_monitor_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_monitor_url(const std::string& value);
+  std::string* _internal_mutable_monitor_url();
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.SessionGroup)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        SessionGroup_HparamsEntry_DoNotUse,
+        std::string, ::PROTOBUF_NAMESPACE_ID::Value,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> hparams_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue > metric_values_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::Session > sessions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr monitor_url_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetricValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.MetricValue) */ {
+ public:
+  inline MetricValue() : MetricValue(nullptr) {}
+  ~MetricValue() override;
+  explicit PROTOBUF_CONSTEXPR MetricValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetricValue(const MetricValue& from);
+  MetricValue(MetricValue&& from) noexcept
+    : MetricValue() {
+    *this = ::std::move(from);
+  }
+
+  inline MetricValue& operator=(const MetricValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetricValue& operator=(MetricValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetricValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetricValue* internal_default_instance() {
+    return reinterpret_cast<const MetricValue*>(
+               &_MetricValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(MetricValue& a, MetricValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetricValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetricValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetricValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetricValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetricValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetricValue& from) {
+    MetricValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetricValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.MetricValue";
+  }
+  protected:
+  explicit MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kWallTimeSecsFieldNumber = 4,
+    kTrainingStepFieldNumber = 3,
+  };
+  // .tensorboard.hparams.MetricName name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const ::tensorboard::hparams::MetricName& name() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::MetricName* release_name();
+  ::tensorboard::hparams::MetricName* mutable_name();
+  void set_allocated_name(::tensorboard::hparams::MetricName* name);
+  private:
+  const ::tensorboard::hparams::MetricName& _internal_name() const;
+  ::tensorboard::hparams::MetricName* _internal_mutable_name();
+  public:
+  void unsafe_arena_set_allocated_name(
+      ::tensorboard::hparams::MetricName* name);
+  ::tensorboard::hparams::MetricName* unsafe_arena_release_name();
+
+  // double value = 2;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // double wall_time_secs = 4;
+  void clear_wall_time_secs();
+  double wall_time_secs() const;
+  void set_wall_time_secs(double value);
+  private:
+  double _internal_wall_time_secs() const;
+  void _internal_set_wall_time_secs(double value);
+  public:
+
+  // int32 training_step = 3;
+  void clear_training_step();
+  int32_t training_step() const;
+  void set_training_step(int32_t value);
+  private:
+  int32_t _internal_training_step() const;
+  void _internal_set_training_step(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.MetricValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::tensorboard::hparams::MetricName* name_;
+    double value_;
+    double wall_time_secs_;
+    int32_t training_step_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Session final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.Session) */ {
+ public:
+  inline Session() : Session(nullptr) {}
+  ~Session() override;
+  explicit PROTOBUF_CONSTEXPR Session(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Session(const Session& from);
+  Session(Session&& from) noexcept
+    : Session() {
+    *this = ::std::move(from);
+  }
+
+  inline Session& operator=(const Session& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Session& operator=(Session&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Session& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Session* internal_default_instance() {
+    return reinterpret_cast<const Session*>(
+               &_Session_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Session& a, Session& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Session* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Session* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Session* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Session>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Session& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Session& from) {
+    Session::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Session* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.Session";
+  }
+  protected:
+  explicit Session(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMetricValuesFieldNumber = 6,
+    kNameFieldNumber = 1,
+    kModelUriFieldNumber = 5,
+    kMonitorUrlFieldNumber = 7,
+    kStartTimeSecsFieldNumber = 2,
+    kEndTimeSecsFieldNumber = 3,
+    kStatusFieldNumber = 4,
+  };
+  // repeated .tensorboard.hparams.MetricValue metric_values = 6;
+  int metric_values_size() const;
+  private:
+  int _internal_metric_values_size() const;
+  public:
+  void clear_metric_values();
+  ::tensorboard::hparams::MetricValue* mutable_metric_values(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >*
+      mutable_metric_values();
+  private:
+  const ::tensorboard::hparams::MetricValue& _internal_metric_values(int index) const;
+  ::tensorboard::hparams::MetricValue* _internal_add_metric_values();
+  public:
+  const ::tensorboard::hparams::MetricValue& metric_values(int index) const;
+  ::tensorboard::hparams::MetricValue* add_metric_values();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >&
+      metric_values() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string model_uri = 5;
+  void clear_model_uri();
+  const std::string& model_uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_model_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_model_uri();
+  PROTOBUF_NODISCARD std::string* release_model_uri();
+  void set_allocated_model_uri(std::string* model_uri);
+  private:
+  const std::string& _internal_model_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_model_uri(const std::string& value);
+  std::string* _internal_mutable_model_uri();
+  public:
+
+  // string monitor_url = 7;
+  void clear_monitor_url();
+  const std::string& monitor_url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_monitor_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_monitor_url();
+  PROTOBUF_NODISCARD std::string* release_monitor_url();
+  void set_allocated_monitor_url(std::string* monitor_url);
+  private:
+  const std::string& _internal_monitor_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_monitor_url(const std::string& value);
+  std::string* _internal_mutable_monitor_url();
+  public:
+
+  // double start_time_secs = 2;
+  void clear_start_time_secs();
+  double start_time_secs() const;
+  void set_start_time_secs(double value);
+  private:
+  double _internal_start_time_secs() const;
+  void _internal_set_start_time_secs(double value);
+  public:
+
+  // double end_time_secs = 3;
+  void clear_end_time_secs();
+  double end_time_secs() const;
+  void set_end_time_secs(double value);
+  private:
+  double _internal_end_time_secs() const;
+  void _internal_set_end_time_secs(double value);
+  public:
+
+  // .tensorboard.hparams.Status status = 4;
+  void clear_status();
+  ::tensorboard::hparams::Status status() const;
+  void set_status(::tensorboard::hparams::Status value);
+  private:
+  ::tensorboard::hparams::Status _internal_status() const;
+  void _internal_set_status(::tensorboard::hparams::Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.Session)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue > metric_values_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr model_uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr monitor_url_;
+    double start_time_secs_;
+    double end_time_secs_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetExperimentRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.GetExperimentRequest) */ {
+ public:
+  inline GetExperimentRequest() : GetExperimentRequest(nullptr) {}
+  ~GetExperimentRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetExperimentRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetExperimentRequest(const GetExperimentRequest& from);
+  GetExperimentRequest(GetExperimentRequest&& from) noexcept
+    : GetExperimentRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetExperimentRequest& operator=(const GetExperimentRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetExperimentRequest& operator=(GetExperimentRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetExperimentRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetExperimentRequest* internal_default_instance() {
+    return reinterpret_cast<const GetExperimentRequest*>(
+               &_GetExperimentRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(GetExperimentRequest& a, GetExperimentRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetExperimentRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetExperimentRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetExperimentRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetExperimentRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetExperimentRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetExperimentRequest& from) {
+    GetExperimentRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetExperimentRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.GetExperimentRequest";
+  }
+  protected:
+  explicit GetExperimentRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExperimentNameFieldNumber = 1,
+    kIncludeMetricsFieldNumber = 2,
+    kHparamsLimitFieldNumber = 3,
+  };
+  // string experiment_name = 1;
+  void clear_experiment_name();
+  const std::string& experiment_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_experiment_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_experiment_name();
+  PROTOBUF_NODISCARD std::string* release_experiment_name();
+  void set_allocated_experiment_name(std::string* experiment_name);
+  private:
+  const std::string& _internal_experiment_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_experiment_name(const std::string& value);
+  std::string* _internal_mutable_experiment_name();
+  public:
+
+  // optional bool include_metrics = 2;
+  bool has_include_metrics() const;
+  private:
+  bool _internal_has_include_metrics() const;
+  public:
+  void clear_include_metrics();
+  bool include_metrics() const;
+  void set_include_metrics(bool value);
+  private:
+  bool _internal_include_metrics() const;
+  void _internal_set_include_metrics(bool value);
+  public:
+
+  // optional int32 hparams_limit = 3;
+  bool has_hparams_limit() const;
+  private:
+  bool _internal_has_hparams_limit() const;
+  public:
+  void clear_hparams_limit();
+  int32_t hparams_limit() const;
+  void set_hparams_limit(int32_t value);
+  private:
+  int32_t _internal_hparams_limit() const;
+  void _internal_set_hparams_limit(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.GetExperimentRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr experiment_name_;
+    bool include_metrics_;
+    int32_t hparams_limit_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListSessionGroupsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.ListSessionGroupsRequest) */ {
+ public:
+  inline ListSessionGroupsRequest() : ListSessionGroupsRequest(nullptr) {}
+  ~ListSessionGroupsRequest() override;
+  explicit PROTOBUF_CONSTEXPR ListSessionGroupsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListSessionGroupsRequest(const ListSessionGroupsRequest& from);
+  ListSessionGroupsRequest(ListSessionGroupsRequest&& from) noexcept
+    : ListSessionGroupsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ListSessionGroupsRequest& operator=(const ListSessionGroupsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListSessionGroupsRequest& operator=(ListSessionGroupsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListSessionGroupsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListSessionGroupsRequest* internal_default_instance() {
+    return reinterpret_cast<const ListSessionGroupsRequest*>(
+               &_ListSessionGroupsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ListSessionGroupsRequest& a, ListSessionGroupsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListSessionGroupsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListSessionGroupsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListSessionGroupsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListSessionGroupsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListSessionGroupsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListSessionGroupsRequest& from) {
+    ListSessionGroupsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListSessionGroupsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.ListSessionGroupsRequest";
+  }
+  protected:
+  explicit ListSessionGroupsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kColParamsFieldNumber = 1,
+    kAllowedStatusesFieldNumber = 7,
+    kExperimentNameFieldNumber = 6,
+    kAggregationMetricFieldNumber = 3,
+    kAggregationTypeFieldNumber = 2,
+    kStartIndexFieldNumber = 4,
+    kSliceSizeFieldNumber = 5,
+    kIncludeMetricsFieldNumber = 8,
+  };
+  // repeated .tensorboard.hparams.ColParams col_params = 1;
+  int col_params_size() const;
+  private:
+  int _internal_col_params_size() const;
+  public:
+  void clear_col_params();
+  ::tensorboard::hparams::ColParams* mutable_col_params(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::ColParams >*
+      mutable_col_params();
+  private:
+  const ::tensorboard::hparams::ColParams& _internal_col_params(int index) const;
+  ::tensorboard::hparams::ColParams* _internal_add_col_params();
+  public:
+  const ::tensorboard::hparams::ColParams& col_params(int index) const;
+  ::tensorboard::hparams::ColParams* add_col_params();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::ColParams >&
+      col_params() const;
+
+  // repeated .tensorboard.hparams.Status allowed_statuses = 7;
+  int allowed_statuses_size() const;
+  private:
+  int _internal_allowed_statuses_size() const;
+  public:
+  void clear_allowed_statuses();
+  private:
+  ::tensorboard::hparams::Status _internal_allowed_statuses(int index) const;
+  void _internal_add_allowed_statuses(::tensorboard::hparams::Status value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_allowed_statuses();
+  public:
+  ::tensorboard::hparams::Status allowed_statuses(int index) const;
+  void set_allowed_statuses(int index, ::tensorboard::hparams::Status value);
+  void add_allowed_statuses(::tensorboard::hparams::Status value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& allowed_statuses() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_allowed_statuses();
+
+  // string experiment_name = 6;
+  void clear_experiment_name();
+  const std::string& experiment_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_experiment_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_experiment_name();
+  PROTOBUF_NODISCARD std::string* release_experiment_name();
+  void set_allocated_experiment_name(std::string* experiment_name);
+  private:
+  const std::string& _internal_experiment_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_experiment_name(const std::string& value);
+  std::string* _internal_mutable_experiment_name();
+  public:
+
+  // .tensorboard.hparams.MetricName aggregation_metric = 3;
+  bool has_aggregation_metric() const;
+  private:
+  bool _internal_has_aggregation_metric() const;
+  public:
+  void clear_aggregation_metric();
+  const ::tensorboard::hparams::MetricName& aggregation_metric() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::MetricName* release_aggregation_metric();
+  ::tensorboard::hparams::MetricName* mutable_aggregation_metric();
+  void set_allocated_aggregation_metric(::tensorboard::hparams::MetricName* aggregation_metric);
+  private:
+  const ::tensorboard::hparams::MetricName& _internal_aggregation_metric() const;
+  ::tensorboard::hparams::MetricName* _internal_mutable_aggregation_metric();
+  public:
+  void unsafe_arena_set_allocated_aggregation_metric(
+      ::tensorboard::hparams::MetricName* aggregation_metric);
+  ::tensorboard::hparams::MetricName* unsafe_arena_release_aggregation_metric();
+
+  // .tensorboard.hparams.AggregationType aggregation_type = 2;
+  void clear_aggregation_type();
+  ::tensorboard::hparams::AggregationType aggregation_type() const;
+  void set_aggregation_type(::tensorboard::hparams::AggregationType value);
+  private:
+  ::tensorboard::hparams::AggregationType _internal_aggregation_type() const;
+  void _internal_set_aggregation_type(::tensorboard::hparams::AggregationType value);
+  public:
+
+  // int32 start_index = 4;
+  void clear_start_index();
+  int32_t start_index() const;
+  void set_start_index(int32_t value);
+  private:
+  int32_t _internal_start_index() const;
+  void _internal_set_start_index(int32_t value);
+  public:
+
+  // int32 slice_size = 5;
+  void clear_slice_size();
+  int32_t slice_size() const;
+  void set_slice_size(int32_t value);
+  private:
+  int32_t _internal_slice_size() const;
+  void _internal_set_slice_size(int32_t value);
+  public:
+
+  // optional bool include_metrics = 8;
+  bool has_include_metrics() const;
+  private:
+  bool _internal_has_include_metrics() const;
+  public:
+  void clear_include_metrics();
+  bool include_metrics() const;
+  void set_include_metrics(bool value);
+  private:
+  bool _internal_include_metrics() const;
+  void _internal_set_include_metrics(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.ListSessionGroupsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::ColParams > col_params_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> allowed_statuses_;
+    mutable std::atomic<int> _allowed_statuses_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr experiment_name_;
+    ::tensorboard::hparams::MetricName* aggregation_metric_;
+    int aggregation_type_;
+    int32_t start_index_;
+    int32_t slice_size_;
+    bool include_metrics_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ColParams final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.ColParams) */ {
+ public:
+  inline ColParams() : ColParams(nullptr) {}
+  ~ColParams() override;
+  explicit PROTOBUF_CONSTEXPR ColParams(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ColParams(const ColParams& from);
+  ColParams(ColParams&& from) noexcept
+    : ColParams() {
+    *this = ::std::move(from);
+  }
+
+  inline ColParams& operator=(const ColParams& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ColParams& operator=(ColParams&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ColParams& default_instance() {
+    return *internal_default_instance();
+  }
+  enum NameCase {
+    kMetric = 1,
+    kHparam = 2,
+    NAME_NOT_SET = 0,
+  };
+
+  enum FilterCase {
+    kFilterRegexp = 5,
+    kFilterInterval = 6,
+    kFilterDiscrete = 7,
+    FILTER_NOT_SET = 0,
+  };
+
+  static inline const ColParams* internal_default_instance() {
+    return reinterpret_cast<const ColParams*>(
+               &_ColParams_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ColParams& a, ColParams& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ColParams* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ColParams* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ColParams* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ColParams>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ColParams& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ColParams& from) {
+    ColParams::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ColParams* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.ColParams";
+  }
+  protected:
+  explicit ColParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOrderFieldNumber = 3,
+    kMissingValuesFirstFieldNumber = 4,
+    kExcludeMissingValuesFieldNumber = 8,
+    kIncludeInResultFieldNumber = 9,
+    kMetricFieldNumber = 1,
+    kHparamFieldNumber = 2,
+    kFilterRegexpFieldNumber = 5,
+    kFilterIntervalFieldNumber = 6,
+    kFilterDiscreteFieldNumber = 7,
+  };
+  // .tensorboard.hparams.SortOrder order = 3;
+  void clear_order();
+  ::tensorboard::hparams::SortOrder order() const;
+  void set_order(::tensorboard::hparams::SortOrder value);
+  private:
+  ::tensorboard::hparams::SortOrder _internal_order() const;
+  void _internal_set_order(::tensorboard::hparams::SortOrder value);
+  public:
+
+  // bool missing_values_first = 4;
+  void clear_missing_values_first();
+  bool missing_values_first() const;
+  void set_missing_values_first(bool value);
+  private:
+  bool _internal_missing_values_first() const;
+  void _internal_set_missing_values_first(bool value);
+  public:
+
+  // bool exclude_missing_values = 8;
+  void clear_exclude_missing_values();
+  bool exclude_missing_values() const;
+  void set_exclude_missing_values(bool value);
+  private:
+  bool _internal_exclude_missing_values() const;
+  void _internal_set_exclude_missing_values(bool value);
+  public:
+
+  // optional bool include_in_result = 9;
+  bool has_include_in_result() const;
+  private:
+  bool _internal_has_include_in_result() const;
+  public:
+  void clear_include_in_result();
+  bool include_in_result() const;
+  void set_include_in_result(bool value);
+  private:
+  bool _internal_include_in_result() const;
+  void _internal_set_include_in_result(bool value);
+  public:
+
+  // .tensorboard.hparams.MetricName metric = 1;
+  bool has_metric() const;
+  private:
+  bool _internal_has_metric() const;
+  public:
+  void clear_metric();
+  const ::tensorboard::hparams::MetricName& metric() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::MetricName* release_metric();
+  ::tensorboard::hparams::MetricName* mutable_metric();
+  void set_allocated_metric(::tensorboard::hparams::MetricName* metric);
+  private:
+  const ::tensorboard::hparams::MetricName& _internal_metric() const;
+  ::tensorboard::hparams::MetricName* _internal_mutable_metric();
+  public:
+  void unsafe_arena_set_allocated_metric(
+      ::tensorboard::hparams::MetricName* metric);
+  ::tensorboard::hparams::MetricName* unsafe_arena_release_metric();
+
+  // string hparam = 2;
+  bool has_hparam() const;
+  private:
+  bool _internal_has_hparam() const;
+  public:
+  void clear_hparam();
+  const std::string& hparam() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hparam(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hparam();
+  PROTOBUF_NODISCARD std::string* release_hparam();
+  void set_allocated_hparam(std::string* hparam);
+  private:
+  const std::string& _internal_hparam() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hparam(const std::string& value);
+  std::string* _internal_mutable_hparam();
+  public:
+
+  // string filter_regexp = 5;
+  bool has_filter_regexp() const;
+  private:
+  bool _internal_has_filter_regexp() const;
+  public:
+  void clear_filter_regexp();
+  const std::string& filter_regexp() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_filter_regexp(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filter_regexp();
+  PROTOBUF_NODISCARD std::string* release_filter_regexp();
+  void set_allocated_filter_regexp(std::string* filter_regexp);
+  private:
+  const std::string& _internal_filter_regexp() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filter_regexp(const std::string& value);
+  std::string* _internal_mutable_filter_regexp();
+  public:
+
+  // .tensorboard.hparams.Interval filter_interval = 6;
+  bool has_filter_interval() const;
+  private:
+  bool _internal_has_filter_interval() const;
+  public:
+  void clear_filter_interval();
+  const ::tensorboard::hparams::Interval& filter_interval() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::Interval* release_filter_interval();
+  ::tensorboard::hparams::Interval* mutable_filter_interval();
+  void set_allocated_filter_interval(::tensorboard::hparams::Interval* filter_interval);
+  private:
+  const ::tensorboard::hparams::Interval& _internal_filter_interval() const;
+  ::tensorboard::hparams::Interval* _internal_mutable_filter_interval();
+  public:
+  void unsafe_arena_set_allocated_filter_interval(
+      ::tensorboard::hparams::Interval* filter_interval);
+  ::tensorboard::hparams::Interval* unsafe_arena_release_filter_interval();
+
+  // .google.protobuf.ListValue filter_discrete = 7;
+  bool has_filter_discrete() const;
+  private:
+  bool _internal_has_filter_discrete() const;
+  public:
+  void clear_filter_discrete();
+  const ::PROTOBUF_NAMESPACE_ID::ListValue& filter_discrete() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::ListValue* release_filter_discrete();
+  ::PROTOBUF_NAMESPACE_ID::ListValue* mutable_filter_discrete();
+  void set_allocated_filter_discrete(::PROTOBUF_NAMESPACE_ID::ListValue* filter_discrete);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::ListValue& _internal_filter_discrete() const;
+  ::PROTOBUF_NAMESPACE_ID::ListValue* _internal_mutable_filter_discrete();
+  public:
+  void unsafe_arena_set_allocated_filter_discrete(
+      ::PROTOBUF_NAMESPACE_ID::ListValue* filter_discrete);
+  ::PROTOBUF_NAMESPACE_ID::ListValue* unsafe_arena_release_filter_discrete();
+
+  void clear_name();
+  NameCase name_case() const;
+  void clear_filter();
+  FilterCase filter_case() const;
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.ColParams)
+ private:
+  class _Internal;
+  void set_has_metric();
+  void set_has_hparam();
+  void set_has_filter_regexp();
+  void set_has_filter_interval();
+  void set_has_filter_discrete();
+
+  inline bool has_name() const;
+  inline void clear_has_name();
+
+  inline bool has_filter() const;
+  inline void clear_has_filter();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int order_;
+    bool missing_values_first_;
+    bool exclude_missing_values_;
+    bool include_in_result_;
+    union NameUnion {
+      constexpr NameUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::tensorboard::hparams::MetricName* metric_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hparam_;
+    } name_;
+    union FilterUnion {
+      constexpr FilterUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_regexp_;
+      ::tensorboard::hparams::Interval* filter_interval_;
+      ::PROTOBUF_NAMESPACE_ID::ListValue* filter_discrete_;
+    } filter_;
+    uint32_t _oneof_case_[2];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListSessionGroupsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.ListSessionGroupsResponse) */ {
+ public:
+  inline ListSessionGroupsResponse() : ListSessionGroupsResponse(nullptr) {}
+  ~ListSessionGroupsResponse() override;
+  explicit PROTOBUF_CONSTEXPR ListSessionGroupsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListSessionGroupsResponse(const ListSessionGroupsResponse& from);
+  ListSessionGroupsResponse(ListSessionGroupsResponse&& from) noexcept
+    : ListSessionGroupsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ListSessionGroupsResponse& operator=(const ListSessionGroupsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListSessionGroupsResponse& operator=(ListSessionGroupsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListSessionGroupsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListSessionGroupsResponse* internal_default_instance() {
+    return reinterpret_cast<const ListSessionGroupsResponse*>(
+               &_ListSessionGroupsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ListSessionGroupsResponse& a, ListSessionGroupsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListSessionGroupsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListSessionGroupsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListSessionGroupsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListSessionGroupsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListSessionGroupsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListSessionGroupsResponse& from) {
+    ListSessionGroupsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListSessionGroupsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.ListSessionGroupsResponse";
+  }
+  protected:
+  explicit ListSessionGroupsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionGroupsFieldNumber = 1,
+    kTotalSizeFieldNumber = 3,
+  };
+  // repeated .tensorboard.hparams.SessionGroup session_groups = 1;
+  int session_groups_size() const;
+  private:
+  int _internal_session_groups_size() const;
+  public:
+  void clear_session_groups();
+  ::tensorboard::hparams::SessionGroup* mutable_session_groups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::SessionGroup >*
+      mutable_session_groups();
+  private:
+  const ::tensorboard::hparams::SessionGroup& _internal_session_groups(int index) const;
+  ::tensorboard::hparams::SessionGroup* _internal_add_session_groups();
+  public:
+  const ::tensorboard::hparams::SessionGroup& session_groups(int index) const;
+  ::tensorboard::hparams::SessionGroup* add_session_groups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::SessionGroup >&
+      session_groups() const;
+
+  // int32 total_size = 3;
+  void clear_total_size();
+  int32_t total_size() const;
+  void set_total_size(int32_t value);
+  private:
+  int32_t _internal_total_size() const;
+  void _internal_set_total_size(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.ListSessionGroupsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::SessionGroup > session_groups_;
+    int32_t total_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListMetricEvalsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.ListMetricEvalsRequest) */ {
+ public:
+  inline ListMetricEvalsRequest() : ListMetricEvalsRequest(nullptr) {}
+  ~ListMetricEvalsRequest() override;
+  explicit PROTOBUF_CONSTEXPR ListMetricEvalsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListMetricEvalsRequest(const ListMetricEvalsRequest& from);
+  ListMetricEvalsRequest(ListMetricEvalsRequest&& from) noexcept
+    : ListMetricEvalsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ListMetricEvalsRequest& operator=(const ListMetricEvalsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListMetricEvalsRequest& operator=(ListMetricEvalsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListMetricEvalsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListMetricEvalsRequest* internal_default_instance() {
+    return reinterpret_cast<const ListMetricEvalsRequest*>(
+               &_ListMetricEvalsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ListMetricEvalsRequest& a, ListMetricEvalsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListMetricEvalsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListMetricEvalsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListMetricEvalsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListMetricEvalsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListMetricEvalsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListMetricEvalsRequest& from) {
+    ListMetricEvalsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListMetricEvalsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.ListMetricEvalsRequest";
+  }
+  protected:
+  explicit ListMetricEvalsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionNameFieldNumber = 1,
+    kExperimentNameFieldNumber = 3,
+    kMetricNameFieldNumber = 2,
+  };
+  // string session_name = 1;
+  void clear_session_name();
+  const std::string& session_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_name();
+  PROTOBUF_NODISCARD std::string* release_session_name();
+  void set_allocated_session_name(std::string* session_name);
+  private:
+  const std::string& _internal_session_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_name(const std::string& value);
+  std::string* _internal_mutable_session_name();
+  public:
+
+  // string experiment_name = 3;
+  void clear_experiment_name();
+  const std::string& experiment_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_experiment_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_experiment_name();
+  PROTOBUF_NODISCARD std::string* release_experiment_name();
+  void set_allocated_experiment_name(std::string* experiment_name);
+  private:
+  const std::string& _internal_experiment_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_experiment_name(const std::string& value);
+  std::string* _internal_mutable_experiment_name();
+  public:
+
+  // .tensorboard.hparams.MetricName metric_name = 2;
+  bool has_metric_name() const;
+  private:
+  bool _internal_has_metric_name() const;
+  public:
+  void clear_metric_name();
+  const ::tensorboard::hparams::MetricName& metric_name() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::MetricName* release_metric_name();
+  ::tensorboard::hparams::MetricName* mutable_metric_name();
+  void set_allocated_metric_name(::tensorboard::hparams::MetricName* metric_name);
+  private:
+  const ::tensorboard::hparams::MetricName& _internal_metric_name() const;
+  ::tensorboard::hparams::MetricName* _internal_mutable_metric_name();
+  public:
+  void unsafe_arena_set_allocated_metric_name(
+      ::tensorboard::hparams::MetricName* metric_name);
+  ::tensorboard::hparams::MetricName* unsafe_arena_release_metric_name();
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.ListMetricEvalsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr experiment_name_;
+    ::tensorboard::hparams::MetricName* metric_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_api_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Experiment
+
+// string name = 6;
+inline void Experiment::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Experiment::name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Experiment.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Experiment::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Experiment.name)
+}
+inline std::string* Experiment::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Experiment.name)
+  return _s;
+}
+inline const std::string& Experiment::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Experiment::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Experiment::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Experiment::release_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.Experiment.name)
+  return _impl_.name_.Release();
+}
+inline void Experiment::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.Experiment.name)
+}
+
+// string description = 1;
+inline void Experiment::clear_description() {
+  _impl_.description_.ClearToEmpty();
+}
+inline const std::string& Experiment::description() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Experiment.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Experiment::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Experiment.description)
+}
+inline std::string* Experiment::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Experiment.description)
+  return _s;
+}
+inline const std::string& Experiment::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void Experiment::_internal_set_description(const std::string& value) {
+  
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Experiment::_internal_mutable_description() {
+  
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Experiment::release_description() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.Experiment.description)
+  return _impl_.description_.Release();
+}
+inline void Experiment::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.Experiment.description)
+}
+
+// string user = 2;
+inline void Experiment::clear_user() {
+  _impl_.user_.ClearToEmpty();
+}
+inline const std::string& Experiment::user() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Experiment.user)
+  return _internal_user();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Experiment::set_user(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.user_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Experiment.user)
+}
+inline std::string* Experiment::mutable_user() {
+  std::string* _s = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Experiment.user)
+  return _s;
+}
+inline const std::string& Experiment::_internal_user() const {
+  return _impl_.user_.Get();
+}
+inline void Experiment::_internal_set_user(const std::string& value) {
+  
+  _impl_.user_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Experiment::_internal_mutable_user() {
+  
+  return _impl_.user_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Experiment::release_user() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.Experiment.user)
+  return _impl_.user_.Release();
+}
+inline void Experiment::set_allocated_user(std::string* user) {
+  if (user != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.user_.SetAllocated(user, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_.IsDefault()) {
+    _impl_.user_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.Experiment.user)
+}
+
+// double time_created_secs = 3;
+inline void Experiment::clear_time_created_secs() {
+  _impl_.time_created_secs_ = 0;
+}
+inline double Experiment::_internal_time_created_secs() const {
+  return _impl_.time_created_secs_;
+}
+inline double Experiment::time_created_secs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Experiment.time_created_secs)
+  return _internal_time_created_secs();
+}
+inline void Experiment::_internal_set_time_created_secs(double value) {
+  
+  _impl_.time_created_secs_ = value;
+}
+inline void Experiment::set_time_created_secs(double value) {
+  _internal_set_time_created_secs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Experiment.time_created_secs)
+}
+
+// repeated .tensorboard.hparams.HParamInfo hparam_infos = 4;
+inline int Experiment::_internal_hparam_infos_size() const {
+  return _impl_.hparam_infos_.size();
+}
+inline int Experiment::hparam_infos_size() const {
+  return _internal_hparam_infos_size();
+}
+inline void Experiment::clear_hparam_infos() {
+  _impl_.hparam_infos_.Clear();
+}
+inline ::tensorboard::hparams::HParamInfo* Experiment::mutable_hparam_infos(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Experiment.hparam_infos)
+  return _impl_.hparam_infos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::HParamInfo >*
+Experiment::mutable_hparam_infos() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.Experiment.hparam_infos)
+  return &_impl_.hparam_infos_;
+}
+inline const ::tensorboard::hparams::HParamInfo& Experiment::_internal_hparam_infos(int index) const {
+  return _impl_.hparam_infos_.Get(index);
+}
+inline const ::tensorboard::hparams::HParamInfo& Experiment::hparam_infos(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Experiment.hparam_infos)
+  return _internal_hparam_infos(index);
+}
+inline ::tensorboard::hparams::HParamInfo* Experiment::_internal_add_hparam_infos() {
+  return _impl_.hparam_infos_.Add();
+}
+inline ::tensorboard::hparams::HParamInfo* Experiment::add_hparam_infos() {
+  ::tensorboard::hparams::HParamInfo* _add = _internal_add_hparam_infos();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.Experiment.hparam_infos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::HParamInfo >&
+Experiment::hparam_infos() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.Experiment.hparam_infos)
+  return _impl_.hparam_infos_;
+}
+
+// repeated .tensorboard.hparams.MetricInfo metric_infos = 5;
+inline int Experiment::_internal_metric_infos_size() const {
+  return _impl_.metric_infos_.size();
+}
+inline int Experiment::metric_infos_size() const {
+  return _internal_metric_infos_size();
+}
+inline void Experiment::clear_metric_infos() {
+  _impl_.metric_infos_.Clear();
+}
+inline ::tensorboard::hparams::MetricInfo* Experiment::mutable_metric_infos(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Experiment.metric_infos)
+  return _impl_.metric_infos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricInfo >*
+Experiment::mutable_metric_infos() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.Experiment.metric_infos)
+  return &_impl_.metric_infos_;
+}
+inline const ::tensorboard::hparams::MetricInfo& Experiment::_internal_metric_infos(int index) const {
+  return _impl_.metric_infos_.Get(index);
+}
+inline const ::tensorboard::hparams::MetricInfo& Experiment::metric_infos(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Experiment.metric_infos)
+  return _internal_metric_infos(index);
+}
+inline ::tensorboard::hparams::MetricInfo* Experiment::_internal_add_metric_infos() {
+  return _impl_.metric_infos_.Add();
+}
+inline ::tensorboard::hparams::MetricInfo* Experiment::add_metric_infos() {
+  ::tensorboard::hparams::MetricInfo* _add = _internal_add_metric_infos();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.Experiment.metric_infos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricInfo >&
+Experiment::metric_infos() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.Experiment.metric_infos)
+  return _impl_.metric_infos_;
+}
+
+// -------------------------------------------------------------------
+
+// HParamInfo
+
+// string name = 1;
+inline void HParamInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& HParamInfo::name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HParamInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.HParamInfo.name)
+}
+inline std::string* HParamInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamInfo.name)
+  return _s;
+}
+inline const std::string& HParamInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void HParamInfo::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HParamInfo::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HParamInfo::release_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamInfo.name)
+  return _impl_.name_.Release();
+}
+inline void HParamInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamInfo.name)
+}
+
+// string display_name = 2;
+inline void HParamInfo::clear_display_name() {
+  _impl_.display_name_.ClearToEmpty();
+}
+inline const std::string& HParamInfo::display_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.display_name)
+  return _internal_display_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HParamInfo::set_display_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.display_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.HParamInfo.display_name)
+}
+inline std::string* HParamInfo::mutable_display_name() {
+  std::string* _s = _internal_mutable_display_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamInfo.display_name)
+  return _s;
+}
+inline const std::string& HParamInfo::_internal_display_name() const {
+  return _impl_.display_name_.Get();
+}
+inline void HParamInfo::_internal_set_display_name(const std::string& value) {
+  
+  _impl_.display_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HParamInfo::_internal_mutable_display_name() {
+  
+  return _impl_.display_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HParamInfo::release_display_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamInfo.display_name)
+  return _impl_.display_name_.Release();
+}
+inline void HParamInfo::set_allocated_display_name(std::string* display_name) {
+  if (display_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.display_name_.SetAllocated(display_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.display_name_.IsDefault()) {
+    _impl_.display_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamInfo.display_name)
+}
+
+// string description = 3;
+inline void HParamInfo::clear_description() {
+  _impl_.description_.ClearToEmpty();
+}
+inline const std::string& HParamInfo::description() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HParamInfo::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.HParamInfo.description)
+}
+inline std::string* HParamInfo::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamInfo.description)
+  return _s;
+}
+inline const std::string& HParamInfo::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void HParamInfo::_internal_set_description(const std::string& value) {
+  
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HParamInfo::_internal_mutable_description() {
+  
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HParamInfo::release_description() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamInfo.description)
+  return _impl_.description_.Release();
+}
+inline void HParamInfo::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamInfo.description)
+}
+
+// .tensorboard.hparams.DataType type = 4;
+inline void HParamInfo::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::tensorboard::hparams::DataType HParamInfo::_internal_type() const {
+  return static_cast< ::tensorboard::hparams::DataType >(_impl_.type_);
+}
+inline ::tensorboard::hparams::DataType HParamInfo::type() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.type)
+  return _internal_type();
+}
+inline void HParamInfo::_internal_set_type(::tensorboard::hparams::DataType value) {
+  
+  _impl_.type_ = value;
+}
+inline void HParamInfo::set_type(::tensorboard::hparams::DataType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.HParamInfo.type)
+}
+
+// .google.protobuf.ListValue domain_discrete = 5;
+inline bool HParamInfo::_internal_has_domain_discrete() const {
+  return domain_case() == kDomainDiscrete;
+}
+inline bool HParamInfo::has_domain_discrete() const {
+  return _internal_has_domain_discrete();
+}
+inline void HParamInfo::set_has_domain_discrete() {
+  _impl_._oneof_case_[0] = kDomainDiscrete;
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* HParamInfo::release_domain_discrete() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamInfo.domain_discrete)
+  if (_internal_has_domain_discrete()) {
+    clear_has_domain();
+    ::PROTOBUF_NAMESPACE_ID::ListValue* temp = _impl_.domain_.domain_discrete_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.domain_.domain_discrete_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::PROTOBUF_NAMESPACE_ID::ListValue& HParamInfo::_internal_domain_discrete() const {
+  return _internal_has_domain_discrete()
+      ? *_impl_.domain_.domain_discrete_
+      : reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::ListValue&>(::PROTOBUF_NAMESPACE_ID::_ListValue_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::ListValue& HParamInfo::domain_discrete() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.domain_discrete)
+  return _internal_domain_discrete();
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* HParamInfo::unsafe_arena_release_domain_discrete() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.HParamInfo.domain_discrete)
+  if (_internal_has_domain_discrete()) {
+    clear_has_domain();
+    ::PROTOBUF_NAMESPACE_ID::ListValue* temp = _impl_.domain_.domain_discrete_;
+    _impl_.domain_.domain_discrete_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void HParamInfo::unsafe_arena_set_allocated_domain_discrete(::PROTOBUF_NAMESPACE_ID::ListValue* domain_discrete) {
+  clear_domain();
+  if (domain_discrete) {
+    set_has_domain_discrete();
+    _impl_.domain_.domain_discrete_ = domain_discrete;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.HParamInfo.domain_discrete)
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* HParamInfo::_internal_mutable_domain_discrete() {
+  if (!_internal_has_domain_discrete()) {
+    clear_domain();
+    set_has_domain_discrete();
+    _impl_.domain_.domain_discrete_ = CreateMaybeMessage< ::PROTOBUF_NAMESPACE_ID::ListValue >(GetArenaForAllocation());
+  }
+  return _impl_.domain_.domain_discrete_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* HParamInfo::mutable_domain_discrete() {
+  ::PROTOBUF_NAMESPACE_ID::ListValue* _msg = _internal_mutable_domain_discrete();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamInfo.domain_discrete)
+  return _msg;
+}
+
+// .tensorboard.hparams.Interval domain_interval = 6;
+inline bool HParamInfo::_internal_has_domain_interval() const {
+  return domain_case() == kDomainInterval;
+}
+inline bool HParamInfo::has_domain_interval() const {
+  return _internal_has_domain_interval();
+}
+inline void HParamInfo::set_has_domain_interval() {
+  _impl_._oneof_case_[0] = kDomainInterval;
+}
+inline void HParamInfo::clear_domain_interval() {
+  if (_internal_has_domain_interval()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.domain_.domain_interval_;
+    }
+    clear_has_domain();
+  }
+}
+inline ::tensorboard::hparams::Interval* HParamInfo::release_domain_interval() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamInfo.domain_interval)
+  if (_internal_has_domain_interval()) {
+    clear_has_domain();
+    ::tensorboard::hparams::Interval* temp = _impl_.domain_.domain_interval_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.domain_.domain_interval_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tensorboard::hparams::Interval& HParamInfo::_internal_domain_interval() const {
+  return _internal_has_domain_interval()
+      ? *_impl_.domain_.domain_interval_
+      : reinterpret_cast< ::tensorboard::hparams::Interval&>(::tensorboard::hparams::_Interval_default_instance_);
+}
+inline const ::tensorboard::hparams::Interval& HParamInfo::domain_interval() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.domain_interval)
+  return _internal_domain_interval();
+}
+inline ::tensorboard::hparams::Interval* HParamInfo::unsafe_arena_release_domain_interval() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.HParamInfo.domain_interval)
+  if (_internal_has_domain_interval()) {
+    clear_has_domain();
+    ::tensorboard::hparams::Interval* temp = _impl_.domain_.domain_interval_;
+    _impl_.domain_.domain_interval_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void HParamInfo::unsafe_arena_set_allocated_domain_interval(::tensorboard::hparams::Interval* domain_interval) {
+  clear_domain();
+  if (domain_interval) {
+    set_has_domain_interval();
+    _impl_.domain_.domain_interval_ = domain_interval;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.HParamInfo.domain_interval)
+}
+inline ::tensorboard::hparams::Interval* HParamInfo::_internal_mutable_domain_interval() {
+  if (!_internal_has_domain_interval()) {
+    clear_domain();
+    set_has_domain_interval();
+    _impl_.domain_.domain_interval_ = CreateMaybeMessage< ::tensorboard::hparams::Interval >(GetArenaForAllocation());
+  }
+  return _impl_.domain_.domain_interval_;
+}
+inline ::tensorboard::hparams::Interval* HParamInfo::mutable_domain_interval() {
+  ::tensorboard::hparams::Interval* _msg = _internal_mutable_domain_interval();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamInfo.domain_interval)
+  return _msg;
+}
+
+// bool differs = 7;
+inline void HParamInfo::clear_differs() {
+  _impl_.differs_ = false;
+}
+inline bool HParamInfo::_internal_differs() const {
+  return _impl_.differs_;
+}
+inline bool HParamInfo::differs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamInfo.differs)
+  return _internal_differs();
+}
+inline void HParamInfo::_internal_set_differs(bool value) {
+  
+  _impl_.differs_ = value;
+}
+inline void HParamInfo::set_differs(bool value) {
+  _internal_set_differs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.HParamInfo.differs)
+}
+
+inline bool HParamInfo::has_domain() const {
+  return domain_case() != DOMAIN_NOT_SET;
+}
+inline void HParamInfo::clear_has_domain() {
+  _impl_._oneof_case_[0] = DOMAIN_NOT_SET;
+}
+inline HParamInfo::DomainCase HParamInfo::domain_case() const {
+  return HParamInfo::DomainCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// Interval
+
+// double min_value = 1;
+inline void Interval::clear_min_value() {
+  _impl_.min_value_ = 0;
+}
+inline double Interval::_internal_min_value() const {
+  return _impl_.min_value_;
+}
+inline double Interval::min_value() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Interval.min_value)
+  return _internal_min_value();
+}
+inline void Interval::_internal_set_min_value(double value) {
+  
+  _impl_.min_value_ = value;
+}
+inline void Interval::set_min_value(double value) {
+  _internal_set_min_value(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Interval.min_value)
+}
+
+// double max_value = 2;
+inline void Interval::clear_max_value() {
+  _impl_.max_value_ = 0;
+}
+inline double Interval::_internal_max_value() const {
+  return _impl_.max_value_;
+}
+inline double Interval::max_value() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Interval.max_value)
+  return _internal_max_value();
+}
+inline void Interval::_internal_set_max_value(double value) {
+  
+  _impl_.max_value_ = value;
+}
+inline void Interval::set_max_value(double value) {
+  _internal_set_max_value(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Interval.max_value)
+}
+
+// -------------------------------------------------------------------
+
+// MetricName
+
+// string group = 1;
+inline void MetricName::clear_group() {
+  _impl_.group_.ClearToEmpty();
+}
+inline const std::string& MetricName::group() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricName.group)
+  return _internal_group();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricName::set_group(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.group_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricName.group)
+}
+inline std::string* MetricName::mutable_group() {
+  std::string* _s = _internal_mutable_group();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.MetricName.group)
+  return _s;
+}
+inline const std::string& MetricName::_internal_group() const {
+  return _impl_.group_.Get();
+}
+inline void MetricName::_internal_set_group(const std::string& value) {
+  
+  _impl_.group_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricName::_internal_mutable_group() {
+  
+  return _impl_.group_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricName::release_group() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.MetricName.group)
+  return _impl_.group_.Release();
+}
+inline void MetricName::set_allocated_group(std::string* group) {
+  if (group != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.group_.SetAllocated(group, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.group_.IsDefault()) {
+    _impl_.group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.MetricName.group)
+}
+
+// string tag = 2;
+inline void MetricName::clear_tag() {
+  _impl_.tag_.ClearToEmpty();
+}
+inline const std::string& MetricName::tag() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricName.tag)
+  return _internal_tag();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricName::set_tag(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricName.tag)
+}
+inline std::string* MetricName::mutable_tag() {
+  std::string* _s = _internal_mutable_tag();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.MetricName.tag)
+  return _s;
+}
+inline const std::string& MetricName::_internal_tag() const {
+  return _impl_.tag_.Get();
+}
+inline void MetricName::_internal_set_tag(const std::string& value) {
+  
+  _impl_.tag_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricName::_internal_mutable_tag() {
+  
+  return _impl_.tag_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricName::release_tag() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.MetricName.tag)
+  return _impl_.tag_.Release();
+}
+inline void MetricName::set_allocated_tag(std::string* tag) {
+  if (tag != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tag_.SetAllocated(tag, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tag_.IsDefault()) {
+    _impl_.tag_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.MetricName.tag)
+}
+
+// -------------------------------------------------------------------
+
+// MetricInfo
+
+// .tensorboard.hparams.MetricName name = 1;
+inline bool MetricInfo::_internal_has_name() const {
+  return this != internal_default_instance() && _impl_.name_ != nullptr;
+}
+inline bool MetricInfo::has_name() const {
+  return _internal_has_name();
+}
+inline void MetricInfo::clear_name() {
+  if (GetArenaForAllocation() == nullptr && _impl_.name_ != nullptr) {
+    delete _impl_.name_;
+  }
+  _impl_.name_ = nullptr;
+}
+inline const ::tensorboard::hparams::MetricName& MetricInfo::_internal_name() const {
+  const ::tensorboard::hparams::MetricName* p = _impl_.name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tensorboard::hparams::MetricName&>(
+      ::tensorboard::hparams::_MetricName_default_instance_);
+}
+inline const ::tensorboard::hparams::MetricName& MetricInfo::name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricInfo.name)
+  return _internal_name();
+}
+inline void MetricInfo::unsafe_arena_set_allocated_name(
+    ::tensorboard::hparams::MetricName* name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.name_);
+  }
+  _impl_.name_ = name;
+  if (name) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.MetricInfo.name)
+}
+inline ::tensorboard::hparams::MetricName* MetricInfo::release_name() {
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* MetricInfo::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.MetricInfo.name)
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* MetricInfo::_internal_mutable_name() {
+  
+  if (_impl_.name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tensorboard::hparams::MetricName>(GetArenaForAllocation());
+    _impl_.name_ = p;
+  }
+  return _impl_.name_;
+}
+inline ::tensorboard::hparams::MetricName* MetricInfo::mutable_name() {
+  ::tensorboard::hparams::MetricName* _msg = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.MetricInfo.name)
+  return _msg;
+}
+inline void MetricInfo::set_allocated_name(::tensorboard::hparams::MetricName* name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.name_;
+  }
+  if (name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(name);
+    if (message_arena != submessage_arena) {
+      name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, name, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.name_ = name;
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.MetricInfo.name)
+}
+
+// string display_name = 3;
+inline void MetricInfo::clear_display_name() {
+  _impl_.display_name_.ClearToEmpty();
+}
+inline const std::string& MetricInfo::display_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricInfo.display_name)
+  return _internal_display_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricInfo::set_display_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.display_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricInfo.display_name)
+}
+inline std::string* MetricInfo::mutable_display_name() {
+  std::string* _s = _internal_mutable_display_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.MetricInfo.display_name)
+  return _s;
+}
+inline const std::string& MetricInfo::_internal_display_name() const {
+  return _impl_.display_name_.Get();
+}
+inline void MetricInfo::_internal_set_display_name(const std::string& value) {
+  
+  _impl_.display_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricInfo::_internal_mutable_display_name() {
+  
+  return _impl_.display_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricInfo::release_display_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.MetricInfo.display_name)
+  return _impl_.display_name_.Release();
+}
+inline void MetricInfo::set_allocated_display_name(std::string* display_name) {
+  if (display_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.display_name_.SetAllocated(display_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.display_name_.IsDefault()) {
+    _impl_.display_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.MetricInfo.display_name)
+}
+
+// string description = 4;
+inline void MetricInfo::clear_description() {
+  _impl_.description_.ClearToEmpty();
+}
+inline const std::string& MetricInfo::description() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricInfo.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetricInfo::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricInfo.description)
+}
+inline std::string* MetricInfo::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.MetricInfo.description)
+  return _s;
+}
+inline const std::string& MetricInfo::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void MetricInfo::_internal_set_description(const std::string& value) {
+  
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetricInfo::_internal_mutable_description() {
+  
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetricInfo::release_description() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.MetricInfo.description)
+  return _impl_.description_.Release();
+}
+inline void MetricInfo::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.MetricInfo.description)
+}
+
+// .tensorboard.hparams.DatasetType dataset_type = 5;
+inline void MetricInfo::clear_dataset_type() {
+  _impl_.dataset_type_ = 0;
+}
+inline ::tensorboard::hparams::DatasetType MetricInfo::_internal_dataset_type() const {
+  return static_cast< ::tensorboard::hparams::DatasetType >(_impl_.dataset_type_);
+}
+inline ::tensorboard::hparams::DatasetType MetricInfo::dataset_type() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricInfo.dataset_type)
+  return _internal_dataset_type();
+}
+inline void MetricInfo::_internal_set_dataset_type(::tensorboard::hparams::DatasetType value) {
+  
+  _impl_.dataset_type_ = value;
+}
+inline void MetricInfo::set_dataset_type(::tensorboard::hparams::DatasetType value) {
+  _internal_set_dataset_type(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricInfo.dataset_type)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// SessionGroup
+
+// string name = 1;
+inline void SessionGroup::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SessionGroup::name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionGroup.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionGroup::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionGroup.name)
+}
+inline std::string* SessionGroup::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionGroup.name)
+  return _s;
+}
+inline const std::string& SessionGroup::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SessionGroup::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionGroup::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionGroup::release_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.SessionGroup.name)
+  return _impl_.name_.Release();
+}
+inline void SessionGroup::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.SessionGroup.name)
+}
+
+// map<string, .google.protobuf.Value> hparams = 2;
+inline int SessionGroup::_internal_hparams_size() const {
+  return _impl_.hparams_.size();
+}
+inline int SessionGroup::hparams_size() const {
+  return _internal_hparams_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+SessionGroup::_internal_hparams() const {
+  return _impl_.hparams_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+SessionGroup::hparams() const {
+  // @@protoc_insertion_point(field_map:tensorboard.hparams.SessionGroup.hparams)
+  return _internal_hparams();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+SessionGroup::_internal_mutable_hparams() {
+  return _impl_.hparams_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+SessionGroup::mutable_hparams() {
+  // @@protoc_insertion_point(field_mutable_map:tensorboard.hparams.SessionGroup.hparams)
+  return _internal_mutable_hparams();
+}
+
+// repeated .tensorboard.hparams.MetricValue metric_values = 3;
+inline int SessionGroup::_internal_metric_values_size() const {
+  return _impl_.metric_values_.size();
+}
+inline int SessionGroup::metric_values_size() const {
+  return _internal_metric_values_size();
+}
+inline void SessionGroup::clear_metric_values() {
+  _impl_.metric_values_.Clear();
+}
+inline ::tensorboard::hparams::MetricValue* SessionGroup::mutable_metric_values(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionGroup.metric_values)
+  return _impl_.metric_values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >*
+SessionGroup::mutable_metric_values() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.SessionGroup.metric_values)
+  return &_impl_.metric_values_;
+}
+inline const ::tensorboard::hparams::MetricValue& SessionGroup::_internal_metric_values(int index) const {
+  return _impl_.metric_values_.Get(index);
+}
+inline const ::tensorboard::hparams::MetricValue& SessionGroup::metric_values(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionGroup.metric_values)
+  return _internal_metric_values(index);
+}
+inline ::tensorboard::hparams::MetricValue* SessionGroup::_internal_add_metric_values() {
+  return _impl_.metric_values_.Add();
+}
+inline ::tensorboard::hparams::MetricValue* SessionGroup::add_metric_values() {
+  ::tensorboard::hparams::MetricValue* _add = _internal_add_metric_values();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.SessionGroup.metric_values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >&
+SessionGroup::metric_values() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.SessionGroup.metric_values)
+  return _impl_.metric_values_;
+}
+
+// repeated .tensorboard.hparams.Session sessions = 4;
+inline int SessionGroup::_internal_sessions_size() const {
+  return _impl_.sessions_.size();
+}
+inline int SessionGroup::sessions_size() const {
+  return _internal_sessions_size();
+}
+inline void SessionGroup::clear_sessions() {
+  _impl_.sessions_.Clear();
+}
+inline ::tensorboard::hparams::Session* SessionGroup::mutable_sessions(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionGroup.sessions)
+  return _impl_.sessions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::Session >*
+SessionGroup::mutable_sessions() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.SessionGroup.sessions)
+  return &_impl_.sessions_;
+}
+inline const ::tensorboard::hparams::Session& SessionGroup::_internal_sessions(int index) const {
+  return _impl_.sessions_.Get(index);
+}
+inline const ::tensorboard::hparams::Session& SessionGroup::sessions(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionGroup.sessions)
+  return _internal_sessions(index);
+}
+inline ::tensorboard::hparams::Session* SessionGroup::_internal_add_sessions() {
+  return _impl_.sessions_.Add();
+}
+inline ::tensorboard::hparams::Session* SessionGroup::add_sessions() {
+  ::tensorboard::hparams::Session* _add = _internal_add_sessions();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.SessionGroup.sessions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::Session >&
+SessionGroup::sessions() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.SessionGroup.sessions)
+  return _impl_.sessions_;
+}
+
+// string monitor_url = 5;
+inline void SessionGroup::clear_monitor_url() {
+  _impl_.monitor_url_.ClearToEmpty();
+}
+inline const std::string& SessionGroup::monitor_url() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionGroup.monitor_url)
+  return _internal_monitor_url();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionGroup::set_monitor_url(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.monitor_url_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionGroup.monitor_url)
+}
+inline std::string* SessionGroup::mutable_monitor_url() {
+  std::string* _s = _internal_mutable_monitor_url();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionGroup.monitor_url)
+  return _s;
+}
+inline const std::string& SessionGroup::_internal_monitor_url() const {
+  return _impl_.monitor_url_.Get();
+}
+inline void SessionGroup::_internal_set_monitor_url(const std::string& value) {
+  
+  _impl_.monitor_url_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionGroup::_internal_mutable_monitor_url() {
+  
+  return _impl_.monitor_url_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionGroup::release_monitor_url() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.SessionGroup.monitor_url)
+  return _impl_.monitor_url_.Release();
+}
+inline void SessionGroup::set_allocated_monitor_url(std::string* monitor_url) {
+  if (monitor_url != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.monitor_url_.SetAllocated(monitor_url, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.monitor_url_.IsDefault()) {
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.SessionGroup.monitor_url)
+}
+
+// -------------------------------------------------------------------
+
+// MetricValue
+
+// .tensorboard.hparams.MetricName name = 1;
+inline bool MetricValue::_internal_has_name() const {
+  return this != internal_default_instance() && _impl_.name_ != nullptr;
+}
+inline bool MetricValue::has_name() const {
+  return _internal_has_name();
+}
+inline void MetricValue::clear_name() {
+  if (GetArenaForAllocation() == nullptr && _impl_.name_ != nullptr) {
+    delete _impl_.name_;
+  }
+  _impl_.name_ = nullptr;
+}
+inline const ::tensorboard::hparams::MetricName& MetricValue::_internal_name() const {
+  const ::tensorboard::hparams::MetricName* p = _impl_.name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tensorboard::hparams::MetricName&>(
+      ::tensorboard::hparams::_MetricName_default_instance_);
+}
+inline const ::tensorboard::hparams::MetricName& MetricValue::name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricValue.name)
+  return _internal_name();
+}
+inline void MetricValue::unsafe_arena_set_allocated_name(
+    ::tensorboard::hparams::MetricName* name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.name_);
+  }
+  _impl_.name_ = name;
+  if (name) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.MetricValue.name)
+}
+inline ::tensorboard::hparams::MetricName* MetricValue::release_name() {
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* MetricValue::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.MetricValue.name)
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.name_;
+  _impl_.name_ = nullptr;
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* MetricValue::_internal_mutable_name() {
+  
+  if (_impl_.name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tensorboard::hparams::MetricName>(GetArenaForAllocation());
+    _impl_.name_ = p;
+  }
+  return _impl_.name_;
+}
+inline ::tensorboard::hparams::MetricName* MetricValue::mutable_name() {
+  ::tensorboard::hparams::MetricName* _msg = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.MetricValue.name)
+  return _msg;
+}
+inline void MetricValue::set_allocated_name(::tensorboard::hparams::MetricName* name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.name_;
+  }
+  if (name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(name);
+    if (message_arena != submessage_arena) {
+      name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, name, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.name_ = name;
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.MetricValue.name)
+}
+
+// double value = 2;
+inline void MetricValue::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double MetricValue::_internal_value() const {
+  return _impl_.value_;
+}
+inline double MetricValue::value() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricValue.value)
+  return _internal_value();
+}
+inline void MetricValue::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void MetricValue::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricValue.value)
+}
+
+// int32 training_step = 3;
+inline void MetricValue::clear_training_step() {
+  _impl_.training_step_ = 0;
+}
+inline int32_t MetricValue::_internal_training_step() const {
+  return _impl_.training_step_;
+}
+inline int32_t MetricValue::training_step() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricValue.training_step)
+  return _internal_training_step();
+}
+inline void MetricValue::_internal_set_training_step(int32_t value) {
+  
+  _impl_.training_step_ = value;
+}
+inline void MetricValue::set_training_step(int32_t value) {
+  _internal_set_training_step(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricValue.training_step)
+}
+
+// double wall_time_secs = 4;
+inline void MetricValue::clear_wall_time_secs() {
+  _impl_.wall_time_secs_ = 0;
+}
+inline double MetricValue::_internal_wall_time_secs() const {
+  return _impl_.wall_time_secs_;
+}
+inline double MetricValue::wall_time_secs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.MetricValue.wall_time_secs)
+  return _internal_wall_time_secs();
+}
+inline void MetricValue::_internal_set_wall_time_secs(double value) {
+  
+  _impl_.wall_time_secs_ = value;
+}
+inline void MetricValue::set_wall_time_secs(double value) {
+  _internal_set_wall_time_secs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.MetricValue.wall_time_secs)
+}
+
+// -------------------------------------------------------------------
+
+// Session
+
+// string name = 1;
+inline void Session::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Session::name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Session::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Session.name)
+}
+inline std::string* Session::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Session.name)
+  return _s;
+}
+inline const std::string& Session::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Session::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Session::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Session::release_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.Session.name)
+  return _impl_.name_.Release();
+}
+inline void Session::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.Session.name)
+}
+
+// double start_time_secs = 2;
+inline void Session::clear_start_time_secs() {
+  _impl_.start_time_secs_ = 0;
+}
+inline double Session::_internal_start_time_secs() const {
+  return _impl_.start_time_secs_;
+}
+inline double Session::start_time_secs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.start_time_secs)
+  return _internal_start_time_secs();
+}
+inline void Session::_internal_set_start_time_secs(double value) {
+  
+  _impl_.start_time_secs_ = value;
+}
+inline void Session::set_start_time_secs(double value) {
+  _internal_set_start_time_secs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Session.start_time_secs)
+}
+
+// double end_time_secs = 3;
+inline void Session::clear_end_time_secs() {
+  _impl_.end_time_secs_ = 0;
+}
+inline double Session::_internal_end_time_secs() const {
+  return _impl_.end_time_secs_;
+}
+inline double Session::end_time_secs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.end_time_secs)
+  return _internal_end_time_secs();
+}
+inline void Session::_internal_set_end_time_secs(double value) {
+  
+  _impl_.end_time_secs_ = value;
+}
+inline void Session::set_end_time_secs(double value) {
+  _internal_set_end_time_secs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Session.end_time_secs)
+}
+
+// .tensorboard.hparams.Status status = 4;
+inline void Session::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::tensorboard::hparams::Status Session::_internal_status() const {
+  return static_cast< ::tensorboard::hparams::Status >(_impl_.status_);
+}
+inline ::tensorboard::hparams::Status Session::status() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.status)
+  return _internal_status();
+}
+inline void Session::_internal_set_status(::tensorboard::hparams::Status value) {
+  
+  _impl_.status_ = value;
+}
+inline void Session::set_status(::tensorboard::hparams::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Session.status)
+}
+
+// string model_uri = 5;
+inline void Session::clear_model_uri() {
+  _impl_.model_uri_.ClearToEmpty();
+}
+inline const std::string& Session::model_uri() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.model_uri)
+  return _internal_model_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Session::set_model_uri(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.model_uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Session.model_uri)
+}
+inline std::string* Session::mutable_model_uri() {
+  std::string* _s = _internal_mutable_model_uri();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Session.model_uri)
+  return _s;
+}
+inline const std::string& Session::_internal_model_uri() const {
+  return _impl_.model_uri_.Get();
+}
+inline void Session::_internal_set_model_uri(const std::string& value) {
+  
+  _impl_.model_uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Session::_internal_mutable_model_uri() {
+  
+  return _impl_.model_uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Session::release_model_uri() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.Session.model_uri)
+  return _impl_.model_uri_.Release();
+}
+inline void Session::set_allocated_model_uri(std::string* model_uri) {
+  if (model_uri != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.model_uri_.SetAllocated(model_uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.model_uri_.IsDefault()) {
+    _impl_.model_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.Session.model_uri)
+}
+
+// repeated .tensorboard.hparams.MetricValue metric_values = 6;
+inline int Session::_internal_metric_values_size() const {
+  return _impl_.metric_values_.size();
+}
+inline int Session::metric_values_size() const {
+  return _internal_metric_values_size();
+}
+inline void Session::clear_metric_values() {
+  _impl_.metric_values_.Clear();
+}
+inline ::tensorboard::hparams::MetricValue* Session::mutable_metric_values(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Session.metric_values)
+  return _impl_.metric_values_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >*
+Session::mutable_metric_values() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.Session.metric_values)
+  return &_impl_.metric_values_;
+}
+inline const ::tensorboard::hparams::MetricValue& Session::_internal_metric_values(int index) const {
+  return _impl_.metric_values_.Get(index);
+}
+inline const ::tensorboard::hparams::MetricValue& Session::metric_values(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.metric_values)
+  return _internal_metric_values(index);
+}
+inline ::tensorboard::hparams::MetricValue* Session::_internal_add_metric_values() {
+  return _impl_.metric_values_.Add();
+}
+inline ::tensorboard::hparams::MetricValue* Session::add_metric_values() {
+  ::tensorboard::hparams::MetricValue* _add = _internal_add_metric_values();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.Session.metric_values)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::MetricValue >&
+Session::metric_values() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.Session.metric_values)
+  return _impl_.metric_values_;
+}
+
+// string monitor_url = 7;
+inline void Session::clear_monitor_url() {
+  _impl_.monitor_url_.ClearToEmpty();
+}
+inline const std::string& Session::monitor_url() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.Session.monitor_url)
+  return _internal_monitor_url();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Session::set_monitor_url(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.monitor_url_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.Session.monitor_url)
+}
+inline std::string* Session::mutable_monitor_url() {
+  std::string* _s = _internal_mutable_monitor_url();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.Session.monitor_url)
+  return _s;
+}
+inline const std::string& Session::_internal_monitor_url() const {
+  return _impl_.monitor_url_.Get();
+}
+inline void Session::_internal_set_monitor_url(const std::string& value) {
+  
+  _impl_.monitor_url_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Session::_internal_mutable_monitor_url() {
+  
+  return _impl_.monitor_url_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Session::release_monitor_url() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.Session.monitor_url)
+  return _impl_.monitor_url_.Release();
+}
+inline void Session::set_allocated_monitor_url(std::string* monitor_url) {
+  if (monitor_url != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.monitor_url_.SetAllocated(monitor_url, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.monitor_url_.IsDefault()) {
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.Session.monitor_url)
+}
+
+// -------------------------------------------------------------------
+
+// GetExperimentRequest
+
+// string experiment_name = 1;
+inline void GetExperimentRequest::clear_experiment_name() {
+  _impl_.experiment_name_.ClearToEmpty();
+}
+inline const std::string& GetExperimentRequest::experiment_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.GetExperimentRequest.experiment_name)
+  return _internal_experiment_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetExperimentRequest::set_experiment_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.experiment_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.GetExperimentRequest.experiment_name)
+}
+inline std::string* GetExperimentRequest::mutable_experiment_name() {
+  std::string* _s = _internal_mutable_experiment_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.GetExperimentRequest.experiment_name)
+  return _s;
+}
+inline const std::string& GetExperimentRequest::_internal_experiment_name() const {
+  return _impl_.experiment_name_.Get();
+}
+inline void GetExperimentRequest::_internal_set_experiment_name(const std::string& value) {
+  
+  _impl_.experiment_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetExperimentRequest::_internal_mutable_experiment_name() {
+  
+  return _impl_.experiment_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetExperimentRequest::release_experiment_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.GetExperimentRequest.experiment_name)
+  return _impl_.experiment_name_.Release();
+}
+inline void GetExperimentRequest::set_allocated_experiment_name(std::string* experiment_name) {
+  if (experiment_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.experiment_name_.SetAllocated(experiment_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.experiment_name_.IsDefault()) {
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.GetExperimentRequest.experiment_name)
+}
+
+// optional bool include_metrics = 2;
+inline bool GetExperimentRequest::_internal_has_include_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetExperimentRequest::has_include_metrics() const {
+  return _internal_has_include_metrics();
+}
+inline void GetExperimentRequest::clear_include_metrics() {
+  _impl_.include_metrics_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool GetExperimentRequest::_internal_include_metrics() const {
+  return _impl_.include_metrics_;
+}
+inline bool GetExperimentRequest::include_metrics() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.GetExperimentRequest.include_metrics)
+  return _internal_include_metrics();
+}
+inline void GetExperimentRequest::_internal_set_include_metrics(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.include_metrics_ = value;
+}
+inline void GetExperimentRequest::set_include_metrics(bool value) {
+  _internal_set_include_metrics(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.GetExperimentRequest.include_metrics)
+}
+
+// optional int32 hparams_limit = 3;
+inline bool GetExperimentRequest::_internal_has_hparams_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetExperimentRequest::has_hparams_limit() const {
+  return _internal_has_hparams_limit();
+}
+inline void GetExperimentRequest::clear_hparams_limit() {
+  _impl_.hparams_limit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t GetExperimentRequest::_internal_hparams_limit() const {
+  return _impl_.hparams_limit_;
+}
+inline int32_t GetExperimentRequest::hparams_limit() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.GetExperimentRequest.hparams_limit)
+  return _internal_hparams_limit();
+}
+inline void GetExperimentRequest::_internal_set_hparams_limit(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hparams_limit_ = value;
+}
+inline void GetExperimentRequest::set_hparams_limit(int32_t value) {
+  _internal_set_hparams_limit(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.GetExperimentRequest.hparams_limit)
+}
+
+// -------------------------------------------------------------------
+
+// ListSessionGroupsRequest
+
+// string experiment_name = 6;
+inline void ListSessionGroupsRequest::clear_experiment_name() {
+  _impl_.experiment_name_.ClearToEmpty();
+}
+inline const std::string& ListSessionGroupsRequest::experiment_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.experiment_name)
+  return _internal_experiment_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListSessionGroupsRequest::set_experiment_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.experiment_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsRequest.experiment_name)
+}
+inline std::string* ListSessionGroupsRequest::mutable_experiment_name() {
+  std::string* _s = _internal_mutable_experiment_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListSessionGroupsRequest.experiment_name)
+  return _s;
+}
+inline const std::string& ListSessionGroupsRequest::_internal_experiment_name() const {
+  return _impl_.experiment_name_.Get();
+}
+inline void ListSessionGroupsRequest::_internal_set_experiment_name(const std::string& value) {
+  
+  _impl_.experiment_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListSessionGroupsRequest::_internal_mutable_experiment_name() {
+  
+  return _impl_.experiment_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListSessionGroupsRequest::release_experiment_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ListSessionGroupsRequest.experiment_name)
+  return _impl_.experiment_name_.Release();
+}
+inline void ListSessionGroupsRequest::set_allocated_experiment_name(std::string* experiment_name) {
+  if (experiment_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.experiment_name_.SetAllocated(experiment_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.experiment_name_.IsDefault()) {
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ListSessionGroupsRequest.experiment_name)
+}
+
+// repeated .tensorboard.hparams.Status allowed_statuses = 7;
+inline int ListSessionGroupsRequest::_internal_allowed_statuses_size() const {
+  return _impl_.allowed_statuses_.size();
+}
+inline int ListSessionGroupsRequest::allowed_statuses_size() const {
+  return _internal_allowed_statuses_size();
+}
+inline void ListSessionGroupsRequest::clear_allowed_statuses() {
+  _impl_.allowed_statuses_.Clear();
+}
+inline ::tensorboard::hparams::Status ListSessionGroupsRequest::_internal_allowed_statuses(int index) const {
+  return static_cast< ::tensorboard::hparams::Status >(_impl_.allowed_statuses_.Get(index));
+}
+inline ::tensorboard::hparams::Status ListSessionGroupsRequest::allowed_statuses(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.allowed_statuses)
+  return _internal_allowed_statuses(index);
+}
+inline void ListSessionGroupsRequest::set_allowed_statuses(int index, ::tensorboard::hparams::Status value) {
+  _impl_.allowed_statuses_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsRequest.allowed_statuses)
+}
+inline void ListSessionGroupsRequest::_internal_add_allowed_statuses(::tensorboard::hparams::Status value) {
+  _impl_.allowed_statuses_.Add(value);
+}
+inline void ListSessionGroupsRequest::add_allowed_statuses(::tensorboard::hparams::Status value) {
+  _internal_add_allowed_statuses(value);
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.ListSessionGroupsRequest.allowed_statuses)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+ListSessionGroupsRequest::allowed_statuses() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.ListSessionGroupsRequest.allowed_statuses)
+  return _impl_.allowed_statuses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+ListSessionGroupsRequest::_internal_mutable_allowed_statuses() {
+  return &_impl_.allowed_statuses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+ListSessionGroupsRequest::mutable_allowed_statuses() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.ListSessionGroupsRequest.allowed_statuses)
+  return _internal_mutable_allowed_statuses();
+}
+
+// repeated .tensorboard.hparams.ColParams col_params = 1;
+inline int ListSessionGroupsRequest::_internal_col_params_size() const {
+  return _impl_.col_params_.size();
+}
+inline int ListSessionGroupsRequest::col_params_size() const {
+  return _internal_col_params_size();
+}
+inline void ListSessionGroupsRequest::clear_col_params() {
+  _impl_.col_params_.Clear();
+}
+inline ::tensorboard::hparams::ColParams* ListSessionGroupsRequest::mutable_col_params(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListSessionGroupsRequest.col_params)
+  return _impl_.col_params_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::ColParams >*
+ListSessionGroupsRequest::mutable_col_params() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.ListSessionGroupsRequest.col_params)
+  return &_impl_.col_params_;
+}
+inline const ::tensorboard::hparams::ColParams& ListSessionGroupsRequest::_internal_col_params(int index) const {
+  return _impl_.col_params_.Get(index);
+}
+inline const ::tensorboard::hparams::ColParams& ListSessionGroupsRequest::col_params(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.col_params)
+  return _internal_col_params(index);
+}
+inline ::tensorboard::hparams::ColParams* ListSessionGroupsRequest::_internal_add_col_params() {
+  return _impl_.col_params_.Add();
+}
+inline ::tensorboard::hparams::ColParams* ListSessionGroupsRequest::add_col_params() {
+  ::tensorboard::hparams::ColParams* _add = _internal_add_col_params();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.ListSessionGroupsRequest.col_params)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::ColParams >&
+ListSessionGroupsRequest::col_params() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.ListSessionGroupsRequest.col_params)
+  return _impl_.col_params_;
+}
+
+// .tensorboard.hparams.AggregationType aggregation_type = 2;
+inline void ListSessionGroupsRequest::clear_aggregation_type() {
+  _impl_.aggregation_type_ = 0;
+}
+inline ::tensorboard::hparams::AggregationType ListSessionGroupsRequest::_internal_aggregation_type() const {
+  return static_cast< ::tensorboard::hparams::AggregationType >(_impl_.aggregation_type_);
+}
+inline ::tensorboard::hparams::AggregationType ListSessionGroupsRequest::aggregation_type() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.aggregation_type)
+  return _internal_aggregation_type();
+}
+inline void ListSessionGroupsRequest::_internal_set_aggregation_type(::tensorboard::hparams::AggregationType value) {
+  
+  _impl_.aggregation_type_ = value;
+}
+inline void ListSessionGroupsRequest::set_aggregation_type(::tensorboard::hparams::AggregationType value) {
+  _internal_set_aggregation_type(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsRequest.aggregation_type)
+}
+
+// .tensorboard.hparams.MetricName aggregation_metric = 3;
+inline bool ListSessionGroupsRequest::_internal_has_aggregation_metric() const {
+  return this != internal_default_instance() && _impl_.aggregation_metric_ != nullptr;
+}
+inline bool ListSessionGroupsRequest::has_aggregation_metric() const {
+  return _internal_has_aggregation_metric();
+}
+inline void ListSessionGroupsRequest::clear_aggregation_metric() {
+  if (GetArenaForAllocation() == nullptr && _impl_.aggregation_metric_ != nullptr) {
+    delete _impl_.aggregation_metric_;
+  }
+  _impl_.aggregation_metric_ = nullptr;
+}
+inline const ::tensorboard::hparams::MetricName& ListSessionGroupsRequest::_internal_aggregation_metric() const {
+  const ::tensorboard::hparams::MetricName* p = _impl_.aggregation_metric_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tensorboard::hparams::MetricName&>(
+      ::tensorboard::hparams::_MetricName_default_instance_);
+}
+inline const ::tensorboard::hparams::MetricName& ListSessionGroupsRequest::aggregation_metric() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.aggregation_metric)
+  return _internal_aggregation_metric();
+}
+inline void ListSessionGroupsRequest::unsafe_arena_set_allocated_aggregation_metric(
+    ::tensorboard::hparams::MetricName* aggregation_metric) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.aggregation_metric_);
+  }
+  _impl_.aggregation_metric_ = aggregation_metric;
+  if (aggregation_metric) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.ListSessionGroupsRequest.aggregation_metric)
+}
+inline ::tensorboard::hparams::MetricName* ListSessionGroupsRequest::release_aggregation_metric() {
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.aggregation_metric_;
+  _impl_.aggregation_metric_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* ListSessionGroupsRequest::unsafe_arena_release_aggregation_metric() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ListSessionGroupsRequest.aggregation_metric)
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.aggregation_metric_;
+  _impl_.aggregation_metric_ = nullptr;
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* ListSessionGroupsRequest::_internal_mutable_aggregation_metric() {
+  
+  if (_impl_.aggregation_metric_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tensorboard::hparams::MetricName>(GetArenaForAllocation());
+    _impl_.aggregation_metric_ = p;
+  }
+  return _impl_.aggregation_metric_;
+}
+inline ::tensorboard::hparams::MetricName* ListSessionGroupsRequest::mutable_aggregation_metric() {
+  ::tensorboard::hparams::MetricName* _msg = _internal_mutable_aggregation_metric();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListSessionGroupsRequest.aggregation_metric)
+  return _msg;
+}
+inline void ListSessionGroupsRequest::set_allocated_aggregation_metric(::tensorboard::hparams::MetricName* aggregation_metric) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.aggregation_metric_;
+  }
+  if (aggregation_metric) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(aggregation_metric);
+    if (message_arena != submessage_arena) {
+      aggregation_metric = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, aggregation_metric, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.aggregation_metric_ = aggregation_metric;
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ListSessionGroupsRequest.aggregation_metric)
+}
+
+// int32 start_index = 4;
+inline void ListSessionGroupsRequest::clear_start_index() {
+  _impl_.start_index_ = 0;
+}
+inline int32_t ListSessionGroupsRequest::_internal_start_index() const {
+  return _impl_.start_index_;
+}
+inline int32_t ListSessionGroupsRequest::start_index() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.start_index)
+  return _internal_start_index();
+}
+inline void ListSessionGroupsRequest::_internal_set_start_index(int32_t value) {
+  
+  _impl_.start_index_ = value;
+}
+inline void ListSessionGroupsRequest::set_start_index(int32_t value) {
+  _internal_set_start_index(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsRequest.start_index)
+}
+
+// int32 slice_size = 5;
+inline void ListSessionGroupsRequest::clear_slice_size() {
+  _impl_.slice_size_ = 0;
+}
+inline int32_t ListSessionGroupsRequest::_internal_slice_size() const {
+  return _impl_.slice_size_;
+}
+inline int32_t ListSessionGroupsRequest::slice_size() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.slice_size)
+  return _internal_slice_size();
+}
+inline void ListSessionGroupsRequest::_internal_set_slice_size(int32_t value) {
+  
+  _impl_.slice_size_ = value;
+}
+inline void ListSessionGroupsRequest::set_slice_size(int32_t value) {
+  _internal_set_slice_size(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsRequest.slice_size)
+}
+
+// optional bool include_metrics = 8;
+inline bool ListSessionGroupsRequest::_internal_has_include_metrics() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ListSessionGroupsRequest::has_include_metrics() const {
+  return _internal_has_include_metrics();
+}
+inline void ListSessionGroupsRequest::clear_include_metrics() {
+  _impl_.include_metrics_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool ListSessionGroupsRequest::_internal_include_metrics() const {
+  return _impl_.include_metrics_;
+}
+inline bool ListSessionGroupsRequest::include_metrics() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsRequest.include_metrics)
+  return _internal_include_metrics();
+}
+inline void ListSessionGroupsRequest::_internal_set_include_metrics(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.include_metrics_ = value;
+}
+inline void ListSessionGroupsRequest::set_include_metrics(bool value) {
+  _internal_set_include_metrics(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsRequest.include_metrics)
+}
+
+// -------------------------------------------------------------------
+
+// ColParams
+
+// .tensorboard.hparams.MetricName metric = 1;
+inline bool ColParams::_internal_has_metric() const {
+  return name_case() == kMetric;
+}
+inline bool ColParams::has_metric() const {
+  return _internal_has_metric();
+}
+inline void ColParams::set_has_metric() {
+  _impl_._oneof_case_[0] = kMetric;
+}
+inline void ColParams::clear_metric() {
+  if (_internal_has_metric()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.name_.metric_;
+    }
+    clear_has_name();
+  }
+}
+inline ::tensorboard::hparams::MetricName* ColParams::release_metric() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ColParams.metric)
+  if (_internal_has_metric()) {
+    clear_has_name();
+    ::tensorboard::hparams::MetricName* temp = _impl_.name_.metric_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.name_.metric_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tensorboard::hparams::MetricName& ColParams::_internal_metric() const {
+  return _internal_has_metric()
+      ? *_impl_.name_.metric_
+      : reinterpret_cast< ::tensorboard::hparams::MetricName&>(::tensorboard::hparams::_MetricName_default_instance_);
+}
+inline const ::tensorboard::hparams::MetricName& ColParams::metric() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.metric)
+  return _internal_metric();
+}
+inline ::tensorboard::hparams::MetricName* ColParams::unsafe_arena_release_metric() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.ColParams.metric)
+  if (_internal_has_metric()) {
+    clear_has_name();
+    ::tensorboard::hparams::MetricName* temp = _impl_.name_.metric_;
+    _impl_.name_.metric_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ColParams::unsafe_arena_set_allocated_metric(::tensorboard::hparams::MetricName* metric) {
+  clear_name();
+  if (metric) {
+    set_has_metric();
+    _impl_.name_.metric_ = metric;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.ColParams.metric)
+}
+inline ::tensorboard::hparams::MetricName* ColParams::_internal_mutable_metric() {
+  if (!_internal_has_metric()) {
+    clear_name();
+    set_has_metric();
+    _impl_.name_.metric_ = CreateMaybeMessage< ::tensorboard::hparams::MetricName >(GetArenaForAllocation());
+  }
+  return _impl_.name_.metric_;
+}
+inline ::tensorboard::hparams::MetricName* ColParams::mutable_metric() {
+  ::tensorboard::hparams::MetricName* _msg = _internal_mutable_metric();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ColParams.metric)
+  return _msg;
+}
+
+// string hparam = 2;
+inline bool ColParams::_internal_has_hparam() const {
+  return name_case() == kHparam;
+}
+inline bool ColParams::has_hparam() const {
+  return _internal_has_hparam();
+}
+inline void ColParams::set_has_hparam() {
+  _impl_._oneof_case_[0] = kHparam;
+}
+inline void ColParams::clear_hparam() {
+  if (_internal_has_hparam()) {
+    _impl_.name_.hparam_.Destroy();
+    clear_has_name();
+  }
+}
+inline const std::string& ColParams::hparam() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.hparam)
+  return _internal_hparam();
+}
+template <typename ArgT0, typename... ArgT>
+inline void ColParams::set_hparam(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_hparam()) {
+    clear_name();
+    set_has_hparam();
+    _impl_.name_.hparam_.InitDefault();
+  }
+  _impl_.name_.hparam_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ColParams.hparam)
+}
+inline std::string* ColParams::mutable_hparam() {
+  std::string* _s = _internal_mutable_hparam();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ColParams.hparam)
+  return _s;
+}
+inline const std::string& ColParams::_internal_hparam() const {
+  if (_internal_has_hparam()) {
+    return _impl_.name_.hparam_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void ColParams::_internal_set_hparam(const std::string& value) {
+  if (!_internal_has_hparam()) {
+    clear_name();
+    set_has_hparam();
+    _impl_.name_.hparam_.InitDefault();
+  }
+  _impl_.name_.hparam_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ColParams::_internal_mutable_hparam() {
+  if (!_internal_has_hparam()) {
+    clear_name();
+    set_has_hparam();
+    _impl_.name_.hparam_.InitDefault();
+  }
+  return _impl_.name_.hparam_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* ColParams::release_hparam() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ColParams.hparam)
+  if (_internal_has_hparam()) {
+    clear_has_name();
+    return _impl_.name_.hparam_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void ColParams::set_allocated_hparam(std::string* hparam) {
+  if (has_name()) {
+    clear_name();
+  }
+  if (hparam != nullptr) {
+    set_has_hparam();
+    _impl_.name_.hparam_.InitAllocated(hparam, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ColParams.hparam)
+}
+
+// .tensorboard.hparams.SortOrder order = 3;
+inline void ColParams::clear_order() {
+  _impl_.order_ = 0;
+}
+inline ::tensorboard::hparams::SortOrder ColParams::_internal_order() const {
+  return static_cast< ::tensorboard::hparams::SortOrder >(_impl_.order_);
+}
+inline ::tensorboard::hparams::SortOrder ColParams::order() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.order)
+  return _internal_order();
+}
+inline void ColParams::_internal_set_order(::tensorboard::hparams::SortOrder value) {
+  
+  _impl_.order_ = value;
+}
+inline void ColParams::set_order(::tensorboard::hparams::SortOrder value) {
+  _internal_set_order(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ColParams.order)
+}
+
+// bool missing_values_first = 4;
+inline void ColParams::clear_missing_values_first() {
+  _impl_.missing_values_first_ = false;
+}
+inline bool ColParams::_internal_missing_values_first() const {
+  return _impl_.missing_values_first_;
+}
+inline bool ColParams::missing_values_first() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.missing_values_first)
+  return _internal_missing_values_first();
+}
+inline void ColParams::_internal_set_missing_values_first(bool value) {
+  
+  _impl_.missing_values_first_ = value;
+}
+inline void ColParams::set_missing_values_first(bool value) {
+  _internal_set_missing_values_first(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ColParams.missing_values_first)
+}
+
+// string filter_regexp = 5;
+inline bool ColParams::_internal_has_filter_regexp() const {
+  return filter_case() == kFilterRegexp;
+}
+inline bool ColParams::has_filter_regexp() const {
+  return _internal_has_filter_regexp();
+}
+inline void ColParams::set_has_filter_regexp() {
+  _impl_._oneof_case_[1] = kFilterRegexp;
+}
+inline void ColParams::clear_filter_regexp() {
+  if (_internal_has_filter_regexp()) {
+    _impl_.filter_.filter_regexp_.Destroy();
+    clear_has_filter();
+  }
+}
+inline const std::string& ColParams::filter_regexp() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.filter_regexp)
+  return _internal_filter_regexp();
+}
+template <typename ArgT0, typename... ArgT>
+inline void ColParams::set_filter_regexp(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_filter_regexp()) {
+    clear_filter();
+    set_has_filter_regexp();
+    _impl_.filter_.filter_regexp_.InitDefault();
+  }
+  _impl_.filter_.filter_regexp_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ColParams.filter_regexp)
+}
+inline std::string* ColParams::mutable_filter_regexp() {
+  std::string* _s = _internal_mutable_filter_regexp();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ColParams.filter_regexp)
+  return _s;
+}
+inline const std::string& ColParams::_internal_filter_regexp() const {
+  if (_internal_has_filter_regexp()) {
+    return _impl_.filter_.filter_regexp_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void ColParams::_internal_set_filter_regexp(const std::string& value) {
+  if (!_internal_has_filter_regexp()) {
+    clear_filter();
+    set_has_filter_regexp();
+    _impl_.filter_.filter_regexp_.InitDefault();
+  }
+  _impl_.filter_.filter_regexp_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ColParams::_internal_mutable_filter_regexp() {
+  if (!_internal_has_filter_regexp()) {
+    clear_filter();
+    set_has_filter_regexp();
+    _impl_.filter_.filter_regexp_.InitDefault();
+  }
+  return _impl_.filter_.filter_regexp_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* ColParams::release_filter_regexp() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ColParams.filter_regexp)
+  if (_internal_has_filter_regexp()) {
+    clear_has_filter();
+    return _impl_.filter_.filter_regexp_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void ColParams::set_allocated_filter_regexp(std::string* filter_regexp) {
+  if (has_filter()) {
+    clear_filter();
+  }
+  if (filter_regexp != nullptr) {
+    set_has_filter_regexp();
+    _impl_.filter_.filter_regexp_.InitAllocated(filter_regexp, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ColParams.filter_regexp)
+}
+
+// .tensorboard.hparams.Interval filter_interval = 6;
+inline bool ColParams::_internal_has_filter_interval() const {
+  return filter_case() == kFilterInterval;
+}
+inline bool ColParams::has_filter_interval() const {
+  return _internal_has_filter_interval();
+}
+inline void ColParams::set_has_filter_interval() {
+  _impl_._oneof_case_[1] = kFilterInterval;
+}
+inline void ColParams::clear_filter_interval() {
+  if (_internal_has_filter_interval()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.filter_.filter_interval_;
+    }
+    clear_has_filter();
+  }
+}
+inline ::tensorboard::hparams::Interval* ColParams::release_filter_interval() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ColParams.filter_interval)
+  if (_internal_has_filter_interval()) {
+    clear_has_filter();
+    ::tensorboard::hparams::Interval* temp = _impl_.filter_.filter_interval_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.filter_.filter_interval_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tensorboard::hparams::Interval& ColParams::_internal_filter_interval() const {
+  return _internal_has_filter_interval()
+      ? *_impl_.filter_.filter_interval_
+      : reinterpret_cast< ::tensorboard::hparams::Interval&>(::tensorboard::hparams::_Interval_default_instance_);
+}
+inline const ::tensorboard::hparams::Interval& ColParams::filter_interval() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.filter_interval)
+  return _internal_filter_interval();
+}
+inline ::tensorboard::hparams::Interval* ColParams::unsafe_arena_release_filter_interval() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.ColParams.filter_interval)
+  if (_internal_has_filter_interval()) {
+    clear_has_filter();
+    ::tensorboard::hparams::Interval* temp = _impl_.filter_.filter_interval_;
+    _impl_.filter_.filter_interval_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ColParams::unsafe_arena_set_allocated_filter_interval(::tensorboard::hparams::Interval* filter_interval) {
+  clear_filter();
+  if (filter_interval) {
+    set_has_filter_interval();
+    _impl_.filter_.filter_interval_ = filter_interval;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.ColParams.filter_interval)
+}
+inline ::tensorboard::hparams::Interval* ColParams::_internal_mutable_filter_interval() {
+  if (!_internal_has_filter_interval()) {
+    clear_filter();
+    set_has_filter_interval();
+    _impl_.filter_.filter_interval_ = CreateMaybeMessage< ::tensorboard::hparams::Interval >(GetArenaForAllocation());
+  }
+  return _impl_.filter_.filter_interval_;
+}
+inline ::tensorboard::hparams::Interval* ColParams::mutable_filter_interval() {
+  ::tensorboard::hparams::Interval* _msg = _internal_mutable_filter_interval();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ColParams.filter_interval)
+  return _msg;
+}
+
+// .google.protobuf.ListValue filter_discrete = 7;
+inline bool ColParams::_internal_has_filter_discrete() const {
+  return filter_case() == kFilterDiscrete;
+}
+inline bool ColParams::has_filter_discrete() const {
+  return _internal_has_filter_discrete();
+}
+inline void ColParams::set_has_filter_discrete() {
+  _impl_._oneof_case_[1] = kFilterDiscrete;
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* ColParams::release_filter_discrete() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ColParams.filter_discrete)
+  if (_internal_has_filter_discrete()) {
+    clear_has_filter();
+    ::PROTOBUF_NAMESPACE_ID::ListValue* temp = _impl_.filter_.filter_discrete_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.filter_.filter_discrete_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::PROTOBUF_NAMESPACE_ID::ListValue& ColParams::_internal_filter_discrete() const {
+  return _internal_has_filter_discrete()
+      ? *_impl_.filter_.filter_discrete_
+      : reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::ListValue&>(::PROTOBUF_NAMESPACE_ID::_ListValue_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::ListValue& ColParams::filter_discrete() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.filter_discrete)
+  return _internal_filter_discrete();
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* ColParams::unsafe_arena_release_filter_discrete() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.ColParams.filter_discrete)
+  if (_internal_has_filter_discrete()) {
+    clear_has_filter();
+    ::PROTOBUF_NAMESPACE_ID::ListValue* temp = _impl_.filter_.filter_discrete_;
+    _impl_.filter_.filter_discrete_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ColParams::unsafe_arena_set_allocated_filter_discrete(::PROTOBUF_NAMESPACE_ID::ListValue* filter_discrete) {
+  clear_filter();
+  if (filter_discrete) {
+    set_has_filter_discrete();
+    _impl_.filter_.filter_discrete_ = filter_discrete;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.ColParams.filter_discrete)
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* ColParams::_internal_mutable_filter_discrete() {
+  if (!_internal_has_filter_discrete()) {
+    clear_filter();
+    set_has_filter_discrete();
+    _impl_.filter_.filter_discrete_ = CreateMaybeMessage< ::PROTOBUF_NAMESPACE_ID::ListValue >(GetArenaForAllocation());
+  }
+  return _impl_.filter_.filter_discrete_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::ListValue* ColParams::mutable_filter_discrete() {
+  ::PROTOBUF_NAMESPACE_ID::ListValue* _msg = _internal_mutable_filter_discrete();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ColParams.filter_discrete)
+  return _msg;
+}
+
+// bool exclude_missing_values = 8;
+inline void ColParams::clear_exclude_missing_values() {
+  _impl_.exclude_missing_values_ = false;
+}
+inline bool ColParams::_internal_exclude_missing_values() const {
+  return _impl_.exclude_missing_values_;
+}
+inline bool ColParams::exclude_missing_values() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.exclude_missing_values)
+  return _internal_exclude_missing_values();
+}
+inline void ColParams::_internal_set_exclude_missing_values(bool value) {
+  
+  _impl_.exclude_missing_values_ = value;
+}
+inline void ColParams::set_exclude_missing_values(bool value) {
+  _internal_set_exclude_missing_values(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ColParams.exclude_missing_values)
+}
+
+// optional bool include_in_result = 9;
+inline bool ColParams::_internal_has_include_in_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ColParams::has_include_in_result() const {
+  return _internal_has_include_in_result();
+}
+inline void ColParams::clear_include_in_result() {
+  _impl_.include_in_result_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool ColParams::_internal_include_in_result() const {
+  return _impl_.include_in_result_;
+}
+inline bool ColParams::include_in_result() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ColParams.include_in_result)
+  return _internal_include_in_result();
+}
+inline void ColParams::_internal_set_include_in_result(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.include_in_result_ = value;
+}
+inline void ColParams::set_include_in_result(bool value) {
+  _internal_set_include_in_result(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ColParams.include_in_result)
+}
+
+inline bool ColParams::has_name() const {
+  return name_case() != NAME_NOT_SET;
+}
+inline void ColParams::clear_has_name() {
+  _impl_._oneof_case_[0] = NAME_NOT_SET;
+}
+inline bool ColParams::has_filter() const {
+  return filter_case() != FILTER_NOT_SET;
+}
+inline void ColParams::clear_has_filter() {
+  _impl_._oneof_case_[1] = FILTER_NOT_SET;
+}
+inline ColParams::NameCase ColParams::name_case() const {
+  return ColParams::NameCase(_impl_._oneof_case_[0]);
+}
+inline ColParams::FilterCase ColParams::filter_case() const {
+  return ColParams::FilterCase(_impl_._oneof_case_[1]);
+}
+// -------------------------------------------------------------------
+
+// ListSessionGroupsResponse
+
+// repeated .tensorboard.hparams.SessionGroup session_groups = 1;
+inline int ListSessionGroupsResponse::_internal_session_groups_size() const {
+  return _impl_.session_groups_.size();
+}
+inline int ListSessionGroupsResponse::session_groups_size() const {
+  return _internal_session_groups_size();
+}
+inline void ListSessionGroupsResponse::clear_session_groups() {
+  _impl_.session_groups_.Clear();
+}
+inline ::tensorboard::hparams::SessionGroup* ListSessionGroupsResponse::mutable_session_groups(int index) {
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListSessionGroupsResponse.session_groups)
+  return _impl_.session_groups_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::SessionGroup >*
+ListSessionGroupsResponse::mutable_session_groups() {
+  // @@protoc_insertion_point(field_mutable_list:tensorboard.hparams.ListSessionGroupsResponse.session_groups)
+  return &_impl_.session_groups_;
+}
+inline const ::tensorboard::hparams::SessionGroup& ListSessionGroupsResponse::_internal_session_groups(int index) const {
+  return _impl_.session_groups_.Get(index);
+}
+inline const ::tensorboard::hparams::SessionGroup& ListSessionGroupsResponse::session_groups(int index) const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsResponse.session_groups)
+  return _internal_session_groups(index);
+}
+inline ::tensorboard::hparams::SessionGroup* ListSessionGroupsResponse::_internal_add_session_groups() {
+  return _impl_.session_groups_.Add();
+}
+inline ::tensorboard::hparams::SessionGroup* ListSessionGroupsResponse::add_session_groups() {
+  ::tensorboard::hparams::SessionGroup* _add = _internal_add_session_groups();
+  // @@protoc_insertion_point(field_add:tensorboard.hparams.ListSessionGroupsResponse.session_groups)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tensorboard::hparams::SessionGroup >&
+ListSessionGroupsResponse::session_groups() const {
+  // @@protoc_insertion_point(field_list:tensorboard.hparams.ListSessionGroupsResponse.session_groups)
+  return _impl_.session_groups_;
+}
+
+// int32 total_size = 3;
+inline void ListSessionGroupsResponse::clear_total_size() {
+  _impl_.total_size_ = 0;
+}
+inline int32_t ListSessionGroupsResponse::_internal_total_size() const {
+  return _impl_.total_size_;
+}
+inline int32_t ListSessionGroupsResponse::total_size() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListSessionGroupsResponse.total_size)
+  return _internal_total_size();
+}
+inline void ListSessionGroupsResponse::_internal_set_total_size(int32_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void ListSessionGroupsResponse::set_total_size(int32_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListSessionGroupsResponse.total_size)
+}
+
+// -------------------------------------------------------------------
+
+// ListMetricEvalsRequest
+
+// string experiment_name = 3;
+inline void ListMetricEvalsRequest::clear_experiment_name() {
+  _impl_.experiment_name_.ClearToEmpty();
+}
+inline const std::string& ListMetricEvalsRequest::experiment_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListMetricEvalsRequest.experiment_name)
+  return _internal_experiment_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListMetricEvalsRequest::set_experiment_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.experiment_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListMetricEvalsRequest.experiment_name)
+}
+inline std::string* ListMetricEvalsRequest::mutable_experiment_name() {
+  std::string* _s = _internal_mutable_experiment_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListMetricEvalsRequest.experiment_name)
+  return _s;
+}
+inline const std::string& ListMetricEvalsRequest::_internal_experiment_name() const {
+  return _impl_.experiment_name_.Get();
+}
+inline void ListMetricEvalsRequest::_internal_set_experiment_name(const std::string& value) {
+  
+  _impl_.experiment_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListMetricEvalsRequest::_internal_mutable_experiment_name() {
+  
+  return _impl_.experiment_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListMetricEvalsRequest::release_experiment_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ListMetricEvalsRequest.experiment_name)
+  return _impl_.experiment_name_.Release();
+}
+inline void ListMetricEvalsRequest::set_allocated_experiment_name(std::string* experiment_name) {
+  if (experiment_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.experiment_name_.SetAllocated(experiment_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.experiment_name_.IsDefault()) {
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ListMetricEvalsRequest.experiment_name)
+}
+
+// string session_name = 1;
+inline void ListMetricEvalsRequest::clear_session_name() {
+  _impl_.session_name_.ClearToEmpty();
+}
+inline const std::string& ListMetricEvalsRequest::session_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListMetricEvalsRequest.session_name)
+  return _internal_session_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListMetricEvalsRequest::set_session_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.ListMetricEvalsRequest.session_name)
+}
+inline std::string* ListMetricEvalsRequest::mutable_session_name() {
+  std::string* _s = _internal_mutable_session_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListMetricEvalsRequest.session_name)
+  return _s;
+}
+inline const std::string& ListMetricEvalsRequest::_internal_session_name() const {
+  return _impl_.session_name_.Get();
+}
+inline void ListMetricEvalsRequest::_internal_set_session_name(const std::string& value) {
+  
+  _impl_.session_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListMetricEvalsRequest::_internal_mutable_session_name() {
+  
+  return _impl_.session_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListMetricEvalsRequest::release_session_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ListMetricEvalsRequest.session_name)
+  return _impl_.session_name_.Release();
+}
+inline void ListMetricEvalsRequest::set_allocated_session_name(std::string* session_name) {
+  if (session_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_name_.SetAllocated(session_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_name_.IsDefault()) {
+    _impl_.session_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ListMetricEvalsRequest.session_name)
+}
+
+// .tensorboard.hparams.MetricName metric_name = 2;
+inline bool ListMetricEvalsRequest::_internal_has_metric_name() const {
+  return this != internal_default_instance() && _impl_.metric_name_ != nullptr;
+}
+inline bool ListMetricEvalsRequest::has_metric_name() const {
+  return _internal_has_metric_name();
+}
+inline void ListMetricEvalsRequest::clear_metric_name() {
+  if (GetArenaForAllocation() == nullptr && _impl_.metric_name_ != nullptr) {
+    delete _impl_.metric_name_;
+  }
+  _impl_.metric_name_ = nullptr;
+}
+inline const ::tensorboard::hparams::MetricName& ListMetricEvalsRequest::_internal_metric_name() const {
+  const ::tensorboard::hparams::MetricName* p = _impl_.metric_name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tensorboard::hparams::MetricName&>(
+      ::tensorboard::hparams::_MetricName_default_instance_);
+}
+inline const ::tensorboard::hparams::MetricName& ListMetricEvalsRequest::metric_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.ListMetricEvalsRequest.metric_name)
+  return _internal_metric_name();
+}
+inline void ListMetricEvalsRequest::unsafe_arena_set_allocated_metric_name(
+    ::tensorboard::hparams::MetricName* metric_name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.metric_name_);
+  }
+  _impl_.metric_name_ = metric_name;
+  if (metric_name) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.ListMetricEvalsRequest.metric_name)
+}
+inline ::tensorboard::hparams::MetricName* ListMetricEvalsRequest::release_metric_name() {
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.metric_name_;
+  _impl_.metric_name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* ListMetricEvalsRequest::unsafe_arena_release_metric_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.ListMetricEvalsRequest.metric_name)
+  
+  ::tensorboard::hparams::MetricName* temp = _impl_.metric_name_;
+  _impl_.metric_name_ = nullptr;
+  return temp;
+}
+inline ::tensorboard::hparams::MetricName* ListMetricEvalsRequest::_internal_mutable_metric_name() {
+  
+  if (_impl_.metric_name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tensorboard::hparams::MetricName>(GetArenaForAllocation());
+    _impl_.metric_name_ = p;
+  }
+  return _impl_.metric_name_;
+}
+inline ::tensorboard::hparams::MetricName* ListMetricEvalsRequest::mutable_metric_name() {
+  ::tensorboard::hparams::MetricName* _msg = _internal_mutable_metric_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.ListMetricEvalsRequest.metric_name)
+  return _msg;
+}
+inline void ListMetricEvalsRequest::set_allocated_metric_name(::tensorboard::hparams::MetricName* metric_name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.metric_name_;
+  }
+  if (metric_name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(metric_name);
+    if (message_arena != submessage_arena) {
+      metric_name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, metric_name, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.metric_name_ = metric_name;
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ListMetricEvalsRequest.metric_name)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace hparams
+}  // namespace tensorboard
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::tensorboard::hparams::DataType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tensorboard::hparams::DataType>() {
+  return ::tensorboard::hparams::DataType_descriptor();
+}
+template <> struct is_proto_enum< ::tensorboard::hparams::DatasetType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tensorboard::hparams::DatasetType>() {
+  return ::tensorboard::hparams::DatasetType_descriptor();
+}
+template <> struct is_proto_enum< ::tensorboard::hparams::Status> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tensorboard::hparams::Status>() {
+  return ::tensorboard::hparams::Status_descriptor();
+}
+template <> struct is_proto_enum< ::tensorboard::hparams::SortOrder> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tensorboard::hparams::SortOrder>() {
+  return ::tensorboard::hparams::SortOrder_descriptor();
+}
+template <> struct is_proto_enum< ::tensorboard::hparams::AggregationType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::tensorboard::hparams::AggregationType>() {
+  return ::tensorboard::hparams::AggregationType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_api_2eproto
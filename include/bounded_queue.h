@@ -0,0 +1,108 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+// Bounded lock-free multi-producer multi-consumer FIFO (Dmitry Vyukov's
+// array-based queue). Each cell carries a sequence number that tells producers
+// and consumers whether it is free for the current lap, so both sides only
+// need one CAS on their own cursor per operation.
+//
+// The logger uses it with many producers and a single writer thread; the
+// multi-consumer side lets producers evict the oldest entry when the queue is
+// full.
+template <typename T>
+class BoundedQueue {
+   public:
+    // `capacity` is rounded up to a power of two (at least 2).
+    explicit BoundedQueue(size_t capacity) {
+        size_t n = 2;
+        while (n < capacity) n <<= 1;
+        mask_ = n - 1;
+        cells_.reset(new Cell[n]);
+        for (size_t i = 0; i < n; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue &) = delete;
+    BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // Returns false, leaving `value` untouched, if the queue is full.
+    bool try_push(T &&value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell *cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff =
+                static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Returns false if the queue is empty.
+    bool try_pop(T &value) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell *cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff =
+                static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate, for monitoring only.
+    size_t size_approx() const {
+        size_t tail = dequeue_pos_.load(std::memory_order_relaxed);
+        size_t head = enqueue_pos_.load(std::memory_order_relaxed);
+        return head > tail ? head - tail : 0;
+    }
+
+   private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    // Keep the two cursors on separate cache lines, producers and the
+    // consumer would otherwise keep stealing it from each other.
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+};
+
+#endif  // BOUNDED_QUEUE_H
@@ -5,8 +5,29 @@
 #ifndef CRC__H
 #define CRC__H
 
+#include <cstddef>
+#include <cstdint>
+
 int crc32file(char *name, uint32_t *crc, long *charcnt);
 uint32_t crc32buf(const char *buf, size_t len);
 uint32_t masked_crc32c(const char *buf, size_t len);
+/* The masked form of a CRC32C computed with crc32c_extend, as stored in
+** event files. */
+uint32_t mask_crc32c(uint32_t crc);
+
+/* CRC32C of `buf`, continuing from the CRC32C `crc` of the preceding data
+** (pass 0 to start), so that checksums can be computed incrementally.
+** Dispatches to the fastest implementation supported by the CPU. */
+uint32_t crc32c_extend(uint32_t crc, const char *buf, size_t len);
+
+typedef uint32_t (*crc32c_fn)(uint32_t crc, const char *buf, size_t len);
+
+/* Name of the implementation used by crc32c_extend: "sse4.2+pclmul",
+** "sse4.2" or "portable". */
+const char *crc32c_implementation();
+
+/* The implementation called `name`, with the crc32c_extend signature, or
+** nullptr if it is unknown or unsupported on this CPU. */
+crc32c_fn crc32c_lookup(const char *name);
 
 #endif /* CRC__H */
@@ -0,0 +1,135 @@
+#ifndef EMBEDDING_WRITER_H
+#define EMBEDDING_WRITER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sink.h"
+
+class TensorBoardLogger;
+
+struct EmbeddingWriterOptions {
+    // Write the tensor file through a shared memory mapping grown as rows
+    // come in, instead of write(2) from a buffer. POSIX only, elsewhere the
+    // option is ignored.
+    bool mmap_ = false;
+    EmbeddingWriterOptions &mmap(bool mmap) {
+        mmap_ = mmap;
+        return *this;
+    }
+
+    // Hand full buffers of rows to a thread that writes them, so that
+    // append_rows() only copies. Ignored with mmap_.
+    bool background_ = false;
+    EmbeddingWriterOptions &background(bool background) {
+        background_ = background;
+        return *this;
+    }
+
+    // Size of the row and metadata buffers; with background_, up to three
+    // row buffers are alive at a time.
+    size_t buffer_bytes_ = 4 << 20;
+    EmbeddingWriterOptions &buffer_bytes(size_t buffer_bytes) {
+        buffer_bytes_ = buffer_bytes;
+        return *this;
+    }
+};
+
+// Writes an embedding to the log directory row by row, for embeddings too
+// large to hold in memory at once:
+//
+//   EmbeddingWriter writer(logger, "words", 256, "words.bin", "words.tsv");
+//   for (...) writer.append_rows(block, num_rows, labels);
+//   writer.close();
+//
+// The rows are stored as raw floats, like the tensor overloads of
+// TensorBoardLogger::add_embedding(), and close() adds the embedding to the
+// projector config with its final shape. Not thread safe; throws
+// std::runtime_error on I/O failures and std::invalid_argument on misuse.
+class EmbeddingWriter {
+   public:
+    // With an empty `metadata_filename`, rows have no metadata.
+    EmbeddingWriter(TensorBoardLogger &logger, const std::string &tensor_name,
+                    size_t dim, const std::string &tensordata_filename,
+                    const std::string &metadata_filename = "",
+                    const EmbeddingWriterOptions &options = {});
+    // Closes the writer if close() was not called, reporting errors on
+    // stderr.
+    ~EmbeddingWriter();
+    EmbeddingWriter(const EmbeddingWriter &) = delete;
+    EmbeddingWriter &operator=(const EmbeddingWriter &) = delete;
+
+    // Appends `num_rows` rows of dim() floats, stored contiguously, and with
+    // a metadata file one label per row.
+    void append_rows(const float *rows, size_t num_rows,
+                     const std::string *metadata = nullptr);
+    void append_rows(const float *rows, size_t num_rows,
+                     const std::vector<std::string> &metadata) {
+        if (metadata.size() != num_rows) {
+            throw std::invalid_argument("tensor size != metadata size");
+        }
+        append_rows(rows, num_rows, metadata.data());
+    }
+    void append_row(const std::vector<float> &row,
+                    const std::string *metadata = nullptr) {
+        if (row.size() != dim_) {
+            throw std::invalid_argument("row size != embedding dim");
+        }
+        append_rows(row.data(), 1, metadata);
+    }
+
+    // Writes out the files and adds the embedding to the projector config.
+    // Further calls do nothing.
+    void close();
+
+    size_t dim() const { return dim_; }
+    size_t num_rows() const { return num_rows_; }
+
+   private:
+    void write_tensor(const char *data, size_t size);
+    void grow_mapping(size_t size);
+    void hand_over_buffer();
+    void background_writer();
+    void check_background_error();
+
+    TensorBoardLogger &logger_;
+    std::string tensor_name_;
+    size_t dim_;
+    std::string tensordata_filename_;
+    std::string metadata_filename_;
+    std::string tensordata_path_;
+    EmbeddingWriterOptions options_;
+    size_t num_rows_ = 0;
+    bool closed_ = false;
+
+    std::unique_ptr<Sink> tensor_sink_;
+    std::unique_ptr<Sink> metadata_sink_;
+
+    // mmap_
+    int fd_ = -1;
+    char *mapping_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    size_t used_bytes_ = 0;
+
+    // background_: full buffers queue up for the writer thread, which hands
+    // them back once written
+    std::string buffer_;
+    std::thread writer_thread_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<std::string> full_buffers_;
+    std::vector<std::string> free_buffers_;
+    bool stop_ = false;
+    std::exception_ptr background_error_;
+};
+
+#endif  // EMBEDDING_WRITER_H
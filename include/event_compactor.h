@@ -0,0 +1,89 @@
+#ifndef EVENT_COMPACTOR_H
+#define EVENT_COMPACTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TensorBoardLogger;
+
+struct CompactOptions {
+    // Keep at most this many points of each scalar and histogram tag, spread
+    // evenly over its steps, the first and the last included. 0 keeps them
+    // all.
+    size_t max_points_ = 0;
+    CompactOptions &max_points(size_t max_points) {
+        max_points_ = max_points;
+        return *this;
+    }
+
+    // Threads indexing the input files and re-encoding events, 0 means one
+    // per hardware thread.
+    size_t num_threads_ = 0;
+    CompactOptions &num_threads(size_t num_threads) {
+        num_threads_ = num_threads;
+        return *this;
+    }
+
+    // About how much memory the index of the values may take. Beyond it,
+    // sorted runs of the index spill to a temporary file and are merged
+    // back from it.
+    size_t memory_bytes_ = size_t(256) << 20;
+    CompactOptions &memory_bytes(size_t memory_bytes) {
+        memory_bytes_ = memory_bytes;
+        return *this;
+    }
+
+    // Directory of the temporary file, empty for where std::tmpfile() puts
+    // it. Only honored on POSIX systems.
+    std::string temp_dir_;
+    CompactOptions &temp_dir(const std::string &temp_dir) {
+        temp_dir_ = temp_dir;
+        return *this;
+    }
+};
+
+struct CompactStats {
+    uint64_t records_read = 0;
+    uint64_t values_read = 0;
+    // values superseded by a later one of the same tag and step
+    uint64_t duplicates = 0;
+    // values dropped to keep CompactOptions::max_points_ per tag
+    uint64_t decimated = 0;
+    uint64_t records_written = 0;
+    // written records that lost values, re-encoded rather than copied
+    uint64_t records_rewritten = 0;
+    // One per input that ends in a corrupted or truncated record, the
+    // records before it are kept.
+    std::vector<std::string> errors;
+};
+
+// Merges event files, e.g. those left by the ranks and restarts of a run,
+// into one written through `logger`:
+//
+//   TensorBoardLogger logger("run/compacted.tfevents.pb");
+//   compact_event_files({"run/a.tfevents.pb", "run/b.tfevents.pb"}, logger);
+//
+// Events are written in step order. Of the summary values sharing a tag and
+// a step, only the latest is kept: by wall time, then by position in
+// `inputs` and in the file. Events left without values are dropped, and
+// file_version events give way to the logger's own. Events keeping all their
+// values are copied as they are, the others are re-encoded; if the value
+// carrying the plugin metadata of a tag is dropped, the metadata moves to the
+// first value of the tag written.
+//
+// The inputs are memory-mapped and indexed in parallel from the raw records,
+// without parsing them. The index keeps 48 bytes per value and is sorted
+// externally: up to CompactOptions::memory_bytes_ of it stays in memory, the
+// rest goes to a temporary file in sorted runs, merged 64 at a time. What
+// remains in memory grows with the number of tags, not of values: their
+// names and a few dozen bytes each. Payloads are read from the mappings as
+// they are written. Throws std::runtime_error if an input cannot be opened
+// or the temporary file cannot be written. A value with a NaN wall time
+// counts as the earliest of its tag and step.
+CompactStats compact_event_files(
+    const std::vector<std::string> &inputs, TensorBoardLogger &logger,
+    const CompactOptions &options = CompactOptions());
+
+#endif  // EVENT_COMPACTOR_H
@@ -0,0 +1,135 @@
+#ifndef EVENT_READER_H
+#define EVENT_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "event.pb.h"
+
+// Sequential reader of an event file, e.g. one written by TensorBoardLogger:
+//
+//   TensorBoardEventReader reader("./demo/tfevents.pb");
+//   reader.filter_tags({"loss"});
+//   while (reader.next()) use(reader.step(), reader.event());
+//   if (!reader.ok()) std::cerr << reader.error() << std::endl;
+//
+// The file is memory-mapped and records are handed out in place, without
+// copying. Records are checked against their masked CRC32Cs, and the filters
+// look at the raw records: the Event is only parsed when event() is called.
+class TensorBoardEventReader {
+   public:
+    // Throws std::runtime_error if the file cannot be opened or mapped.
+    explicit TensorBoardEventReader(const std::string &filename);
+    ~TensorBoardEventReader();
+
+    TensorBoardEventReader(const TensorBoardEventReader &) = delete;
+    TensorBoardEventReader &operator=(const TensorBoardEventReader &) = delete;
+
+    // Only stop at events with a summary value tagged with one of `tags`, an
+    // empty list disables the filter. The tags are matched in the raw record
+    // with a linear search, so this is meant for a handful of tags.
+    TensorBoardEventReader &filter_tags(const std::vector<std::string> &tags) {
+        tags_ = tags;
+        return *this;
+    }
+
+    // Only stop at events whose step is in [min_step, max_step].
+    TensorBoardEventReader &filter_steps(
+        int64_t min_step,
+        int64_t max_step = std::numeric_limits<int64_t>::max()) {
+        min_step_ = min_step;
+        max_step_ = max_step;
+        return *this;
+    }
+
+    // Whether to check the data CRC of the records next() stops at, on by
+    // default. Length CRCs are always checked, since a bad length would
+    // derail the iteration.
+    TensorBoardEventReader &verify_crc(bool verify_crc) {
+        verify_crc_ = verify_crc;
+        return *this;
+    }
+
+    // Move to the next record that passes the filters. Returns false at the
+    // end of the file, or at a corrupted or truncated record, in which case
+    // ok() is false and error() tells what went wrong.
+    bool next();
+
+    // Go back to the start of the file, or to the record at `offset`, which
+    // must be the offset() of a record seen before.
+    void seek(uint64_t offset = 0);
+
+    // Move to the first record at or after `offset` whose length and data
+    // CRCs are valid, e.g. to pick up the record boundaries at an arbitrary
+    // point of the file. Returns false if there is none.
+    bool sync(uint64_t offset);
+
+    // The current record, valid after next() returned true: the serialized
+    // Event, its offset in the file, and its step read from the raw record.
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+    uint64_t offset() const { return offset_; }
+    int64_t step() const { return step_; }
+
+    // The wall time of the current record, and whether it holds a
+    // file_version event, read from the raw record.
+    double wall_time() const { return wall_time_; }
+    bool has_file_version() const { return file_version_; }
+
+    // The tags of the summary values of the current record, read from the
+    // raw record.
+    std::vector<std::string> tags() const;
+
+    // A summary value of the current record, read from the raw record. The
+    // strings point into the file and are not null-terminated.
+    struct RawValue {
+        const char *tag = nullptr;
+        size_t tag_size = 0;
+        // the field number of the value in Summary.Value, e.g. 2 for
+        // simple_value or 5 for histo, 0 if it has none
+        uint32_t kind = 0;
+        bool has_metadata = false;
+        const char *plugin_name = nullptr;  // of the metadata
+        size_t plugin_name_size = 0;
+    };
+    std::vector<RawValue> values() const;
+
+    // The current record parsed as an Event, on first use.
+    const tensorflow::Event &event();
+
+    // Offset just past the last record read, i.e. the size of the valid part
+    // of the file once next() returned false.
+    uint64_t end_offset() const { return pos_; }
+    uint64_t file_size() const { return file_size_; }
+
+    bool ok() const { return error_.empty(); }
+    const std::string &error() const { return error_; }
+
+   private:
+    std::string filename_;
+    const char *file_data_ = nullptr;
+    uint64_t file_size_ = 0;
+    bool mapped_ = false;
+    std::string buffer_;  // file contents where mmap is not available
+
+    std::vector<std::string> tags_;
+    int64_t min_step_ = std::numeric_limits<int64_t>::min();
+    int64_t max_step_ = std::numeric_limits<int64_t>::max();
+    bool verify_crc_ = true;
+
+    uint64_t pos_ = 0;
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    uint64_t offset_ = 0;
+    int64_t step_ = 0;
+    double wall_time_ = 0;
+    bool file_version_ = false;
+    bool parsed_ = false;
+    tensorflow::Event event_;
+    std::string error_;
+};
+
+#endif  // EVENT_READER_H
@@ -0,0 +1,377 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "summary.pb.h"
+
+// IEEE half precision and bfloat16 values, as training frameworks store them
+// in 16-bit buffers: reinterpret such a buffer as a Float16 or BFloat16
+// array to log it without converting it first.
+struct Float16 {
+    uint16_t bits;
+};
+struct BFloat16 {
+    uint16_t bits;
+};
+
+float to_float(Float16 value);
+inline float to_float(BFloat16 value) {
+    uint32_t bits = static_cast<uint32_t>(value.bits) << 16;
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+// Widens `num` values into `out`, with F16C for Float16 and SSE2 for
+// BFloat16 when available.
+void to_float(const Float16 *values, size_t num, float *out);
+void to_float(const BFloat16 *values, size_t num, float *out);
+
+// Name of the Float16 conversion used: "f16c" or "portable".
+const char *float16_implementation();
+
+// `num` values read in place, `stride` elements apart, e.g. a column of a
+// row-major matrix or one head of an attention tensor. With a `mask`, value
+// i only counts if mask[i] is nonzero.
+template <typename T>
+struct HistogramView {
+    HistogramView(const T *values, size_t num, size_t stride = 1,
+                  const uint8_t *mask = nullptr)
+        : values(values), num(num), stride(stride), mask(mask) {}
+
+    const T *values;
+    size_t num;
+    size_t stride;
+    const uint8_t *mask;
+};
+
+// The default TensorBoard histogram buckets: geometric limits growing by 1.1
+// from 1e-12 to 1e20, mirrored for negative values, plus the lowest and
+// largest doubles at both ends.
+// https://github.com/dmlc/tensorboard/blob/master/python/tensorboard/summary.py#L115
+//
+// The table is immutable and built once per process; get() is thread safe.
+class DefaultHistogramBuckets {
+   public:
+    static const DefaultHistogramBuckets &get();
+
+    const std::vector<double> &limits() const { return limits_; }
+    size_t size() const { return limits_.size(); }
+
+    // Index of the bucket `x` falls in, i.e. of the first limit >= x, which
+    // is what std::lower_bound over limits() returns. Values above the last
+    // limit (+inf) go to the last bucket, NaN goes to the first one.
+    size_t index(double x) const {
+        uint64_t bits;
+        memcpy(&bits, &x, sizeof(bits));
+        uint64_t sign = bits >> 63;
+        bits &= ~(static_cast<uint64_t>(1) << 63);
+        int exponent = static_cast<int>(bits >> 52);
+        if (exponent > max_exponent_) return huge_index(x);
+
+        // j: first positive limit >= |x|
+        double a;
+        memcpy(&a, &bits, sizeof(a));
+        size_t j = 0;
+        if (exponent >= min_exponent_) {
+            size_t key = (static_cast<size_t>(exponent - min_exponent_)
+                          << kMantissaBits) |
+                         static_cast<size_t>((bits >> (52 - kMantissaBits)) &
+                                             ((1u << kMantissaBits) - 1));
+            j = sub_range_start_[key];
+            // a sub-range spans less than one 1.1x step, so the answer is
+            // either its first limit or the next one
+            j += positive_[j] < a;
+        }
+        // For x < 0 the first limit >= x is -positive_[m], at index
+        // num_positive_ - m, for the largest m with positive_[m] <= |x|.
+        size_t negative = num_positive_ - j + (positive_[j] != a);
+        size_t positive = num_positive_ + 1 + j;
+        // branch-free select, the sign of real data is unpredictable
+        size_t mask = static_cast<size_t>(0) - static_cast<size_t>(sign);
+        return positive ^ ((positive ^ negative) & mask);
+    }
+
+   private:
+    DefaultHistogramBuckets();
+
+    // index() for |x| above the largest positive limit, inf and NaN
+    size_t huge_index(double x) const {
+        if (x > 0) return limits_.size() - 1;
+        if (x < 0) return x <= std::numeric_limits<double>::lowest() ? 0 : 1;
+        return 0;  // NaN compares false with every limit
+    }
+
+    // Positive values are located through a table indexed by the binary
+    // exponent and the top mantissa bits; each entry stores the first limit
+    // at or above the start of its sub-range.
+    static const int kMantissaBits = 4;
+
+    std::vector<double> limits_;
+    // 1e-12, 1.1e-12, ... < 1e20, followed by a +inf sentinel
+    std::vector<double> positive_;
+    size_t num_positive_;
+    std::vector<uint16_t> sub_range_start_;
+    int min_exponent_;
+    int max_exponent_;
+};
+
+// Bucket counts and moments of a set of values, over the default buckets.
+class Histogram {
+   public:
+    Histogram() : counts_(DefaultHistogramBuckets::get().size(), 0) {}
+
+    // float, double, Float16, BFloat16 or any integer type; moments are
+    // accumulated in double.
+    template <typename T>
+    void add(const T *values, size_t num) {
+        add(HistogramView<T>(values, num));
+    }
+    template <typename T>
+    void add(const HistogramView<T> &view);
+
+    // add() reduces the values in chunks of kChunkSize: the moments of each
+    // chunk are accumulated from zero and then added to the totals, in
+    // order. Adding every chunk to a separate Histogram (e.g. on different
+    // threads) and merging them in chunk order therefore gives bit-identical
+    // results to add(values, num).
+    static const size_t kChunkSize = 1 << 20;
+    static size_t num_chunks(size_t num) {
+        return (num + kChunkSize - 1) / kChunkSize;
+    }
+    template <typename T>
+    void add_chunk(const T *values, size_t num, size_t chunk) {
+        add_chunk(HistogramView<T>(values, num), chunk);
+    }
+    template <typename T>
+    void add_chunk(const HistogramView<T> &view, size_t chunk);
+
+    void merge(const Histogram &other);
+
+    // Reset to the empty histogram, keeping the allocated counts.
+    void clear();
+
+    void to_proto(tensorflow::HistogramProto *histo) const;
+
+    uint64_t num() const { return num_; }
+    double min() const { return min_; }
+    double max() const { return max_; }
+    double sum() const { return sum_; }
+    double sum_squares() const { return sum_squares_; }
+    const std::vector<uint64_t> &counts() const { return counts_; }
+
+   private:
+    // Values are processed in blocks small enough to stay in L1 between the
+    // moments pass and the bucketing pass.
+    static const size_t kBlockSize = 2048;
+
+    struct Moments {
+        double min = std::numeric_limits<double>::max();
+        double max = std::numeric_limits<double>::lowest();
+        double sum = 0.0;
+        double sum_squares = 0.0;
+    };
+
+    // Values [begin, begin + num) of the view.
+    template <typename T>
+    void add_range(const HistogramView<T> &view, size_t begin, size_t num);
+    // Bytes take 256 counters, turned into buckets and exact moments at
+    // the end of the range.
+    void add_range(const HistogramView<int8_t> &view, size_t begin,
+                   size_t num);
+    void add_range(const HistogramView<uint8_t> &view, size_t begin,
+                   size_t num);
+    template <typename T>
+    void add_byte_counts(const HistogramView<T> &view, size_t begin,
+                         size_t num);
+
+    // What the bucketing works on: float for the 16-bit floats, converted
+    // a block at a time, the values themselves otherwise.
+    static float widen(Float16 value) { return to_float(value); }
+    static float widen(BFloat16 value) { return to_float(value); }
+    template <typename T>
+    static T widen(T value) {
+        return value;
+    }
+    static const float *widen(const Float16 *values, size_t num,
+                              float *block) {
+        to_float(values, num, block);
+        return block;
+    }
+    static const float *widen(const BFloat16 *values, size_t num,
+                              float *block) {
+        to_float(values, num, block);
+        return block;
+    }
+    template <typename T>
+    static const T *widen(const T *values, size_t, T *) {
+        return values;
+    }
+
+    template <typename T>
+    static void add_moments(const T *values, size_t num, Moments *moments);
+
+    std::vector<uint64_t> counts_;
+    uint64_t num_ = 0;
+    double min_ = std::numeric_limits<double>::max();
+    double max_ = std::numeric_limits<double>::lowest();
+    double sum_ = 0.0;
+    double sum_squares_ = 0.0;
+};
+
+// Histogram fed incrementally, e.g. with the activations of a step as they
+// are produced by micro-batches and data-parallel worker threads, instead of
+// from one array holding all the values.
+//
+// update() may be called concurrently from any number of threads: each
+// thread adds into its own partial histogram, so memory stays constant (one
+// set of bucket counts per updating thread) and threads do not contend.
+class HistogramAccumulator {
+   public:
+    HistogramAccumulator();
+    HistogramAccumulator(const HistogramAccumulator &) = delete;
+    HistogramAccumulator &operator=(const HistogramAccumulator &) = delete;
+
+    template <typename T>
+    void update(const T *values, size_t num) {
+        Partial *partial = local_partial();
+        std::lock_guard<std::mutex> lock{partial->mtx};
+        partial->histogram.add(values, num);
+    }
+    template <typename T>
+    void update(const std::vector<T> &values) {
+        update(values.data(), values.size());
+    }
+    template <typename T>
+    void update(const HistogramView<T> &view) {
+        Partial *partial = local_partial();
+        std::lock_guard<std::mutex> lock{partial->mtx};
+        partial->histogram.add(view);
+    }
+
+    // Add everything `other` has seen so far.
+    void merge(const HistogramAccumulator &other);
+
+    // Everything seen so far, combined over all threads.
+    Histogram snapshot() const;
+
+    // Forget all values, e.g. to start the next step.
+    void reset();
+
+   private:
+    struct Partial {
+        std::mutex mtx;
+        Histogram histogram;
+    };
+
+    Partial *local_partial();
+
+    const uint64_t id_;  // never reused, identifies this object in caches
+    mutable std::mutex mtx_;
+    std::vector<std::unique_ptr<Partial>> partials_;
+    std::vector<std::thread::id> owners_;  // thread of each partial
+};
+
+template <typename T>
+void Histogram::add(const HistogramView<T> &view) {
+    for (size_t begin = 0; begin < view.num; begin += kChunkSize) {
+        add_range(view, begin,
+                  view.num - begin < kChunkSize ? view.num - begin
+                                                : kChunkSize);
+    }
+}
+
+template <typename T>
+void Histogram::add_chunk(const HistogramView<T> &view, size_t chunk) {
+    size_t begin = chunk * kChunkSize;
+    if (begin >= view.num) return;
+    add_range(view, begin,
+              view.num - begin < kChunkSize ? view.num - begin : kChunkSize);
+}
+
+template <typename T>
+void Histogram::add_range(const HistogramView<T> &view, size_t begin,
+                          size_t num) {
+    typedef decltype(widen(std::declval<T>())) Block;
+    const auto &buckets = DefaultHistogramBuckets::get();
+    const bool contiguous = view.stride == 1 && view.mask == nullptr;
+    Block scratch[kBlockSize];
+    Moments moments;
+    size_t counted = 0;
+    for (size_t i = begin; i < begin + num; i += kBlockSize) {
+        size_t n = begin + num - i < kBlockSize ? begin + num - i : kBlockSize;
+        const Block *block;
+        if (contiguous) {
+            block = widen(view.values + i, n, scratch);
+        } else {
+            // gathered into L1, keeping the values the mask lets through
+            const T *values = view.values + i * view.stride;
+            size_t kept = 0;
+            for (size_t j = 0; j < n; ++j) {
+                scratch[kept] = widen(values[j * view.stride]);
+                kept += view.mask == nullptr || view.mask[i + j] != 0;
+            }
+            block = scratch;
+            n = kept;
+        }
+        add_moments(block, n, &moments);
+        for (size_t j = 0; j < n; ++j) {
+            counts_[buckets.index(static_cast<double>(block[j]))]++;
+        }
+        counted += n;
+    }
+    num_ += counted;
+    min_ = moments.min < min_ ? moments.min : min_;
+    max_ = moments.max > max_ ? moments.max : max_;
+    sum_ += moments.sum;
+    sum_squares_ += moments.sum_squares;
+}
+
+// Four independent accumulator lanes, so that the loop has no
+// loop-carried dependency on a single register and the compiler can keep the
+// lanes in SIMD registers. Everything is accumulated in double.
+template <typename T>
+void Histogram::add_moments(const T *values, size_t num, Moments *moments) {
+    const int kLanes = 4;
+    double lo[kLanes], hi[kLanes], s[kLanes], sq[kLanes];
+    for (int k = 0; k < kLanes; ++k) {
+        lo[k] = moments->min;
+        hi[k] = moments->max;
+        s[k] = 0.0;
+        sq[k] = 0.0;
+    }
+    size_t i = 0;
+    for (; i + kLanes <= num; i += kLanes) {
+        for (int k = 0; k < kLanes; ++k) {
+            double v = static_cast<double>(values[i + k]);
+            lo[k] = v < lo[k] ? v : lo[k];
+            hi[k] = v > hi[k] ? v : hi[k];
+            s[k] += v;
+            sq[k] += v * v;
+        }
+    }
+    for (int k = 0; i < num; ++i, ++k) {
+        double v = static_cast<double>(values[i]);
+        lo[k] = v < lo[k] ? v : lo[k];
+        hi[k] = v > hi[k] ? v : hi[k];
+        s[k] += v;
+        sq[k] += v * v;
+    }
+    for (int k = 0; k < kLanes; ++k) {
+        moments->min = lo[k] < moments->min ? lo[k] : moments->min;
+        moments->max = hi[k] > moments->max ? hi[k] : moments->max;
+    }
+    moments->sum += (s[0] + s[1]) + (s[2] + s[3]);
+    moments->sum_squares += (sq[0] + sq[1]) + (sq[2] + sq[3]);
+}
+
+#endif  // HISTOGRAM_H
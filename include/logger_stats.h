@@ -0,0 +1,185 @@
+#ifndef LOGGER_STATS_H
+#define LOGGER_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// What an add_* call logged, for TensorBoardLogger::stats().
+enum class EventKind {
+    kScalar,     // add_scalar(), ScalarHandle
+    kHistogram,  // add_histogram(), add_histograms()
+    kImage,      // add_image(), add_images() and their raw variants
+    kAudio,      // add_audio() and its PCM variants
+    kText,
+    kPrCurve,
+    kEmbedding,
+    kHparams,
+    kBatch,    // StepBatch::commit()
+    kRecords,  // write_records()
+};
+const size_t kNumEventKinds = static_cast<size_t>(EventKind::kRecords) + 1;
+
+// "scalar", "histogram", ...
+const char *event_kind_name(EventKind kind);
+
+struct LatencySummary {
+    uint64_t count = 0;  // timed calls
+    // within the ~19% wide bucket the value falls in
+    double p50_ns = 0;
+    double p99_ns = 0;
+    double max_ns = 0;
+};
+
+struct EventKindStats {
+    uint64_t calls = 0;
+    uint64_t records = 0;  // written or queued for the async writer
+    uint64_t bytes = 0;    // framed size of the records
+    // one call in kStatsLatencySampling of each thread is timed
+    LatencySummary latency;
+};
+
+// Snapshot of a logger's counters since it was created, see
+// TensorBoardLogger::stats().
+struct LoggerStats {
+    EventKindStats kinds[kNumEventKinds];
+    const EventKindStats &kind(EventKind kind) const {
+        return kinds[static_cast<size_t>(kind)];
+    }
+
+    // all records, including the ones written outside of add_* calls
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+
+    // file lock, as taken by the threads writing records
+    uint64_t lock_acquisitions = 0;
+    uint64_t lock_contended = 0;  // acquisitions that had to wait
+    uint64_t lock_wait_ns = 0;
+
+    // time spent serializing events and checksumming records, extrapolated
+    // from the timed calls
+    uint64_t serialize_ns = 0;
+    uint64_t crc_ns = 0;
+
+    // flush() and the flusher's own flushes
+    LatencySummary flush_latency;
+    // sync_until(), and the flusher with Durability::kSync
+    LatencySummary sync_latency;
+    uint64_t flusher_wakeups = 0;
+    uint64_t rotations = 0;
+
+    uint64_t threads = 0;       // threads that used the logger
+    uint64_t live_threads = 0;  // those of them still running
+};
+
+// One add_* call in this many, per thread and kind, is timed.
+const uint32_t kStatsLatencySampling = 8;
+
+// Counters below are written by their own thread only and read by
+// StatsRegistry::snapshot(): relaxed loads and stores, no read-modify-write.
+class StatsCounter {
+   public:
+    void add(uint64_t n) {
+        value_.store(value_.load(std::memory_order_relaxed) + n,
+                     std::memory_order_relaxed);
+    }
+    uint64_t get() const { return value_.load(std::memory_order_relaxed); }
+
+   private:
+    std::atomic<uint64_t> value_{0};
+};
+
+// Log-linear histogram of nanoseconds: four buckets per power of two.
+class LatencyHistogram {
+   public:
+    static const size_t kNumBuckets = 256;
+
+    void record(uint64_t ns);
+    // Adds the counts to `counts`, kNumBuckets of them.
+    void merge_into(uint64_t *counts) const;
+    // Adds the counts of `other`, with the same single writer rule.
+    void add(const LatencyHistogram &other);
+    static LatencySummary summarize(const uint64_t *counts);
+
+   private:
+    StatsCounter buckets_[kNumBuckets];
+};
+
+struct ThreadStats {
+    StatsCounter calls[kNumEventKinds];
+    StatsCounter records[kNumEventKinds];
+    StatsCounter bytes[kNumEventKinds];
+    LatencyHistogram latency[kNumEventKinds];
+    uint32_t sample_tick[kNumEventKinds] = {};  // owner thread only
+
+    StatsCounter all_records;
+    StatsCounter all_bytes;
+    StatsCounter lock_acquisitions;
+    StatsCounter lock_contended;
+    StatsCounter lock_wait_ns;
+    StatsCounter serialize_ns;
+    StatsCounter crc_ns;
+    LatencyHistogram flush_latency;
+    LatencyHistogram sync_latency;
+    StatsCounter flusher_wakeups;
+    StatsCounter rotations;
+};
+
+// The threads of a registry, shared with the threads so that they can fold
+// their counters into it when they exit, see logger_stats.cc.
+struct StatsThreads;
+
+// The per-thread counters of one logger, aggregated on read. When a thread
+// exits, its counters are folded into those of the threads gone before it
+// and freed, so that memory and snapshot() only grow with the live threads.
+class StatsRegistry {
+   public:
+    StatsRegistry();
+    ~StatsRegistry();
+    StatsRegistry(const StatsRegistry &) = delete;
+    StatsRegistry &operator=(const StatsRegistry &) = delete;
+
+    // Counters of the calling thread, created on its first use.
+    ThreadStats &local();
+    LoggerStats snapshot() const;
+
+   private:
+    ThreadStats &add_thread();
+
+    const uint64_t id_;  // unique per process, unlike the address
+    std::shared_ptr<StatsThreads> threads_;
+};
+
+// Counts an add_* call of `kind` for the lifetime of the scope, timing one
+// call in kStatsLatencySampling. A call made from within another call on
+// the same logger (e.g. add_images() from add_images_raw()) is not counted
+// again; records it writes are attributed to the outer call.
+class StatsScope {
+   public:
+    StatsScope(StatsRegistry &registry, EventKind kind);
+    ~StatsScope();
+    StatsScope(const StatsScope &) = delete;
+    StatsScope &operator=(const StatsScope &) = delete;
+
+    // The scope of the calling thread counting a call on `registry`, if any.
+    static StatsScope *current(const StatsRegistry &registry);
+
+    ThreadStats &thread_stats() const { return *stats_; }
+    EventKind kind() const { return kind_; }
+    bool sampled() const { return sampled_; }
+
+   private:
+    StatsRegistry *registry_;
+    ThreadStats *stats_ = nullptr;
+    EventKind kind_;
+    bool counting_ = false;
+    bool sampled_ = false;
+    std::chrono::steady_clock::time_point start_;
+    StatsScope *previous_;
+};
+
+#endif  // LOGGER_STATS_H
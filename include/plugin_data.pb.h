@@ -0,0 +1,1231 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: plugin_data.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_plugin_5fdata_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_plugin_5fdata_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "api.pb.h"
+#include <google/protobuf/struct.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_plugin_5fdata_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_plugin_5fdata_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_plugin_5fdata_2eproto;
+namespace tensorboard {
+namespace hparams {
+class HParamsPluginData;
+struct HParamsPluginDataDefaultTypeInternal;
+extern HParamsPluginDataDefaultTypeInternal _HParamsPluginData_default_instance_;
+class SessionEndInfo;
+struct SessionEndInfoDefaultTypeInternal;
+extern SessionEndInfoDefaultTypeInternal _SessionEndInfo_default_instance_;
+class SessionStartInfo;
+struct SessionStartInfoDefaultTypeInternal;
+extern SessionStartInfoDefaultTypeInternal _SessionStartInfo_default_instance_;
+class SessionStartInfo_HparamsEntry_DoNotUse;
+struct SessionStartInfo_HparamsEntry_DoNotUseDefaultTypeInternal;
+extern SessionStartInfo_HparamsEntry_DoNotUseDefaultTypeInternal _SessionStartInfo_HparamsEntry_DoNotUse_default_instance_;
+}  // namespace hparams
+}  // namespace tensorboard
+PROTOBUF_NAMESPACE_OPEN
+template<> ::tensorboard::hparams::HParamsPluginData* Arena::CreateMaybeMessage<::tensorboard::hparams::HParamsPluginData>(Arena*);
+template<> ::tensorboard::hparams::SessionEndInfo* Arena::CreateMaybeMessage<::tensorboard::hparams::SessionEndInfo>(Arena*);
+template<> ::tensorboard::hparams::SessionStartInfo* Arena::CreateMaybeMessage<::tensorboard::hparams::SessionStartInfo>(Arena*);
+template<> ::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse* Arena::CreateMaybeMessage<::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace tensorboard {
+namespace hparams {
+
+// ===================================================================
+
+class HParamsPluginData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.HParamsPluginData) */ {
+ public:
+  inline HParamsPluginData() : HParamsPluginData(nullptr) {}
+  ~HParamsPluginData() override;
+  explicit PROTOBUF_CONSTEXPR HParamsPluginData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HParamsPluginData(const HParamsPluginData& from);
+  HParamsPluginData(HParamsPluginData&& from) noexcept
+    : HParamsPluginData() {
+    *this = ::std::move(from);
+  }
+
+  inline HParamsPluginData& operator=(const HParamsPluginData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HParamsPluginData& operator=(HParamsPluginData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HParamsPluginData& default_instance() {
+    return *internal_default_instance();
+  }
+  enum DataCase {
+    kExperiment = 2,
+    kSessionStartInfo = 3,
+    kSessionEndInfo = 4,
+    DATA_NOT_SET = 0,
+  };
+
+  static inline const HParamsPluginData* internal_default_instance() {
+    return reinterpret_cast<const HParamsPluginData*>(
+               &_HParamsPluginData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(HParamsPluginData& a, HParamsPluginData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HParamsPluginData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HParamsPluginData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HParamsPluginData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HParamsPluginData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HParamsPluginData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HParamsPluginData& from) {
+    HParamsPluginData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HParamsPluginData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.HParamsPluginData";
+  }
+  protected:
+  explicit HParamsPluginData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kExperimentFieldNumber = 2,
+    kSessionStartInfoFieldNumber = 3,
+    kSessionEndInfoFieldNumber = 4,
+  };
+  // int32 version = 1;
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
+
+  // .tensorboard.hparams.Experiment experiment = 2;
+  bool has_experiment() const;
+  private:
+  bool _internal_has_experiment() const;
+  public:
+  void clear_experiment();
+  const ::tensorboard::hparams::Experiment& experiment() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::Experiment* release_experiment();
+  ::tensorboard::hparams::Experiment* mutable_experiment();
+  void set_allocated_experiment(::tensorboard::hparams::Experiment* experiment);
+  private:
+  const ::tensorboard::hparams::Experiment& _internal_experiment() const;
+  ::tensorboard::hparams::Experiment* _internal_mutable_experiment();
+  public:
+  void unsafe_arena_set_allocated_experiment(
+      ::tensorboard::hparams::Experiment* experiment);
+  ::tensorboard::hparams::Experiment* unsafe_arena_release_experiment();
+
+  // .tensorboard.hparams.SessionStartInfo session_start_info = 3;
+  bool has_session_start_info() const;
+  private:
+  bool _internal_has_session_start_info() const;
+  public:
+  void clear_session_start_info();
+  const ::tensorboard::hparams::SessionStartInfo& session_start_info() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::SessionStartInfo* release_session_start_info();
+  ::tensorboard::hparams::SessionStartInfo* mutable_session_start_info();
+  void set_allocated_session_start_info(::tensorboard::hparams::SessionStartInfo* session_start_info);
+  private:
+  const ::tensorboard::hparams::SessionStartInfo& _internal_session_start_info() const;
+  ::tensorboard::hparams::SessionStartInfo* _internal_mutable_session_start_info();
+  public:
+  void unsafe_arena_set_allocated_session_start_info(
+      ::tensorboard::hparams::SessionStartInfo* session_start_info);
+  ::tensorboard::hparams::SessionStartInfo* unsafe_arena_release_session_start_info();
+
+  // .tensorboard.hparams.SessionEndInfo session_end_info = 4;
+  bool has_session_end_info() const;
+  private:
+  bool _internal_has_session_end_info() const;
+  public:
+  void clear_session_end_info();
+  const ::tensorboard::hparams::SessionEndInfo& session_end_info() const;
+  PROTOBUF_NODISCARD ::tensorboard::hparams::SessionEndInfo* release_session_end_info();
+  ::tensorboard::hparams::SessionEndInfo* mutable_session_end_info();
+  void set_allocated_session_end_info(::tensorboard::hparams::SessionEndInfo* session_end_info);
+  private:
+  const ::tensorboard::hparams::SessionEndInfo& _internal_session_end_info() const;
+  ::tensorboard::hparams::SessionEndInfo* _internal_mutable_session_end_info();
+  public:
+  void unsafe_arena_set_allocated_session_end_info(
+      ::tensorboard::hparams::SessionEndInfo* session_end_info);
+  ::tensorboard::hparams::SessionEndInfo* unsafe_arena_release_session_end_info();
+
+  void clear_data();
+  DataCase data_case() const;
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.HParamsPluginData)
+ private:
+  class _Internal;
+  void set_has_experiment();
+  void set_has_session_start_info();
+  void set_has_session_end_info();
+
+  inline bool has_data() const;
+  inline void clear_has_data();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t version_;
+    union DataUnion {
+      constexpr DataUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::tensorboard::hparams::Experiment* experiment_;
+      ::tensorboard::hparams::SessionStartInfo* session_start_info_;
+      ::tensorboard::hparams::SessionEndInfo* session_end_info_;
+    } data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionStartInfo_HparamsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SessionStartInfo_HparamsEntry_DoNotUse, 
+    std::string, ::PROTOBUF_NAMESPACE_ID::Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SessionStartInfo_HparamsEntry_DoNotUse, 
+    std::string, ::PROTOBUF_NAMESPACE_ID::Value,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  SessionStartInfo_HparamsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR SessionStartInfo_HparamsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit SessionStartInfo_HparamsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SessionStartInfo_HparamsEntry_DoNotUse& other);
+  static const SessionStartInfo_HparamsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SessionStartInfo_HparamsEntry_DoNotUse*>(&_SessionStartInfo_HparamsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "tensorboard.hparams.SessionStartInfo.HparamsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_plugin_5fdata_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class SessionStartInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.SessionStartInfo) */ {
+ public:
+  inline SessionStartInfo() : SessionStartInfo(nullptr) {}
+  ~SessionStartInfo() override;
+  explicit PROTOBUF_CONSTEXPR SessionStartInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionStartInfo(const SessionStartInfo& from);
+  SessionStartInfo(SessionStartInfo&& from) noexcept
+    : SessionStartInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionStartInfo& operator=(const SessionStartInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionStartInfo& operator=(SessionStartInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionStartInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionStartInfo* internal_default_instance() {
+    return reinterpret_cast<const SessionStartInfo*>(
+               &_SessionStartInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SessionStartInfo& a, SessionStartInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionStartInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionStartInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionStartInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionStartInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionStartInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionStartInfo& from) {
+    SessionStartInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionStartInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.SessionStartInfo";
+  }
+  protected:
+  explicit SessionStartInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHparamsFieldNumber = 1,
+    kModelUriFieldNumber = 2,
+    kMonitorUrlFieldNumber = 3,
+    kGroupNameFieldNumber = 4,
+    kStartTimeSecsFieldNumber = 5,
+  };
+  // map<string, .google.protobuf.Value> hparams = 1;
+  int hparams_size() const;
+  private:
+  int _internal_hparams_size() const;
+  public:
+  void clear_hparams();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+      _internal_hparams() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+      _internal_mutable_hparams();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+      hparams() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+      mutable_hparams();
+
+  // string model_uri = 2;
+  void clear_model_uri();
+  const std::string& model_uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_model_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_model_uri();
+  PROTOBUF_NODISCARD std::string* release_model_uri();
+  void set_allocated_model_uri(std::string* model_uri);
+  private:
+  const std::string& _internal_model_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_model_uri(const std::string& value);
+  std::string* _internal_mutable_model_uri();
+  public:
+
+  // string monitor_url = 3;
+  void clear_monitor_url();
+  const std::string& monitor_url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_monitor_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_monitor_url();
+  PROTOBUF_NODISCARD std::string* release_monitor_url();
+  void set_allocated_monitor_url(std::string* monitor_url);
+  private:
+  const std::string& _internal_monitor_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_monitor_url(const std::string& value);
+  std::string* _internal_mutable_monitor_url();
+  public:
+
+  // string group_name = 4;
+  void clear_group_name();
+  const std::string& group_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_group_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_group_name();
+  PROTOBUF_NODISCARD std::string* release_group_name();
+  void set_allocated_group_name(std::string* group_name);
+  private:
+  const std::string& _internal_group_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group_name(const std::string& value);
+  std::string* _internal_mutable_group_name();
+  public:
+
+  // double start_time_secs = 5;
+  void clear_start_time_secs();
+  double start_time_secs() const;
+  void set_start_time_secs(double value);
+  private:
+  double _internal_start_time_secs() const;
+  void _internal_set_start_time_secs(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.SessionStartInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        SessionStartInfo_HparamsEntry_DoNotUse,
+        std::string, ::PROTOBUF_NAMESPACE_ID::Value,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> hparams_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr model_uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr monitor_url_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_name_;
+    double start_time_secs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionEndInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.hparams.SessionEndInfo) */ {
+ public:
+  inline SessionEndInfo() : SessionEndInfo(nullptr) {}
+  ~SessionEndInfo() override;
+  explicit PROTOBUF_CONSTEXPR SessionEndInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionEndInfo(const SessionEndInfo& from);
+  SessionEndInfo(SessionEndInfo&& from) noexcept
+    : SessionEndInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionEndInfo& operator=(const SessionEndInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionEndInfo& operator=(SessionEndInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionEndInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionEndInfo* internal_default_instance() {
+    return reinterpret_cast<const SessionEndInfo*>(
+               &_SessionEndInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SessionEndInfo& a, SessionEndInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionEndInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionEndInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionEndInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionEndInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionEndInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionEndInfo& from) {
+    SessionEndInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionEndInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.hparams.SessionEndInfo";
+  }
+  protected:
+  explicit SessionEndInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEndTimeSecsFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // double end_time_secs = 2;
+  void clear_end_time_secs();
+  double end_time_secs() const;
+  void set_end_time_secs(double value);
+  private:
+  double _internal_end_time_secs() const;
+  void _internal_set_end_time_secs(double value);
+  public:
+
+  // .tensorboard.hparams.Status status = 1;
+  void clear_status();
+  ::tensorboard::hparams::Status status() const;
+  void set_status(::tensorboard::hparams::Status value);
+  private:
+  ::tensorboard::hparams::Status _internal_status() const;
+  void _internal_set_status(::tensorboard::hparams::Status value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.hparams.SessionEndInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double end_time_secs_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_5fdata_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// HParamsPluginData
+
+// int32 version = 1;
+inline void HParamsPluginData::clear_version() {
+  _impl_.version_ = 0;
+}
+inline int32_t HParamsPluginData::_internal_version() const {
+  return _impl_.version_;
+}
+inline int32_t HParamsPluginData::version() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamsPluginData.version)
+  return _internal_version();
+}
+inline void HParamsPluginData::_internal_set_version(int32_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void HParamsPluginData::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.HParamsPluginData.version)
+}
+
+// .tensorboard.hparams.Experiment experiment = 2;
+inline bool HParamsPluginData::_internal_has_experiment() const {
+  return data_case() == kExperiment;
+}
+inline bool HParamsPluginData::has_experiment() const {
+  return _internal_has_experiment();
+}
+inline void HParamsPluginData::set_has_experiment() {
+  _impl_._oneof_case_[0] = kExperiment;
+}
+inline ::tensorboard::hparams::Experiment* HParamsPluginData::release_experiment() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamsPluginData.experiment)
+  if (_internal_has_experiment()) {
+    clear_has_data();
+    ::tensorboard::hparams::Experiment* temp = _impl_.data_.experiment_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.experiment_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tensorboard::hparams::Experiment& HParamsPluginData::_internal_experiment() const {
+  return _internal_has_experiment()
+      ? *_impl_.data_.experiment_
+      : reinterpret_cast< ::tensorboard::hparams::Experiment&>(::tensorboard::hparams::_Experiment_default_instance_);
+}
+inline const ::tensorboard::hparams::Experiment& HParamsPluginData::experiment() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamsPluginData.experiment)
+  return _internal_experiment();
+}
+inline ::tensorboard::hparams::Experiment* HParamsPluginData::unsafe_arena_release_experiment() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.HParamsPluginData.experiment)
+  if (_internal_has_experiment()) {
+    clear_has_data();
+    ::tensorboard::hparams::Experiment* temp = _impl_.data_.experiment_;
+    _impl_.data_.experiment_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void HParamsPluginData::unsafe_arena_set_allocated_experiment(::tensorboard::hparams::Experiment* experiment) {
+  clear_data();
+  if (experiment) {
+    set_has_experiment();
+    _impl_.data_.experiment_ = experiment;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.HParamsPluginData.experiment)
+}
+inline ::tensorboard::hparams::Experiment* HParamsPluginData::_internal_mutable_experiment() {
+  if (!_internal_has_experiment()) {
+    clear_data();
+    set_has_experiment();
+    _impl_.data_.experiment_ = CreateMaybeMessage< ::tensorboard::hparams::Experiment >(GetArenaForAllocation());
+  }
+  return _impl_.data_.experiment_;
+}
+inline ::tensorboard::hparams::Experiment* HParamsPluginData::mutable_experiment() {
+  ::tensorboard::hparams::Experiment* _msg = _internal_mutable_experiment();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamsPluginData.experiment)
+  return _msg;
+}
+
+// .tensorboard.hparams.SessionStartInfo session_start_info = 3;
+inline bool HParamsPluginData::_internal_has_session_start_info() const {
+  return data_case() == kSessionStartInfo;
+}
+inline bool HParamsPluginData::has_session_start_info() const {
+  return _internal_has_session_start_info();
+}
+inline void HParamsPluginData::set_has_session_start_info() {
+  _impl_._oneof_case_[0] = kSessionStartInfo;
+}
+inline void HParamsPluginData::clear_session_start_info() {
+  if (_internal_has_session_start_info()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.session_start_info_;
+    }
+    clear_has_data();
+  }
+}
+inline ::tensorboard::hparams::SessionStartInfo* HParamsPluginData::release_session_start_info() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamsPluginData.session_start_info)
+  if (_internal_has_session_start_info()) {
+    clear_has_data();
+    ::tensorboard::hparams::SessionStartInfo* temp = _impl_.data_.session_start_info_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.session_start_info_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tensorboard::hparams::SessionStartInfo& HParamsPluginData::_internal_session_start_info() const {
+  return _internal_has_session_start_info()
+      ? *_impl_.data_.session_start_info_
+      : reinterpret_cast< ::tensorboard::hparams::SessionStartInfo&>(::tensorboard::hparams::_SessionStartInfo_default_instance_);
+}
+inline const ::tensorboard::hparams::SessionStartInfo& HParamsPluginData::session_start_info() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamsPluginData.session_start_info)
+  return _internal_session_start_info();
+}
+inline ::tensorboard::hparams::SessionStartInfo* HParamsPluginData::unsafe_arena_release_session_start_info() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.HParamsPluginData.session_start_info)
+  if (_internal_has_session_start_info()) {
+    clear_has_data();
+    ::tensorboard::hparams::SessionStartInfo* temp = _impl_.data_.session_start_info_;
+    _impl_.data_.session_start_info_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void HParamsPluginData::unsafe_arena_set_allocated_session_start_info(::tensorboard::hparams::SessionStartInfo* session_start_info) {
+  clear_data();
+  if (session_start_info) {
+    set_has_session_start_info();
+    _impl_.data_.session_start_info_ = session_start_info;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.HParamsPluginData.session_start_info)
+}
+inline ::tensorboard::hparams::SessionStartInfo* HParamsPluginData::_internal_mutable_session_start_info() {
+  if (!_internal_has_session_start_info()) {
+    clear_data();
+    set_has_session_start_info();
+    _impl_.data_.session_start_info_ = CreateMaybeMessage< ::tensorboard::hparams::SessionStartInfo >(GetArenaForAllocation());
+  }
+  return _impl_.data_.session_start_info_;
+}
+inline ::tensorboard::hparams::SessionStartInfo* HParamsPluginData::mutable_session_start_info() {
+  ::tensorboard::hparams::SessionStartInfo* _msg = _internal_mutable_session_start_info();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamsPluginData.session_start_info)
+  return _msg;
+}
+
+// .tensorboard.hparams.SessionEndInfo session_end_info = 4;
+inline bool HParamsPluginData::_internal_has_session_end_info() const {
+  return data_case() == kSessionEndInfo;
+}
+inline bool HParamsPluginData::has_session_end_info() const {
+  return _internal_has_session_end_info();
+}
+inline void HParamsPluginData::set_has_session_end_info() {
+  _impl_._oneof_case_[0] = kSessionEndInfo;
+}
+inline void HParamsPluginData::clear_session_end_info() {
+  if (_internal_has_session_end_info()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.session_end_info_;
+    }
+    clear_has_data();
+  }
+}
+inline ::tensorboard::hparams::SessionEndInfo* HParamsPluginData::release_session_end_info() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.HParamsPluginData.session_end_info)
+  if (_internal_has_session_end_info()) {
+    clear_has_data();
+    ::tensorboard::hparams::SessionEndInfo* temp = _impl_.data_.session_end_info_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.session_end_info_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::tensorboard::hparams::SessionEndInfo& HParamsPluginData::_internal_session_end_info() const {
+  return _internal_has_session_end_info()
+      ? *_impl_.data_.session_end_info_
+      : reinterpret_cast< ::tensorboard::hparams::SessionEndInfo&>(::tensorboard::hparams::_SessionEndInfo_default_instance_);
+}
+inline const ::tensorboard::hparams::SessionEndInfo& HParamsPluginData::session_end_info() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.HParamsPluginData.session_end_info)
+  return _internal_session_end_info();
+}
+inline ::tensorboard::hparams::SessionEndInfo* HParamsPluginData::unsafe_arena_release_session_end_info() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:tensorboard.hparams.HParamsPluginData.session_end_info)
+  if (_internal_has_session_end_info()) {
+    clear_has_data();
+    ::tensorboard::hparams::SessionEndInfo* temp = _impl_.data_.session_end_info_;
+    _impl_.data_.session_end_info_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void HParamsPluginData::unsafe_arena_set_allocated_session_end_info(::tensorboard::hparams::SessionEndInfo* session_end_info) {
+  clear_data();
+  if (session_end_info) {
+    set_has_session_end_info();
+    _impl_.data_.session_end_info_ = session_end_info;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tensorboard.hparams.HParamsPluginData.session_end_info)
+}
+inline ::tensorboard::hparams::SessionEndInfo* HParamsPluginData::_internal_mutable_session_end_info() {
+  if (!_internal_has_session_end_info()) {
+    clear_data();
+    set_has_session_end_info();
+    _impl_.data_.session_end_info_ = CreateMaybeMessage< ::tensorboard::hparams::SessionEndInfo >(GetArenaForAllocation());
+  }
+  return _impl_.data_.session_end_info_;
+}
+inline ::tensorboard::hparams::SessionEndInfo* HParamsPluginData::mutable_session_end_info() {
+  ::tensorboard::hparams::SessionEndInfo* _msg = _internal_mutable_session_end_info();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.HParamsPluginData.session_end_info)
+  return _msg;
+}
+
+inline bool HParamsPluginData::has_data() const {
+  return data_case() != DATA_NOT_SET;
+}
+inline void HParamsPluginData::clear_has_data() {
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
+}
+inline HParamsPluginData::DataCase HParamsPluginData::data_case() const {
+  return HParamsPluginData::DataCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// SessionStartInfo
+
+// map<string, .google.protobuf.Value> hparams = 1;
+inline int SessionStartInfo::_internal_hparams_size() const {
+  return _impl_.hparams_.size();
+}
+inline int SessionStartInfo::hparams_size() const {
+  return _internal_hparams_size();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+SessionStartInfo::_internal_hparams() const {
+  return _impl_.hparams_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >&
+SessionStartInfo::hparams() const {
+  // @@protoc_insertion_point(field_map:tensorboard.hparams.SessionStartInfo.hparams)
+  return _internal_hparams();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+SessionStartInfo::_internal_mutable_hparams() {
+  return _impl_.hparams_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >*
+SessionStartInfo::mutable_hparams() {
+  // @@protoc_insertion_point(field_mutable_map:tensorboard.hparams.SessionStartInfo.hparams)
+  return _internal_mutable_hparams();
+}
+
+// string model_uri = 2;
+inline void SessionStartInfo::clear_model_uri() {
+  _impl_.model_uri_.ClearToEmpty();
+}
+inline const std::string& SessionStartInfo::model_uri() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionStartInfo.model_uri)
+  return _internal_model_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionStartInfo::set_model_uri(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.model_uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionStartInfo.model_uri)
+}
+inline std::string* SessionStartInfo::mutable_model_uri() {
+  std::string* _s = _internal_mutable_model_uri();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionStartInfo.model_uri)
+  return _s;
+}
+inline const std::string& SessionStartInfo::_internal_model_uri() const {
+  return _impl_.model_uri_.Get();
+}
+inline void SessionStartInfo::_internal_set_model_uri(const std::string& value) {
+  
+  _impl_.model_uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionStartInfo::_internal_mutable_model_uri() {
+  
+  return _impl_.model_uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionStartInfo::release_model_uri() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.SessionStartInfo.model_uri)
+  return _impl_.model_uri_.Release();
+}
+inline void SessionStartInfo::set_allocated_model_uri(std::string* model_uri) {
+  if (model_uri != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.model_uri_.SetAllocated(model_uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.model_uri_.IsDefault()) {
+    _impl_.model_uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.SessionStartInfo.model_uri)
+}
+
+// string monitor_url = 3;
+inline void SessionStartInfo::clear_monitor_url() {
+  _impl_.monitor_url_.ClearToEmpty();
+}
+inline const std::string& SessionStartInfo::monitor_url() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionStartInfo.monitor_url)
+  return _internal_monitor_url();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionStartInfo::set_monitor_url(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.monitor_url_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionStartInfo.monitor_url)
+}
+inline std::string* SessionStartInfo::mutable_monitor_url() {
+  std::string* _s = _internal_mutable_monitor_url();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionStartInfo.monitor_url)
+  return _s;
+}
+inline const std::string& SessionStartInfo::_internal_monitor_url() const {
+  return _impl_.monitor_url_.Get();
+}
+inline void SessionStartInfo::_internal_set_monitor_url(const std::string& value) {
+  
+  _impl_.monitor_url_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionStartInfo::_internal_mutable_monitor_url() {
+  
+  return _impl_.monitor_url_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionStartInfo::release_monitor_url() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.SessionStartInfo.monitor_url)
+  return _impl_.monitor_url_.Release();
+}
+inline void SessionStartInfo::set_allocated_monitor_url(std::string* monitor_url) {
+  if (monitor_url != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.monitor_url_.SetAllocated(monitor_url, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.monitor_url_.IsDefault()) {
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.SessionStartInfo.monitor_url)
+}
+
+// string group_name = 4;
+inline void SessionStartInfo::clear_group_name() {
+  _impl_.group_name_.ClearToEmpty();
+}
+inline const std::string& SessionStartInfo::group_name() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionStartInfo.group_name)
+  return _internal_group_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionStartInfo::set_group_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.group_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionStartInfo.group_name)
+}
+inline std::string* SessionStartInfo::mutable_group_name() {
+  std::string* _s = _internal_mutable_group_name();
+  // @@protoc_insertion_point(field_mutable:tensorboard.hparams.SessionStartInfo.group_name)
+  return _s;
+}
+inline const std::string& SessionStartInfo::_internal_group_name() const {
+  return _impl_.group_name_.Get();
+}
+inline void SessionStartInfo::_internal_set_group_name(const std::string& value) {
+  
+  _impl_.group_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionStartInfo::_internal_mutable_group_name() {
+  
+  return _impl_.group_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionStartInfo::release_group_name() {
+  // @@protoc_insertion_point(field_release:tensorboard.hparams.SessionStartInfo.group_name)
+  return _impl_.group_name_.Release();
+}
+inline void SessionStartInfo::set_allocated_group_name(std::string* group_name) {
+  if (group_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.group_name_.SetAllocated(group_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.group_name_.IsDefault()) {
+    _impl_.group_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.SessionStartInfo.group_name)
+}
+
+// double start_time_secs = 5;
+inline void SessionStartInfo::clear_start_time_secs() {
+  _impl_.start_time_secs_ = 0;
+}
+inline double SessionStartInfo::_internal_start_time_secs() const {
+  return _impl_.start_time_secs_;
+}
+inline double SessionStartInfo::start_time_secs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionStartInfo.start_time_secs)
+  return _internal_start_time_secs();
+}
+inline void SessionStartInfo::_internal_set_start_time_secs(double value) {
+  
+  _impl_.start_time_secs_ = value;
+}
+inline void SessionStartInfo::set_start_time_secs(double value) {
+  _internal_set_start_time_secs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionStartInfo.start_time_secs)
+}
+
+// -------------------------------------------------------------------
+
+// SessionEndInfo
+
+// .tensorboard.hparams.Status status = 1;
+inline void SessionEndInfo::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::tensorboard::hparams::Status SessionEndInfo::_internal_status() const {
+  return static_cast< ::tensorboard::hparams::Status >(_impl_.status_);
+}
+inline ::tensorboard::hparams::Status SessionEndInfo::status() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionEndInfo.status)
+  return _internal_status();
+}
+inline void SessionEndInfo::_internal_set_status(::tensorboard::hparams::Status value) {
+  
+  _impl_.status_ = value;
+}
+inline void SessionEndInfo::set_status(::tensorboard::hparams::Status value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionEndInfo.status)
+}
+
+// double end_time_secs = 2;
+inline void SessionEndInfo::clear_end_time_secs() {
+  _impl_.end_time_secs_ = 0;
+}
+inline double SessionEndInfo::_internal_end_time_secs() const {
+  return _impl_.end_time_secs_;
+}
+inline double SessionEndInfo::end_time_secs() const {
+  // @@protoc_insertion_point(field_get:tensorboard.hparams.SessionEndInfo.end_time_secs)
+  return _internal_end_time_secs();
+}
+inline void SessionEndInfo::_internal_set_end_time_secs(double value) {
+  
+  _impl_.end_time_secs_ = value;
+}
+inline void SessionEndInfo::set_end_time_secs(double value) {
+  _internal_set_end_time_secs(value);
+  // @@protoc_insertion_point(field_set:tensorboard.hparams.SessionEndInfo.end_time_secs)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace hparams
+}  // namespace tensorboard
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_plugin_5fdata_2eproto
@@ -0,0 +1,43 @@
+#ifndef PNG_ENCODER_H
+#define PNG_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// PNG filter applied to every row before compression, see
+// https://www.w3.org/TR/png/#9Filters
+enum class PngFilter {
+    kNone,
+    kSub,
+    kUp,
+    kAverage,
+    kPaeth,
+    // per row, the filter whose output has the smallest sum of absolute
+    // values, the heuristic recommended by the PNG specification
+    kAdaptive,
+};
+
+struct PngOptions {
+    // zlib level, 0 (store) to 9 (smallest), -1 for zlib's default.
+    int compression_level_ = 6;
+    PngOptions &compression_level(int compression_level) {
+        compression_level_ = compression_level;
+        return *this;
+    }
+
+    PngFilter filter_ = PngFilter::kAdaptive;
+    PngOptions &filter(PngFilter filter) {
+        filter_ = filter;
+        return *this;
+    }
+};
+
+// Encodes an 8-bit image stored row by row as height x width x channels
+// bytes: 1 channel is grayscale, 2 grayscale and alpha, 3 RGB and 4 RGBA.
+// Throws std::invalid_argument for other shapes and std::runtime_error if
+// zlib fails.
+std::string encode_png(const uint8_t *hwc, int height, int width,
+                       int channels, const PngOptions &options = {});
+
+#endif  // PNG_ENCODER_H
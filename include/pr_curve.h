@@ -0,0 +1,33 @@
+#ifndef PR_CURVE_H
+#define PR_CURVE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Rows of the tensor of a "pr_curves" summary, each num_thresholds long.
+const size_t kPrCurveRows = 6;  // TP, FP, TN, FN, precision, recall
+
+// Most thresholds TensorBoardLogger::add_pr_curve() accepts.
+const uint32_t kMaxPrCurveThresholds = 1 << 16;
+
+// Adds the predictions to `counts`, 2 * num_thresholds of them: for each
+// threshold bucket, the weight of the negative then of the positive
+// predictions in it. A prediction p falls in bucket
+// floor(p * (num_thresholds - 1)), clamped to the buckets, NaN in bucket 0.
+// Labels are positive when nonzero, `weights` may be nullptr for all ones.
+// Uses AVX2 or SSE2 when available.
+void bin_pr_predictions(const float *predictions, const uint8_t *labels,
+                        const float *weights, size_t num,
+                        uint32_t num_thresholds, double *counts);
+
+// The kPrCurveRows x num_thresholds rows of the curve from the counts of
+// bin_pr_predictions(), computed like TensorBoard's pr_curve summaries:
+// threshold i counts the predictions in buckets i and above as positive.
+void pr_curve_rows(const double *counts, uint32_t num_thresholds,
+                   float *rows);
+
+// Name of the implementation used by bin_pr_predictions: "avx2", "sse2" or
+// "portable".
+const char *pr_curve_implementation();
+
+#endif  // PR_CURVE_H
@@ -0,0 +1,278 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: pr_curve_plugin_data.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_pr_5fcurve_5fplugin_5fdata_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_pr_5fcurve_5fplugin_5fdata_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_pr_5fcurve_5fplugin_5fdata_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_pr_5fcurve_5fplugin_5fdata_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto;
+namespace tensorboard {
+class PrCurvePluginData;
+struct PrCurvePluginDataDefaultTypeInternal;
+extern PrCurvePluginDataDefaultTypeInternal _PrCurvePluginData_default_instance_;
+}  // namespace tensorboard
+PROTOBUF_NAMESPACE_OPEN
+template<> ::tensorboard::PrCurvePluginData* Arena::CreateMaybeMessage<::tensorboard::PrCurvePluginData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace tensorboard {
+
+// ===================================================================
+
+class PrCurvePluginData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tensorboard.PrCurvePluginData) */ {
+ public:
+  inline PrCurvePluginData() : PrCurvePluginData(nullptr) {}
+  ~PrCurvePluginData() override;
+  explicit PROTOBUF_CONSTEXPR PrCurvePluginData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrCurvePluginData(const PrCurvePluginData& from);
+  PrCurvePluginData(PrCurvePluginData&& from) noexcept
+    : PrCurvePluginData() {
+    *this = ::std::move(from);
+  }
+
+  inline PrCurvePluginData& operator=(const PrCurvePluginData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrCurvePluginData& operator=(PrCurvePluginData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrCurvePluginData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrCurvePluginData* internal_default_instance() {
+    return reinterpret_cast<const PrCurvePluginData*>(
+               &_PrCurvePluginData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PrCurvePluginData& a, PrCurvePluginData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrCurvePluginData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrCurvePluginData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrCurvePluginData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrCurvePluginData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrCurvePluginData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrCurvePluginData& from) {
+    PrCurvePluginData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrCurvePluginData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tensorboard.PrCurvePluginData";
+  }
+  protected:
+  explicit PrCurvePluginData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kNumThresholdsFieldNumber = 2,
+  };
+  // int32 version = 1;
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
+
+  // uint32 num_thresholds = 2;
+  void clear_num_thresholds();
+  uint32_t num_thresholds() const;
+  void set_num_thresholds(uint32_t value);
+  private:
+  uint32_t _internal_num_thresholds() const;
+  void _internal_set_num_thresholds(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tensorboard.PrCurvePluginData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t version_;
+    uint32_t num_thresholds_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_pr_5fcurve_5fplugin_5fdata_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PrCurvePluginData
+
+// int32 version = 1;
+inline void PrCurvePluginData::clear_version() {
+  _impl_.version_ = 0;
+}
+inline int32_t PrCurvePluginData::_internal_version() const {
+  return _impl_.version_;
+}
+inline int32_t PrCurvePluginData::version() const {
+  // @@protoc_insertion_point(field_get:tensorboard.PrCurvePluginData.version)
+  return _internal_version();
+}
+inline void PrCurvePluginData::_internal_set_version(int32_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PrCurvePluginData::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:tensorboard.PrCurvePluginData.version)
+}
+
+// uint32 num_thresholds = 2;
+inline void PrCurvePluginData::clear_num_thresholds() {
+  _impl_.num_thresholds_ = 0u;
+}
+inline uint32_t PrCurvePluginData::_internal_num_thresholds() const {
+  return _impl_.num_thresholds_;
+}
+inline uint32_t PrCurvePluginData::num_thresholds() const {
+  // @@protoc_insertion_point(field_get:tensorboard.PrCurvePluginData.num_thresholds)
+  return _internal_num_thresholds();
+}
+inline void PrCurvePluginData::_internal_set_num_thresholds(uint32_t value) {
+  
+  _impl_.num_thresholds_ = value;
+}
+inline void PrCurvePluginData::set_num_thresholds(uint32_t value) {
+  _internal_set_num_thresholds(value);
+  // @@protoc_insertion_point(field_set:tensorboard.PrCurvePluginData.num_thresholds)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace tensorboard
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_pr_5fcurve_5fplugin_5fdata_2eproto
@@ -0,0 +1,173 @@
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "summary.pb.h"
+
+// Mergeable quantile sketch with relative-error buckets (DDSketch), for
+// distributions too large to bucket in one pass when logging, e.g. embedding
+// tables with billions of entries spread over shards and threads.
+//
+// Every value lands in a bucket whose bounds are within a factor
+// (1 + relative_accuracy) / (1 - relative_accuracy) of each other, so that
+// quantile() is off by at most relative_accuracy times the true quantile.
+// Each sign keeps at most max_buckets buckets: beyond that, the buckets of
+// the smallest magnitudes are folded together and only lose accuracy for
+// quantiles that fall in them. At 1% accuracy, magnitudes from 1e-9 to 1e9
+// take about 2050 buckets, 8 bytes each.
+//
+// A sketch is not thread safe: feed one per thread or shard and merge()
+// them, possibly after a round trip through serialize() across processes.
+class QuantileSketch {
+   public:
+    // Throws std::invalid_argument unless 1e-6 <= relative_accuracy < 1 and
+    // max_buckets >= 1.
+    explicit QuantileSketch(double relative_accuracy = 0.01,
+                            size_t max_buckets = 4096);
+
+    // NaNs are skipped. Magnitudes below the smallest normal double count
+    // as zeros.
+    template <typename T>
+    void add(const T *values, size_t num);
+    template <typename T>
+    void add(const std::vector<T> &values) {
+        add(values.data(), values.size());
+    }
+    void add(double value) { add(&value, 1); }
+
+    // Add everything `other` has seen. Throws std::invalid_argument if its
+    // relative accuracy differs. Buckets beyond max_buckets are folded as
+    // in add().
+    void merge(const QuantileSketch &other);
+
+    // Value at rank floor(q * (count() - 1)) of the sorted values, within
+    // the relative accuracy and clamped to [min(), max()]. NaN if empty.
+    double quantile(double q) const;
+
+    // Histogram with the bucket bounds of the sketch.
+    void to_proto(tensorflow::HistogramProto *histo) const;
+
+    // Compact portable encoding, and back. deserialize() throws
+    // std::invalid_argument on malformed data.
+    std::string serialize() const;
+    static QuantileSketch deserialize(const std::string &data);
+
+    void clear();
+
+    double relative_accuracy() const { return relative_accuracy_; }
+    size_t max_buckets() const { return max_buckets_; }
+    uint64_t count() const { return count_; }
+    double min() const { return min_; }
+    double max() const { return max_; }
+    double sum() const { return sum_; }
+    double sum_squares() const { return sum_squares_; }
+    // Buckets in use over both signs, a measure of the memory taken.
+    size_t num_buckets() const {
+        return positive_.counts.size() + negative_.counts.size();
+    }
+
+    // Bucket of magnitude `value` (> 0) and its bounds: lower_bound(key(v))
+    // <= v < lower_bound(key(v) + 1), up to rounding.
+    int32_t key(double value) const;
+    double lower_bound(int32_t key) const;
+
+   private:
+    // Counts of consecutive keys, from `offset` on.
+    struct Store {
+        int32_t offset = 0;
+        std::vector<uint64_t> counts;
+
+        void add(int32_t key, uint64_t n, size_t max_buckets) {
+            auto index = static_cast<size_t>(
+                static_cast<int64_t>(key) - static_cast<int64_t>(offset));
+            if (index < counts.size()) {
+                counts[index] += n;
+            } else {
+                grow_and_add(key, n, max_buckets);
+            }
+        }
+        void grow_and_add(int32_t key, uint64_t n, size_t max_buckets);
+    };
+
+    // Quantile of a value in bucket `key`: the point of the bucket with
+    // the lowest relative error to both of its bounds.
+    double bucket_value(int32_t key) const;
+
+    double relative_accuracy_;
+    size_t max_buckets_;
+    // keys are floor(log2 approximation * multiplier_)
+    double multiplier_;
+
+    Store positive_;
+    Store negative_;  // by magnitude
+    uint64_t zero_count_ = 0;
+    uint64_t count_ = 0;
+    double min_ = std::numeric_limits<double>::max();
+    double max_ = std::numeric_limits<double>::lowest();
+    double sum_ = 0.0;
+    double sum_squares_ = 0.0;
+};
+
+// The totals are kept in locals: the members could alias the bucket counts
+// and would be reloaded after every store.
+template <typename T>
+void QuantileSketch::add(const T *values, size_t num) {
+    const double kMinIndexable = std::numeric_limits<double>::min();
+    // indexed by the sign rather than branched on, the sign of real data
+    // is unpredictable
+    Store *const stores[2] = {&positive_, &negative_};
+    uint64_t skipped = 0, zeros = 0;
+    double lo = min_, hi = max_, sum = 0.0, sum_squares = 0.0;
+    for (size_t i = 0; i < num; ++i) {
+        double v = static_cast<double>(values[i]);
+        double magnitude = std::fabs(v);
+        if (magnitude > kMinIndexable) {
+            stores[std::signbit(v)]->add(key(magnitude), 1, max_buckets_);
+        } else if (v == v) {
+            ++zeros;
+        } else {
+            ++skipped;
+            continue;
+        }
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+        sum += v;
+        sum_squares += v * v;
+    }
+    zero_count_ += zeros;
+    count_ += num - skipped;
+    min_ = lo;
+    max_ = hi;
+    sum_ += sum;
+    sum_squares_ += sum_squares;
+}
+
+// The cubic interpolation of log2 between powers of two from DDSketch: the
+// exponent plus a polynomial of the mantissa, close to the exact logarithm
+// at a fraction of its cost. The keys are scaled so that the buckets still
+// span the required ratio, see the constructor.
+inline int32_t QuantileSketch::key(double value) const {
+    const double kA = 6.0 / 35.0, kB = -3.0 / 5.0, kC = 10.0 / 7.0;
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    double exponent = static_cast<double>(static_cast<int>(bits >> 52) - 1023);
+    uint64_t mantissa_bits =
+        (bits & ((static_cast<uint64_t>(1) << 52) - 1)) |
+        (static_cast<uint64_t>(1023) << 52);
+    double s;
+    memcpy(&s, &mantissa_bits, sizeof(s));
+    s -= 1.0;
+    double index = (((kA * s + kB) * s + kC) * s + exponent) * multiplier_;
+    // floor(), without the call
+    auto truncated = static_cast<int32_t>(index);
+    return index < truncated ? truncated - 1 : truncated;
+}
+
+#endif  // QUANTILE_SKETCH_H
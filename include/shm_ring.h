@@ -0,0 +1,206 @@
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "sink.h"
+#include "tensorboard_logger.h"
+
+// Ring buffer of records in POSIX shared memory, written by any number of
+// processes and drained by one collector, so that the workers of a
+// data-parallel job log into a single event file without touching the disk:
+//
+//   // collector, in one process or in the tb_shm_collector daemon
+//   auto ring = ShmRing::create("/run42", 64 << 20);
+//   TensorBoardLogger logger("run42.tfevents.pb");
+//   ShmRingCollector collector(*ring, logger);
+//
+//   // every worker
+//   auto ring = ShmRing::open("/run42");
+//   TensorBoardLogger logger("run42.tfevents.pb",
+//       TensorBoardLoggerOptions().sink_factory(shm_ring_sink(ring)));
+//   logger.add_scalar("loss", step, loss);
+//
+// Producers reserve space with a compare-and-swap on the head, copy their
+// record and publish it by storing its header; the collector hands records
+// to a callback in reservation order and zeroes the space it gives back. A
+// producer that dies between reserving and publishing stalls the ring,
+// everything behind it is lost.
+//
+// Linux and other POSIX systems only; elsewhere create() and open() throw.
+class ShmRing {
+   public:
+    // Creates the ring `name` (a POSIX shm name such as "/run42"), replacing
+    // any ring of that name, with room for `capacity` bytes of records,
+    // rounded up to a power of two. Throws std::runtime_error.
+    static std::shared_ptr<ShmRing> create(const std::string &name,
+                                           size_t capacity);
+    // Attaches to a ring created by another process. Throws
+    // std::runtime_error.
+    static std::shared_ptr<ShmRing> open(const std::string &name);
+
+    ~ShmRing();
+    ShmRing(const ShmRing &) = delete;
+    ShmRing &operator=(const ShmRing &) = delete;
+
+    // Removes the name, attached processes keep their mapping.
+    void unlink();
+
+    // Appends the concatenation of `buffers` as one record. Returns false if
+    // the ring is full. Throws std::invalid_argument for a record larger than
+    // max_record_size().
+    bool try_push(const Sink::Buffer *buffers, size_t num);
+    bool try_push(const char *data, size_t size) {
+        Sink::Buffer buffer = {data, size};
+        return try_push(&buffer, 1);
+    }
+
+    // Calls fn(data, size) for each published record, in order, until it
+    // finds one that is still being written. Returns the number of records.
+    // Only one process may drain a ring.
+    template <typename F>
+    size_t drain(F fn);
+
+    size_t capacity() const { return capacity_; }
+    size_t max_record_size() const { return capacity_ / 4 - kHeaderSize; }
+    const std::string &name() const { return name_; }
+
+    // Records dropped by producers that found the ring full, over all
+    // processes.
+    uint64_t dropped() const {
+        return __atomic_load_n(&control_->dropped, __ATOMIC_RELAXED);
+    }
+    void add_dropped() {
+        __atomic_fetch_add(&control_->dropped, 1, __ATOMIC_RELAXED);
+    }
+
+   private:
+    // In the shared memory, before the records. Positions count bytes since
+    // the creation of the ring and are taken modulo the capacity.
+    struct Control {
+        uint64_t magic;
+        uint64_t capacity;
+        alignas(64) uint64_t head;  // reserved by producers
+        alignas(64) uint64_t tail;  // given back by the collector
+        alignas(64) uint64_t dropped;
+    };
+
+    // Every record starts with an 8-byte header, (size << 8) | kind, and is
+    // padded to 8 bytes. 0 marks space not published yet.
+    static const size_t kHeaderSize = 8;
+    enum Kind : uint64_t {
+        kRecord = 1,
+        kPadding = 2,  // fills the end of the ring when a record wraps
+    };
+
+    static size_t padded(size_t size) { return (size + 7) & ~size_t(7); }
+
+    ShmRing(const std::string &name, void *mapping, size_t mapping_size);
+
+    std::string name_;
+    void *mapping_;
+    size_t mapping_size_;
+    Control *control_;
+    char *records_;
+    size_t capacity_;
+};
+
+template <typename F>
+size_t ShmRing::drain(F fn) {
+    uint64_t tail = __atomic_load_n(&control_->tail, __ATOMIC_RELAXED);
+    uint64_t head = __atomic_load_n(&control_->head, __ATOMIC_ACQUIRE);
+    uint64_t given_back = tail;
+    size_t num_records = 0;
+    while (tail < head) {
+        char *slot = records_ + (tail & (capacity_ - 1));
+        uint64_t header = __atomic_load_n(reinterpret_cast<uint64_t *>(slot),
+                                          __ATOMIC_ACQUIRE);
+        if (header == 0) break;  // reserved, but still being written
+        size_t size = static_cast<size_t>(header >> 8);
+        size_t slot_size = size;
+        if ((header & 0xff) == kRecord) {
+            fn(static_cast<const char *>(slot + kHeaderSize), size);
+            ++num_records;
+            slot_size = padded(kHeaderSize + size);
+        }
+        // producers expect zeroed space
+        memset(slot, 0, slot_size);
+        tail += slot_size;
+        // give space back as we go, producers may be waiting for it
+        if (tail - given_back >= capacity_ / 4) {
+            __atomic_store_n(&control_->tail, tail, __ATOMIC_RELEASE);
+            given_back = tail;
+        }
+    }
+    __atomic_store_n(&control_->tail, tail, __ATOMIC_RELEASE);
+    return num_records;
+}
+
+// Writes the records of a worker's logger into a ring, see ShmRing. Every
+// write is one record of the ring, which holds whole event records since the
+// logger passes whole records to its sink. When the ring is full, it waits
+// for the collector if `block`, otherwise drops the write and counts it in
+// ShmRing::dropped().
+class ShmRingSink : public Sink {
+   public:
+    ShmRingSink(std::shared_ptr<ShmRing> ring, bool block)
+        : ring_(std::move(ring)), block_(block) {}
+
+    void write(const char *data, size_t size) override {
+        Buffer buffer = {data, size};
+        writev(&buffer, 1);
+    }
+    void writev(const Buffer *buffers, size_t num) override;
+    // Records are handed over as they are written.
+    void flush() override {}
+    void close() override {}
+    uint64_t size() const override { return size_; }
+    bool on_disk() const override { return false; }
+    bool shared() const override { return true; }
+    // every write is an entry of the ring, which the collector counts and
+    // which holds a quarter of the ring at most
+    bool whole_records() const override { return true; }
+
+   private:
+    std::shared_ptr<ShmRing> ring_;
+    bool block_;
+    uint64_t size_ = 0;
+};
+
+// For TensorBoardLoggerOptions::sink_factory.
+SinkFactory shm_ring_sink(std::shared_ptr<ShmRing> ring, bool block = true);
+
+// Drains a ring into a logger on a thread of its own, polling every
+// `poll_interval_us` while the ring is empty. The destructor, or stop(),
+// drains what is left once the producers are done.
+class ShmRingCollector {
+   public:
+    ShmRingCollector(ShmRing &ring, TensorBoardLogger &logger,
+                     size_t poll_interval_us = 500);
+    ~ShmRingCollector();
+    ShmRingCollector(const ShmRingCollector &) = delete;
+    ShmRingCollector &operator=(const ShmRingCollector &) = delete;
+
+    void stop();
+
+    // Records written to the logger so far.
+    uint64_t num_records() const { return num_records_.load(); }
+
+   private:
+    void run();
+
+    ShmRing &ring_;
+    TensorBoardLogger &logger_;
+    size_t poll_interval_us_;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> num_records_{0};
+    std::thread thread_;
+};
+
+#endif  // SHM_RING_H
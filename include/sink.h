@@ -0,0 +1,124 @@
+#ifndef SINK_H
+#define SINK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+
+// Where the bytes of an event file go. The logger calls a sink from one
+// thread at a time, under its file lock; sinks are not thread safe. Failures
+// throw std::runtime_error.
+class Sink {
+   public:
+    struct Buffer {
+        const char *data;
+        size_t size;
+    };
+
+    virtual ~Sink() {}
+
+    virtual void write(const char *data, size_t size) = 0;
+    // Append the buffers in order, e.g. the header, payload and footer of a
+    // record, without concatenating them first.
+    virtual void writev(const Buffer *buffers, size_t num) {
+        for (size_t i = 0; i < num; ++i) {
+            write(buffers[i].data, buffers[i].size);
+        }
+    }
+
+    // Hand everything written so far over to the OS (or to whatever is
+    // behind the sink).
+    virtual void flush() = 0;
+    // Flush, then close. Further calls do nothing.
+    virtual void close() = 0;
+
+    // Make what was flushed durable, e.g. with fdatasync(2). Returns false
+    // if the sink cannot, in which case the logger syncs the file by name.
+    // Unlike the other calls, it may run while another thread writes to the
+    // sink, but not while the sink is being closed.
+    virtual bool sync() { return false; }
+
+    // Bytes in the file, including the ones it held when it was opened.
+    virtual uint64_t size() const = 0;
+
+    // Whether the bytes end up in the file the sink was opened with, so that
+    // they can be synced: by sync(), or by file name once the sink is
+    // retired.
+    virtual bool on_disk() const { return true; }
+
+    // Whether other loggers write to the same destination, whose owner then
+    // starts the file with its version record instead of every logger.
+    virtual bool shared() const { return false; }
+
+    // Whether every write() must hold exactly one record, e.g. because the
+    // sink hands each write over as a record of its own. The async writer
+    // then writes its batches a record at a time.
+    virtual bool whole_records() const { return false; }
+};
+
+// How the logger writes its event files, see
+// TensorBoardLoggerOptions::sink.
+enum class SinkType {
+    // write(2) on a file descriptor, from a large aligned buffer; records
+    // that do not fit go out with a single writev(2)
+    kPosix,
+    // like kPosix, but full buffers are written by io_uring while the next
+    // one fills up; falls back to kPosix where io_uring is not available
+    kIoUring,
+    // std::ofstream, as in earlier versions
+    kStream,
+};
+
+// Opens `filename` for writing, truncating it unless `append`. kPosix and
+// kIoUring buffer `buffer_bytes` (0 writes every call through), and reserve
+// disk space beyond the end of the file `preallocate_bytes` at a time (0
+// disables it) to limit fragmentation; what is left unused is given back when
+// the sink is closed.
+std::unique_ptr<Sink> open_file_sink(SinkType type, const std::string &filename,
+                                     bool append, size_t buffer_bytes,
+                                     size_t preallocate_bytes);
+
+// Builds the sink of each event file the logger opens, e.g. to keep the
+// events in memory or upload them:
+//
+//   options.sink_factory([&](const std::string &, bool) {
+//       return std::unique_ptr<Sink>(new CallbackSink(
+//           [&](const char *data, size_t size) { out.append(data, size); }));
+//   });
+typedef std::function<std::unique_ptr<Sink>(const std::string &filename,
+                                            bool append)>
+    SinkFactory;
+
+// Passes the bytes to a callback instead of writing them to a file.
+class CallbackSink : public Sink {
+   public:
+    typedef std::function<void(const char *data, size_t size)> WriteFn;
+    explicit CallbackSink(WriteFn on_write,
+                          std::function<void()> on_flush = nullptr)
+        : on_write_(std::move(on_write)), on_flush_(std::move(on_flush)) {}
+
+    void write(const char *data, size_t size) override {
+        on_write_(data, size);
+        size_ += size;
+    }
+    void flush() override {
+        if (on_flush_) on_flush_();
+    }
+    void close() override {
+        if (!closed_) flush();
+        closed_ = true;
+    }
+    uint64_t size() const override { return size_; }
+    bool on_disk() const override { return false; }
+
+   private:
+    WriteFn on_write_;
+    std::function<void()> on_flush_;
+    uint64_t size_ = 0;
+    bool closed_ = false;
+};
+
+#endif  // SINK_H
@@ -2,14 +2,34 @@
 #define TENSORBOARD_LOGGER_H
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "bounded_queue.h"
 #include "event.pb.h"
+#include "histogram.h"
+#include "logger_stats.h"
 #include "plugin_data.pb.h"
+#include "png_encoder.h"
+#include "projector_config.pb.h"
+#include "quantile_sketch.h"
+#include "sink.h"
+#include "thread_pool.h"
 using ::google::protobuf::Value;
 using std::map;
 using std::string;
@@ -27,6 +47,32 @@ const std::string kProjectorPluginName = "projector";
 const std::string kTextPluginName = "text";
 const std::string kSessionStartInfoTag = "_hparams_/session_start_info";
 const std::string kHparamsPluginName = "hparams";
+const std::string kEventFileVersion = "brain.Event:2";
+
+// What an asynchronous logger does with a new record when its queue is full.
+enum class OverflowPolicy {
+    kBlock,  // wait until the writer thread makes room, or the logger closes
+    kDropNewest,  // discard the new record
+    kDropOldest,  // discard the oldest queued record to make room
+};
+
+// How far the logger pushes events towards the disk on its own, see
+// TensorBoardLoggerOptions::durability.
+enum class Durability {
+    kBuffered,  // only the periodic flush of flush_period_s
+    kFlush,     // hand the events over to the OS
+    kSync,      // and have the OS write them to the disk (fdatasync)
+};
+
+// Bytes owned by the caller, e.g. an encoded image kept in a buffer other
+// than a std::string (std::string_view before C++17).
+struct BytesView {
+    BytesView(const char *data, size_t size) : data(data), size(size) {}
+    BytesView(const std::string &s) : data(s.data()), size(s.size()) {}
+
+    const char *data;
+    size_t size;
+};
 
 struct TensorBoardLoggerOptions {
     // Log is flushed whenever this many entries have been written since the
@@ -44,102 +90,299 @@ struct TensorBoardLoggerOptions {
         return *this;
     }
 
+    // Beyond kBuffered, events are flushed or synced every
+    // durability_period_ms_ and/or every durability_bytes_ written, by the
+    // flusher thread so that writers never wait for the disk. 0 disables
+    // either trigger. TensorBoardLogger::flush() and sync_until() do the same
+    // on demand.
+    Durability durability_ = Durability::kBuffered;
+    TensorBoardLoggerOptions &durability(Durability durability) {
+        durability_ = durability;
+        return *this;
+    }
+
+    size_t durability_period_ms_ = 0;
+    TensorBoardLoggerOptions &durability_period_ms(
+        size_t durability_period_ms) {
+        durability_period_ms_ = durability_period_ms;
+        return *this;
+    }
+
+    size_t durability_bytes_ = 0;
+    TensorBoardLoggerOptions &durability_bytes(size_t durability_bytes) {
+        durability_bytes_ = durability_bytes;
+        return *this;
+    }
+
+    // How event files are written, see SinkType. Buffered bytes reach the OS
+    // when the buffer fills up and on every flush.
+    SinkType sink_ = SinkType::kPosix;
+    TensorBoardLoggerOptions &sink(SinkType sink) {
+        sink_ = sink;
+        return *this;
+    }
+
+    size_t sink_buffer_bytes_ = 1 << 20;
+    TensorBoardLoggerOptions &sink_buffer_bytes(size_t sink_buffer_bytes) {
+        sink_buffer_bytes_ = sink_buffer_bytes;
+        return *this;
+    }
+
+    // Disk space reserved ahead of the writes, e.g. max_file_bytes_ to lay
+    // out each file in one extent. 0 disables it.
+    size_t preallocate_bytes_ = 0;
+    TensorBoardLoggerOptions &preallocate_bytes(size_t preallocate_bytes) {
+        preallocate_bytes_ = preallocate_bytes;
+        return *this;
+    }
+
+    // Replaces sink_: called with the name of every event file and whether
+    // to append to it. Resuming still repairs the files on disk.
+    SinkFactory sink_factory_;
+    TensorBoardLoggerOptions &sink_factory(SinkFactory sink_factory) {
+        sink_factory_ = std::move(sink_factory);
+        return *this;
+    }
+
+    // Append to an existing event file instead of truncating it. A record
+    // torn by a crash at the end of the file is cut off first, see
+    // TensorBoardLogger::resume_info().
     bool resume_ = false;
     TensorBoardLoggerOptions &resume(bool resume) {
         resume_ = resume;
         return *this;
     }
+
+    // How many bytes at the end of the file are checked when resuming, and
+    // looked at for the last step of each tag.
+    size_t resume_scan_bytes_ = 1 << 20;
+    TensorBoardLoggerOptions &resume_scan_bytes(size_t resume_scan_bytes) {
+        resume_scan_bytes_ = resume_scan_bytes;
+        return *this;
+    }
+
+    // When resuming from a checkpoint of this step, drop the events logged
+    // after it, which would otherwise be logged twice, from the rotated
+    // files as well. Negative keeps everything.
+    int64_t restore_step_ = -1;
+    TensorBoardLoggerOptions &restore_step(int64_t restore_step) {
+        restore_step_ = restore_step;
+        return *this;
+    }
+
+    // Serialize events on the calling thread, but leave the file I/O to a
+    // dedicated writer thread fed through a lock-free queue. A failed write
+    // is thrown by the next flush(), sync_until() or close().
+    bool async_ = false;
+    TensorBoardLoggerOptions &async(bool async) {
+        async_ = async;
+        return *this;
+    }
+
+    // Capacity of the async queue in records, rounded up to a power of two.
+    size_t async_queue_size_ = 65536;
+    TensorBoardLoggerOptions &async_queue_size(size_t async_queue_size) {
+        async_queue_size_ = async_queue_size;
+        return *this;
+    }
+
+    OverflowPolicy overflow_policy_ = OverflowPolicy::kBlock;
+    TensorBoardLoggerOptions &overflow_policy(OverflowPolicy overflow_policy) {
+        overflow_policy_ = overflow_policy;
+        return *this;
+    }
+
+    // Size of the worker pool used for bulk work such as add_histograms(),
+    // 0 for one thread per hardware thread. The pool is created on first use.
+    size_t num_threads_ = 0;
+    TensorBoardLoggerOptions &num_threads(size_t num_threads) {
+        num_threads_ = num_threads;
+        return *this;
+    }
+
+    // How add_image_raw() and add_images_raw() encode PNGs.
+    PngOptions png_;
+    TensorBoardLoggerOptions &png(const PngOptions &png) {
+        png_ = png;
+        return *this;
+    }
+
+    // Every this many seconds, the flusher logs the logger's own stats()
+    // as "_logger/..." scalars at the last step logged. 0 disables it.
+    size_t stats_period_s_ = 0;
+    TensorBoardLoggerOptions &stats_period_s(size_t stats_period_s) {
+        stats_period_s_ = stats_period_s;
+        return *this;
+    }
+
+    // Move on to a new event file once the current one holds this many
+    // bytes, 0 for no limit. Files are only switched between records.
+    size_t max_file_bytes_ = 0;
+    TensorBoardLoggerOptions &max_file_bytes(size_t max_file_bytes) {
+        max_file_bytes_ = max_file_bytes;
+        return *this;
+    }
+
+    // Move on to a new event file once the current one is this old, 0 for no
+    // limit.
+    size_t max_file_age_s_ = 0;
+    TensorBoardLoggerOptions &max_file_age_s(size_t max_file_age_s) {
+        max_file_age_s_ = max_file_age_s;
+        return *this;
+    }
+
+    // Name of the event files following the first one, which is the file
+    // passed to the constructor. "{base}" stands for that file and "{index}"
+    // for the index of the file, zero-padded to 6 digits so that files sort
+    // in the order they were written. The basename must keep the "tfevents"
+    // substring.
+    std::string file_name_template_ = "{base}.{index}";
+    TensorBoardLoggerOptions &file_name_template(
+        const std::string &file_name_template) {
+        file_name_template_ = file_name_template;
+        return *this;
+    }
+};
+
+// How add_scalar() thins out a high-frequency tag, see
+// TensorBoardLogger::set_scalar_policy(). A step is logged if it is at least
+// every_n_steps_ past the last logged step of the tag and at least
+// min_interval_ms_ has passed since then; the first step always is.
+struct ScalarPolicy {
+    size_t every_n_steps_ = 1;
+    ScalarPolicy &every_n_steps(size_t every_n_steps) {
+        every_n_steps_ = every_n_steps;
+        return *this;
+    }
+
+    size_t min_interval_ms_ = 0;
+    ScalarPolicy &min_interval_ms(size_t min_interval_ms) {
+        min_interval_ms_ = min_interval_ms;
+        return *this;
+    }
+
+    // Instead of the value of the logged step, log the mean, min and max of
+    // all values since the previous logged step, as "<tag>/mean",
+    // "<tag>/min" and "<tag>/max". Lazy metrics are then evaluated on every
+    // step.
+    bool aggregate_ = false;
+    ScalarPolicy &aggregate(bool aggregate) {
+        aggregate_ = aggregate;
+        return *this;
+    }
+};
+
+// One tensor of an add_histograms() call. The values are not copied and must
+// stay alive until add_histograms() returns.
+struct HistogramInput {
+    template <typename T>
+    HistogramInput(const std::string &tag, const T *values, size_t num)
+        : HistogramInput(tag, HistogramView<T>(values, num)) {}
+    template <typename T>
+    HistogramInput(const std::string &tag, const std::vector<T> &values)
+        : HistogramInput(tag, values.data(), values.size()) {}
+    template <typename T>
+    HistogramInput(const std::string &tag, const HistogramView<T> &view)
+        : tag(tag),
+          values(view.values),
+          num(view.num),
+          stride(view.stride),
+          mask(view.mask),
+          add_chunk(&add_chunk_of<T>) {}
+
+    std::string tag;
+    const void *values;
+    size_t num;
+    size_t stride;
+    const uint8_t *mask;
+    void (*add_chunk)(Histogram *histogram, const HistogramInput &input,
+                      size_t chunk);
+
+   private:
+    template <typename T>
+    static void add_chunk_of(Histogram *histogram, const HistogramInput &input,
+                             size_t chunk) {
+        histogram->add_chunk(
+            HistogramView<T>(static_cast<const T *>(input.values), input.num,
+                             input.stride, input.mask),
+            chunk);
+    }
+};
+
+// Activity of the async writer, see TensorBoardLoggerOptions::async.
+struct AsyncWriterCounters {
+    uint64_t enqueued = 0;  // records accepted into the queue
+    uint64_t written = 0;   // records written out by the writer thread
+    uint64_t dropped = 0;   // discarded by the overflow policy or lost to
+                            // a failed write
+    uint64_t blocked = 0;   // enqueues that had to wait for room
+    uint64_t batches = 0;   // file writes issued by the writer thread
+};
+
+// What the logger found in the files it resumed: the last one, and with
+// TensorBoardLoggerOptions::restore_step the rotated files before it whose
+// events were all dropped, up to one keeping some.
+struct ResumeInfo {
+    uint64_t torn_bytes = 0;       // partial records cut off the ends
+    uint64_t dropped_records = 0;  // events past restore_step removed
+    // Last step logged for each tag, merged over the files. Only the tail
+    // of each file is scanned (resume_scan_bytes), so a tag last logged
+    // before the tails, or in an earlier file, is missing.
+    std::map<std::string, int64_t> last_steps;
 };
 
+class EmbeddingWriter;
+class ProjectorConfigBatch;
+class ScalarHandle;
+class StepBatch;
+
 class TensorBoardLogger {
    public:
     explicit TensorBoardLogger(const std::string &log_file,
-                               const TensorBoardLoggerOptions &options = {}) {
-        this->options = options;
-        auto basename = get_basename(log_file);
-        if (basename.find("tfevents") == std::string::npos) {
-            throw std::runtime_error(
-                "A valid event file must contain substring \"tfevents\" in its "
-                "basename, got " +
-                basename);
-        }
-        bucket_limits_ = nullptr;
-        ofs_ = new std::ofstream(
-            log_file, std::ios::out |
-                          (options.resume_ ? std::ios::app : std::ios::trunc) |
-                          std::ios::binary);
-        if (!ofs_->is_open()) {
-            throw std::runtime_error("failed to open log_file " + log_file);
-        }
-        log_dir_ = get_parent_dir(log_file);
-
-        flushing_thread = std::thread(&TensorBoardLogger::flusher, this);
-    }
-    ~TensorBoardLogger() {
-        ofs_->close();
-        delete ofs_;
-        if (bucket_limits_ != nullptr) {
-            delete bucket_limits_;
-            bucket_limits_ = nullptr;
-        }
-
-        stop = true;
-        if (flushing_thread.joinable()) {
-            flushing_thread.join();
-        }
-    }
+                               const TensorBoardLoggerOptions &options = {});
+    ~TensorBoardLogger();
 
     int add_hparams(const map<string, Value> &hparams, const string &group_name,
                     double start_time_secs);
     int add_scalar(const std::string &tag, int step, double value);
     int add_scalar(const std::string &tag, int step, float value);
 
+    // Lazy variant for expensive metrics: `metric()` is only called if the
+    // policy of the tag keeps the step.
+    template <typename F, typename = decltype(static_cast<double>(
+                              std::declval<F &>()()))>
+    int add_scalar(const std::string &tag, int step, F &&metric) {
+        auto admission = admit_scalar(tag, step);
+        if (admission == ScalarAdmission::kDrop) return 0;
+        return add_admitted_scalar(tag, step, admission,
+                                   static_cast<double>(metric()));
+    }
+
+    // Handle for logging the scalars of `tag` without re-encoding the tag,
+    // see ScalarHandle.
+    ScalarHandle scalar_handle(const std::string &tag);
+
+    // Decimate or aggregate the scalars of `tag` logged with add_scalar(),
+    // before any event is built. Takes effect for the following steps;
+    // ScalarPolicy() logs every step again.
+    void set_scalar_policy(const std::string &tag, const ScalarPolicy &policy);
+
     // https://github.com/dmlc/tensorboard/blob/master/python/tensorboard/summary.py#L127
+    // T is float, double, Float16, BFloat16 or an integer type.
     template <typename T>
     int add_histogram(const std::string &tag, int step, const T *value,
                       size_t num) {
-        if (bucket_limits_ == nullptr) {
-            generate_default_buckets();
-        }
+        return add_histogram(tag, step, HistogramView<T>(value, num));
+    };
 
-        std::vector<int> counts(bucket_limits_->size(), 0);
-        double min = std::numeric_limits<double>::max();
-        double max = std::numeric_limits<double>::lowest();
-        double sum = 0.0;
-        double sum_squares = 0.0;
-        for (size_t i = 0; i < num; ++i) {
-            T v = value[i];
-            auto lb = std::lower_bound(bucket_limits_->begin(),
-                                       bucket_limits_->end(), v);
-            counts[lb - bucket_limits_->begin()]++;
-            sum += v;
-            sum_squares += v * v;
-            if (v > max) {
-                max = v;
-            } else if (v < min) {
-                min = v;
-            }
-        }
-
-        auto *histo = new tensorflow::HistogramProto();
-        histo->set_min(min);
-        histo->set_max(max);
-        histo->set_num(num);
-        histo->set_sum(sum);
-        histo->set_sum_squares(sum_squares);
-        for (size_t i = 0; i < counts.size(); ++i) {
-            if (counts[i] > 0) {
-                histo->add_bucket_limit((*bucket_limits_)[i]);
-                histo->add_bucket(counts[i]);
-            }
-        }
-
-        auto *summary = new tensorflow::Summary();
-        auto *v = summary->add_value();
-        v->set_tag(tag);
-        v->set_allocated_histo(histo);
-
-        return add_event(step, summary);
+    // strided and/or masked values, read in place
+    template <typename T>
+    int add_histogram(const std::string &tag, int step,
+                      const HistogramView<T> &view) {
+        StatsScope scope(stats_, EventKind::kHistogram);
+        auto *event = scratch_event(step);
+        fill_histogram(event->mutable_summary()->add_value(), tag, view);
+        return write_scratch_event(event);
     };
 
     template <typename T>
@@ -148,24 +391,107 @@ class TensorBoardLogger {
         return add_histogram(tag, step, values.data(), values.size());
     };
 
+    // everything `accumulator` has seen so far
+    int add_histogram(const std::string &tag, int step,
+                      const HistogramAccumulator &accumulator);
+    // with the relative-error buckets of the sketch instead of the default
+    // ones
+    int add_histogram(const std::string &tag, int step,
+                      const QuantileSketch &sketch);
+
+    // Histograms of many tensors, e.g. all weights and gradients of a model:
+    //
+    //   logger.add_histograms(step, {{"fc1/w", w1, n1}, {"fc1/grad", g1, n1}});
+    //
+    // Large tensors are split into chunks, all chunks are reduced on the
+    // worker pool (see TensorBoardLoggerOptions::num_threads), and the
+    // results are written as a single event. They are identical to what
+    // add_histogram() gives for each tensor.
+    int add_histograms(int step, const std::vector<HistogramInput> &inputs);
+
     // metadata (such as display_name, description) of the same tag will be
     // stripped to keep only the first one.
+    //
+    // Large images and audio are not copied into the event: the rest of the
+    // event is serialized around them, and they are checksummed and handed
+    // to the sink straight from the caller's buffers (an async logger still
+    // copies them once into its queue).
     int add_image(const std::string &tag, int step,
                   const std::string &encoded_image, int height, int width,
                   int channel, const std::string &display_name = "",
                   const std::string &description = "");
+    int add_image(const std::string &tag, int step, BytesView encoded_image,
+                  int height, int width, int channel,
+                  const std::string &display_name = "",
+                  const std::string &description = "");
     int add_images(const std::string &tag, int step,
                    const std::vector<std::string> &encoded_images, int height,
                    int width, const std::string &display_name = "",
                    const std::string &description = "");
+    int add_images(const std::string &tag, int step,
+                   const BytesView *encoded_images, size_t num_images,
+                   int height, int width, const std::string &display_name = "",
+                   const std::string &description = "");
+
+    // Images as raw 8-bit pixels, height x width x channel bytes with 1 to
+    // 4 channels (see encode_png()). The pixels are copied and the call
+    // returns right away: encoding to PNG and writing the event happen on
+    // the worker pool, the batch variant encoding its images in parallel.
+    // The future yields add_image()'s result or rethrows its error; flush()
+    // and close() wait for pending images.
+    std::future<int> add_image_raw(const std::string &tag, int step,
+                                   const uint8_t *hwc, int height, int width,
+                                   int channel,
+                                   const std::string &display_name = "",
+                                   const std::string &description = "");
+    // `nhwc` holds `num_images` images stored one after the other.
+    std::future<int> add_images_raw(const std::string &tag, int step,
+                                    const uint8_t *nhwc, size_t num_images,
+                                    int height, int width, int channel,
+                                    const std::string &display_name = "",
+                                    const std::string &description = "");
     int add_audio(const std::string &tag, int step,
                   const std::string &encoded_audio, float sample_rate,
                   int num_channels, int length_frame,
                   const std::string &content_type,
                   const std::string &display_name = "",
                   const std::string &description = "");
+    int add_audio(const std::string &tag, int step, BytesView encoded_audio,
+                  float sample_rate, int num_channels, int length_frame,
+                  const std::string &content_type,
+                  const std::string &display_name = "",
+                  const std::string &description = "");
+    // Float PCM, `frames` frames of `channels` interleaved samples, encoded
+    // as a 16-bit WAV file straight into the event (see encode_wav()).
+    int add_audio_pcm(const std::string &tag, int step, const float *samples,
+                      size_t frames, int channels, float sample_rate,
+                      const std::string &display_name = "",
+                      const std::string &description = "");
+    // `num_clips` clips of the same length stored one after the other,
+    // logged in one event as "tag/audio/0", "tag/audio/1", ... like
+    // TensorFlow's audio summaries. Long clips are encoded on the worker
+    // pool.
+    int add_audios_pcm(const std::string &tag, int step, const float *clips,
+                       size_t num_clips, size_t frames, int channels,
+                       float sample_rate, const std::string &display_name = "",
+                       const std::string &description = "");
     int add_text(const std::string &tag, int step, const char *text);
 
+    // Precision-recall curve of a binary classifier for the PR curves
+    // plugin, at thresholds i / (num_thresholds - 1). Predictions are
+    // clamped to [0, 1], labels are positive when nonzero and `weights` may
+    // be nullptr for all ones (see bin_pr_predictions()). Large inputs are
+    // binned on the worker pool, with one set of counts per thread; sums of
+    // weights may then differ in the last bits with the number of threads.
+    // Throws std::invalid_argument unless num_thresholds is in
+    // [2, kMaxPrCurveThresholds].
+    int add_pr_curve(const std::string &tag, int step,
+                     const float *predictions, const uint8_t *labels,
+                     size_t num, uint32_t num_thresholds = 201,
+                     const float *weights = nullptr,
+                     const std::string &display_name = "",
+                     const std::string &description = "");
+
     // `tensordata` and `metadata` should be in tsv format, and should be
     // manually created before calling `add_embedding`
     //
@@ -192,23 +518,367 @@ class TensorBoardLogger {
         const std::vector<std::string> &metadata = std::vector<std::string>(),
         const std::string &metadata_filename = "",
         int step = 1 /* no effect */);
+    // For embeddings written in pieces, see EmbeddingWriter.
+
+    // The projector config is kept in memory and rewritten atomically (temp
+    // file + rename) by every add_embedding(), unless a batch is alive: then
+    // it is written once, when the last batch goes away.
+    //
+    //   {
+    //       auto batch = logger.batch_projector_config();
+    //       for (...) logger.add_embedding(...);
+    //   }
+    ProjectorConfigBatch batch_projector_config();
+
+    // Start collecting the summaries of `step` into a single event, which is
+    // written with one record when the returned batch is committed:
+    //
+    //   auto batch = logger.begin_step(step);
+    //   batch.scalar("loss", loss).histogram("weights", weights);
+    //   batch.commit();
+    StepBatch begin_step(int step);
+
+    // Counters of the async writer, all zero if it is not enabled.
+    AsyncWriterCounters async_counters() const;
+
+    // Call counts, latencies, bytes, lock waits and flusher activity since
+    // the logger was created. The counters are kept per thread and only
+    // added up here, so that keeping them costs the logging threads next to
+    // nothing.
+    LoggerStats stats() const { return stats_.snapshot(); }
+
+    // Append records that are already framed the way the logger frames
+    // events, e.g. drained from a ShmRing. `data` must hold whole records,
+    // files are only rotated between calls.
+    int write_records(const char *data, size_t size);
+
+    // Hand everything logged so far over to the OS, waiting for the async
+    // writer to write out what is queued. Throws the first error the
+    // background threads ran into since it was last reported, if any: a
+    // failed write of the async writer, or a failed periodic flush or sync,
+    // rotation or stats event of the flusher.
+    int flush();
+
+    // Make everything logged so far durable on disk, e.g. before committing
+    // the checkpoint of `step`. Calls for a step at or below one that was
+    // already synced return right away, steps are assumed to be logged in
+    // order. Throws std::runtime_error if the files cannot be synced, and
+    // like flush() an error of the background threads not reported yet.
+    int sync_until(int64_t step);
+
+    // Write out everything and close the files; called by the destructor.
+    // Logging afterwards throws std::runtime_error. Like flush(), throws an
+    // error of the background threads not reported yet.
+    void close();
+
+    // Empty unless the logger was created with resume(true).
+    const ResumeInfo &resume_info() const { return resume_info_; }
 
    private:
-    int generate_default_buckets();
+    friend class EmbeddingWriter;
+    friend class ProjectorConfigBatch;
+    friend class ScalarHandle;
+    friend class StepBatch;
+
+    enum class ScalarAdmission {
+        kWrite,      // log the value as is
+        kDrop,       // skip the step
+        kAggregate,  // add the value to the window of the tag
+    };
+    struct ScalarPolicyState {
+        ScalarPolicy policy;
+        bool logged = false;
+        int64_t last_step = 0;
+        std::chrono::steady_clock::time_point last_time;
+        // values since the last logged step, when aggregating
+        size_t count = 0;
+        double sum = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+    };
+    static bool scalar_due(const ScalarPolicyState &state, int64_t step);
+    ScalarAdmission admit_scalar(const std::string &tag, int step);
+    int add_admitted_scalar(const std::string &tag, int step,
+                            ScalarAdmission admission, double value);
+
+    template <typename T>
+    void fill_histogram(Summary::Value *v, const std::string &tag,
+                        const HistogramView<T> &view) {
+        // reused across calls, so that the counts are allocated once per
+        // thread
+        static thread_local Histogram histogram;
+        histogram.clear();
+        histogram.add(view);
+        fill_histogram(v, tag, histogram);
+    }
+    static void fill_histogram(Summary::Value *v, const std::string &tag,
+                               const Histogram &histogram);
+    static void fill_histogram(Summary::Value *v, const std::string &tag,
+                               const QuantileSketch &sketch);
+    static void fill_scalar(Summary::Value *v, const std::string &tag,
+                            double value);
+    static void fill_image(Summary::Value *v, const std::string &tag,
+                           const std::string &encoded_image, int height,
+                           int width, int channel,
+                           const std::string &display_name,
+                           const std::string &description);
+    static void fill_images(Summary::Value *v, const std::string &tag,
+                            const std::vector<std::string> &encoded_images,
+                            int height, int width,
+                            const std::string &display_name,
+                            const std::string &description);
+    static void fill_audio(Summary::Value *v, const std::string &tag,
+                           const std::string &encoded_audio, float sample_rate,
+                           int num_channels, int length_frame,
+                           const std::string &content_type,
+                           const std::string &display_name,
+                           const std::string &description);
+    static void fill_audio_pcm(Summary::Value *v, const std::string &tag,
+                               const float *samples, size_t frames,
+                               int channels, float sample_rate,
+                               const std::string &display_name,
+                               const std::string &description);
+    static void fill_text(Summary::Value *v, const std::string &tag,
+                          const char *text);
+
     int add_session_start_info(SessionStartInfo *session_start_info);
+    // The add_* methods build their event on a per-thread arena with
+    // scratch_event() and write it with write_scratch_event(); the event is
+    // reused by the next call on the same thread.
+    static Event *scratch_event(int64_t step);
+    int write_scratch_event(Event *event);
     int add_event(int64_t step, Summary *summary);
     int write(Event &event);
+    int write_record(const char *data, size_t size);
+    int write_record(const Sink::Buffer *parts, size_t num_parts);
+    // Writes an event of `step` with the summary `value`, whose field
+    // `value_field` is `message` plus the `payloads` as its bytes field
+    // `payload_field`, without copying the payloads.
+    int write_payload_event(int64_t step, const Summary::Value &value,
+                            int value_field,
+                            const google::protobuf::MessageLite &message,
+                            int payload_field, const BytesView *payloads,
+                            size_t num_payloads);
+    int enqueue(std::string &&record);
+    bool rotating() const {
+        return options.max_file_bytes_ > 0 || options.max_file_age_s_ > 0;
+    }
+    std::string event_file_name(size_t index) const;
+    std::unique_ptr<Sink> open_event_file(size_t index, bool resume,
+                                          size_t *file_bytes) const;
+    void after_write(size_t bytes_written);
+    void count_record(ThreadStats &stats, StatsScope *scope, uint64_t bytes);
+    std::unique_lock<std::mutex> lock_file(ThreadStats &stats);
+    void drain_async_writer();
+    void set_background_error(std::exception_ptr error);
+    void throw_background_error();
+    void sync_files(std::unique_lock<std::mutex> &lock);
+    void notify_async_writer();
+    void async_writer();
     void flusher();
+    void log_stats();
+    ThreadPool &thread_pool();
+    std::future<int> submit_image_task(std::function<int()> task);
+    void wait_for_image_tasks();
 
+    std::string log_file_;
     std::string log_dir_;
-    std::ofstream *ofs_;
-    std::vector<double> *bucket_limits_;
+    ResumeInfo resume_info_;
+    Sink *sink_;
     TensorBoardLoggerOptions options;
 
+    StatsRegistry stats_;
+    // step of the last event, for the _logger/* scalars
+    std::atomic<int64_t> last_step_{0};
+
     std::atomic<bool> stop{false};
+    std::atomic<bool> closed_{false};
     size_t queue_size{0};
     std::thread flushing_thread;
     std::mutex file_object_mtx{};
+
+    // Rotation, all guarded by file_object_mtx. The flusher thread opens the
+    // next file ahead of time and closes retired ones, so that writers only
+    // swap sinks.
+    std::condition_variable flusher_cv_;
+    size_t file_index_ = 0;
+    size_t file_bytes_ = 0;
+    std::chrono::steady_clock::time_point file_opened_;
+    std::unique_ptr<Sink> next_sink_;
+    size_t next_file_bytes_ = 0;
+    std::vector<std::unique_ptr<Sink>> retired_sinks_;
+
+    // Durability, guarded by file_object_mtx: files from synced_file_index_
+    // on may hold data that is not synced yet.
+    size_t bytes_since_durable_ = 0;
+    bool durable_requested_ = false;
+    size_t synced_file_index_ = 0;
+    // sync_files() calls syncing the current sink with the lock released,
+    // during which no sink is closed
+    size_t syncs_in_progress_ = 0;
+    std::condition_variable syncs_done_cv_;
+    std::mutex sync_mtx_;  // serializes sync_until()
+    int64_t synced_step_ = std::numeric_limits<int64_t>::min();
+
+    std::unique_ptr<BoundedQueue<std::string>> async_queue_;
+    std::thread async_writer_thread_;
+    std::atomic<bool> async_stop_{false};
+    std::atomic<bool> async_writer_idle_{false};
+    std::mutex async_mtx_;
+    std::condition_variable async_cv_;
+    std::atomic<uint64_t> async_enqueued_{0};
+    std::atomic<uint64_t> async_written_{0};
+    std::atomic<uint64_t> async_dropped_{0};
+    std::atomic<uint64_t> async_blocked_{0};
+    std::atomic<uint64_t> async_batches_{0};
+    // producers waiting for room with OverflowPolicy::kBlock, woken by the
+    // writer after it pops records and by close()
+    std::atomic<size_t> async_space_waiters_{0};
+    std::condition_variable async_space_cv_;
+    // producers between their closed_ check and the end of their push,
+    // which close() waits for before stopping the writer
+    std::atomic<size_t> async_producers_{0};
+    std::condition_variable async_producers_cv_;
+    // flush() asks the writer to report once the queue is empty
+    std::atomic<uint64_t> async_flush_requests_{0};
+    uint64_t async_flushed_ = 0;  // guarded by async_mtx_
+    std::condition_variable async_flushed_cv_;
+
+    // The first error of a background thread, kept until the next flush(),
+    // sync_until() or close() throws it.
+    std::mutex background_error_mtx_;
+    std::exception_ptr background_error_;
+
+    std::atomic<bool> has_scalar_policies_{false};
+    std::mutex scalar_policies_mtx_;
+    std::unordered_map<std::string, ScalarPolicyState> scalar_policies_;
+
+    // add_image_raw() tasks queued or running on the pool
+    std::mutex image_tasks_mtx_;
+    std::condition_variable image_tasks_cv_;
+    size_t pending_image_tasks_ = 0;
+
+    std::once_flag thread_pool_once_;
+    std::unique_ptr<ThreadPool> thread_pool_;
+
+    // Projector config, read from the log directory on first use. Guarded
+    // by projector_mtx_.
+    void write_projector_config();
+    void end_projector_batch();
+    std::mutex projector_mtx_;
+    std::unique_ptr<tensorflow::ProjectorConfig> projector_config_;
+    size_t projector_batches_ = 0;
+    bool projector_dirty_ = false;
 };  // class TensorBoardLogger
 
+// See TensorBoardLogger::batch_projector_config().
+class ProjectorConfigBatch {
+   public:
+    ProjectorConfigBatch(ProjectorConfigBatch &&other);
+    ProjectorConfigBatch(const ProjectorConfigBatch &) = delete;
+    ProjectorConfigBatch &operator=(const ProjectorConfigBatch &) = delete;
+    // Writes the projector config if this is the last batch, reporting
+    // errors on stderr.
+    ~ProjectorConfigBatch();
+
+   private:
+    friend class TensorBoardLogger;
+    explicit ProjectorConfigBatch(TensorBoardLogger *logger)
+        : logger_(logger) {}
+
+    TensorBoardLogger *logger_;
+};
+
+// Scalars of one tag, for the hot path of logging the same few tags over and
+// over. The handle keeps the tag already encoded in the protobuf wire format,
+// so log() only encodes the wall time, step and value around it and frames
+// the record, without building any protobuf object; the records are
+// byte-identical to those of add_scalar(). Scalar policies apply as with
+// add_scalar().
+//
+// Obtained from TensorBoardLogger::scalar_handle(), it must not outlive the
+// logger and may be used from any thread.
+class ScalarHandle {
+   public:
+    int log(int step, double value);
+
+    const std::string &tag() const { return tag_; }
+
+   private:
+    friend class TensorBoardLogger;
+    ScalarHandle(TensorBoardLogger *logger, const std::string &tag);
+
+    TensorBoardLogger *logger_;
+    std::string tag_;
+    // Event.summary up to the Value.simple_value bytes: key and length of
+    // the summary, of its value and of the tag, the tag and the key of
+    // simple_value
+    std::string summary_prefix_;
+};
+
+// Summaries of one step, accumulated into a single `Summary` so that they are
+// framed, checksummed and written as one event. Obtained from
+// TensorBoardLogger::begin_step(); anything not yet committed is committed
+// when the batch is destroyed.
+class StepBatch {
+   public:
+    StepBatch(StepBatch &&other);
+    StepBatch(const StepBatch &) = delete;
+    StepBatch &operator=(const StepBatch &) = delete;
+    ~StepBatch();
+
+    StepBatch &scalar(const std::string &tag, double value);
+    template <typename T>
+    StepBatch &histogram(const std::string &tag, const T *value, size_t num) {
+        return histogram(tag, HistogramView<T>(value, num));
+    }
+    template <typename T>
+    StepBatch &histogram(const std::string &tag, const HistogramView<T> &view) {
+        logger_->fill_histogram(add_value(), tag, view);
+        return *this;
+    }
+    template <typename T>
+    StepBatch &histogram(const std::string &tag, const std::vector<T> &values) {
+        return histogram(tag, values.data(), values.size());
+    }
+    StepBatch &histogram(const std::string &tag,
+                         const HistogramAccumulator &accumulator);
+    StepBatch &histogram(const std::string &tag,
+                         const QuantileSketch &sketch);
+    StepBatch &image(const std::string &tag, const std::string &encoded_image,
+                     int height, int width, int channel,
+                     const std::string &display_name = "",
+                     const std::string &description = "");
+    StepBatch &images(const std::string &tag,
+                      const std::vector<std::string> &encoded_images,
+                      int height, int width,
+                      const std::string &display_name = "",
+                      const std::string &description = "");
+    StepBatch &audio(const std::string &tag, const std::string &encoded_audio,
+                     float sample_rate, int num_channels, int length_frame,
+                     const std::string &content_type,
+                     const std::string &display_name = "",
+                     const std::string &description = "");
+    StepBatch &text(const std::string &tag, const char *text);
+
+    // number of summaries waiting to be committed
+    size_t size() const {
+        return summary_ == nullptr ? 0 : summary_->value_size();
+    }
+
+    // Write the pending summaries as one event. The batch can keep being
+    // used afterwards, for another event of the same step. Committing a
+    // moved-from batch does nothing, adding to it throws std::logic_error.
+    int commit();
+
+   private:
+    friend class TensorBoardLogger;
+    StepBatch(TensorBoardLogger *logger, int64_t step);
+    Summary::Value *add_value();
+
+    TensorBoardLogger *logger_;
+    int64_t step_;
+    Summary *summary_;
+};
+
 #endif  // TENSORBOARD_LOGGER_H
@@ -0,0 +1,55 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size pool of worker threads running queued tasks in FIFO order.
+class ThreadPool {
+   public:
+    // `num_threads` == 0 means one thread per hardware thread.
+    explicit ThreadPool(size_t num_threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    size_t size() const { return workers_.size(); }
+
+    // Queue `fn` and return a future for its result.
+    template <typename F>
+    auto submit(F &&fn) -> std::future<decltype(fn())> {
+        typedef decltype(fn()) R;
+        auto task =
+            std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+        std::future<R> result = task->get_future();
+        push([task]() { (*task)(); });
+        return result;
+    }
+
+    // Run fn(0), ..., fn(n - 1) on the pool and the calling thread, and
+    // return once all of them are done. Safe to call from a pool thread:
+    // the caller keeps picking up indices itself, so it never waits on work
+    // that nobody runs. If fn throws, the indices not started yet are
+    // skipped and the first exception is rethrown once all are done.
+    void parallel_for(size_t n, const std::function<void(size_t)> &fn);
+
+   private:
+    void push(std::function<void()> task);
+    void worker();
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+};
+
+#endif  // THREAD_POOL_H
@@ -0,0 +1,27 @@
+#ifndef WAV_ENCODER_H
+#define WAV_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Size of the 16-bit PCM WAV file holding `frames` frames of `channels`
+// channels: a 44 byte header and 2 bytes per sample.
+size_t wav_size(size_t frames, int channels);
+
+// Writes a 16-bit PCM WAV file into `out`, which must hold wav_size()
+// bytes. `samples` are interleaved, frame after frame, and converted with
+// float_to_pcm16(). Throws std::invalid_argument if the file would not fit
+// the 32-bit sizes of the format.
+void encode_wav(const float *samples, size_t frames, int channels,
+                uint32_t sample_rate, char *out);
+
+// Converts `num` samples to little-endian 16-bit PCM: clipped to [-1, 1],
+// scaled by 32767 and rounded to nearest, NaN becomes silence. Uses AVX2 or
+// SSE2 when available.
+void float_to_pcm16(const float *samples, size_t num, char *out);
+
+// Name of the implementation used by float_to_pcm16: "avx2", "sse2" or
+// "portable".
+const char *pcm16_implementation();
+
+#endif  // WAV_ENCODER_H
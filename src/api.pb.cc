@@ -0,0 +1,5471 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: api.proto
+
+#include "api.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace tensorboard {
+namespace hparams {
+PROTOBUF_CONSTEXPR Experiment::Experiment(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hparam_infos_)*/{}
+  , /*decltype(_impl_.metric_infos_)*/{}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_created_secs_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExperimentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExperimentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExperimentDefaultTypeInternal() {}
+  union {
+    Experiment _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExperimentDefaultTypeInternal _Experiment_default_instance_;
+PROTOBUF_CONSTEXPR HParamInfo::HParamInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.display_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.differs_)*/false
+  , /*decltype(_impl_.domain_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct HParamInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HParamInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HParamInfoDefaultTypeInternal() {}
+  union {
+    HParamInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HParamInfoDefaultTypeInternal _HParamInfo_default_instance_;
+PROTOBUF_CONSTEXPR Interval::Interval(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.min_value_)*/0
+  , /*decltype(_impl_.max_value_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IntervalDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntervalDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntervalDefaultTypeInternal() {}
+  union {
+    Interval _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntervalDefaultTypeInternal _Interval_default_instance_;
+PROTOBUF_CONSTEXPR MetricName::MetricName(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.group_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricNameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricNameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricNameDefaultTypeInternal() {}
+  union {
+    MetricName _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricNameDefaultTypeInternal _MetricName_default_instance_;
+PROTOBUF_CONSTEXPR MetricInfo::MetricInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.display_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/nullptr
+  , /*decltype(_impl_.dataset_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricInfoDefaultTypeInternal() {}
+  union {
+    MetricInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricInfoDefaultTypeInternal _MetricInfo_default_instance_;
+PROTOBUF_CONSTEXPR SessionGroup_HparamsEntry_DoNotUse::SessionGroup_HparamsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct SessionGroup_HparamsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionGroup_HparamsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionGroup_HparamsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    SessionGroup_HparamsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionGroup_HparamsEntry_DoNotUseDefaultTypeInternal _SessionGroup_HparamsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR SessionGroup::SessionGroup(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hparams_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.metric_values_)*/{}
+  , /*decltype(_impl_.sessions_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.monitor_url_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionGroupDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionGroupDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionGroupDefaultTypeInternal() {}
+  union {
+    SessionGroup _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionGroupDefaultTypeInternal _SessionGroup_default_instance_;
+PROTOBUF_CONSTEXPR MetricValue::MetricValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/nullptr
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.wall_time_secs_)*/0
+  , /*decltype(_impl_.training_step_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricValueDefaultTypeInternal() {}
+  union {
+    MetricValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricValueDefaultTypeInternal _MetricValue_default_instance_;
+PROTOBUF_CONSTEXPR Session::Session(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.metric_values_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.model_uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.monitor_url_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_time_secs_)*/0
+  , /*decltype(_impl_.end_time_secs_)*/0
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionDefaultTypeInternal() {}
+  union {
+    Session _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionDefaultTypeInternal _Session_default_instance_;
+PROTOBUF_CONSTEXPR GetExperimentRequest::GetExperimentRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.experiment_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.include_metrics_)*/false
+  , /*decltype(_impl_.hparams_limit_)*/0} {}
+struct GetExperimentRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetExperimentRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetExperimentRequestDefaultTypeInternal() {}
+  union {
+    GetExperimentRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetExperimentRequestDefaultTypeInternal _GetExperimentRequest_default_instance_;
+PROTOBUF_CONSTEXPR ListSessionGroupsRequest::ListSessionGroupsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.col_params_)*/{}
+  , /*decltype(_impl_.allowed_statuses_)*/{}
+  , /*decltype(_impl_._allowed_statuses_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.experiment_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.aggregation_metric_)*/nullptr
+  , /*decltype(_impl_.aggregation_type_)*/0
+  , /*decltype(_impl_.start_index_)*/0
+  , /*decltype(_impl_.slice_size_)*/0
+  , /*decltype(_impl_.include_metrics_)*/false} {}
+struct ListSessionGroupsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListSessionGroupsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListSessionGroupsRequestDefaultTypeInternal() {}
+  union {
+    ListSessionGroupsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListSessionGroupsRequestDefaultTypeInternal _ListSessionGroupsRequest_default_instance_;
+PROTOBUF_CONSTEXPR ColParams::ColParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.order_)*/0
+  , /*decltype(_impl_.missing_values_first_)*/false
+  , /*decltype(_impl_.exclude_missing_values_)*/false
+  , /*decltype(_impl_.include_in_result_)*/false
+  , /*decltype(_impl_.name_)*/{}
+  , /*decltype(_impl_.filter_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ColParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ColParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ColParamsDefaultTypeInternal() {}
+  union {
+    ColParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ColParamsDefaultTypeInternal _ColParams_default_instance_;
+PROTOBUF_CONSTEXPR ListSessionGroupsResponse::ListSessionGroupsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_groups_)*/{}
+  , /*decltype(_impl_.total_size_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListSessionGroupsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListSessionGroupsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListSessionGroupsResponseDefaultTypeInternal() {}
+  union {
+    ListSessionGroupsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListSessionGroupsResponseDefaultTypeInternal _ListSessionGroupsResponse_default_instance_;
+PROTOBUF_CONSTEXPR ListMetricEvalsRequest::ListMetricEvalsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.experiment_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.metric_name_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListMetricEvalsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListMetricEvalsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListMetricEvalsRequestDefaultTypeInternal() {}
+  union {
+    ListMetricEvalsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListMetricEvalsRequestDefaultTypeInternal _ListMetricEvalsRequest_default_instance_;
+}  // namespace hparams
+}  // namespace tensorboard
+static ::_pb::Metadata file_level_metadata_api_2eproto[14];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_api_2eproto[5];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_api_2eproto = nullptr;
+
+const uint32_t TableStruct_api_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _impl_.user_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _impl_.time_created_secs_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _impl_.hparam_infos_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Experiment, _impl_.metric_infos_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_.display_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_.type_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_.differs_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamInfo, _impl_.domain_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Interval, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Interval, _impl_.min_value_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Interval, _impl_.max_value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricName, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricName, _impl_.group_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricName, _impl_.tag_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricInfo, _impl_.display_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricInfo, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricInfo, _impl_.dataset_type_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup, _impl_.hparams_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup, _impl_.metric_values_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup, _impl_.sessions_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionGroup, _impl_.monitor_url_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricValue, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricValue, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricValue, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricValue, _impl_.training_step_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::MetricValue, _impl_.wall_time_secs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.start_time_secs_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.end_time_secs_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.model_uri_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.metric_values_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::Session, _impl_.monitor_url_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::GetExperimentRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::GetExperimentRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::GetExperimentRequest, _impl_.experiment_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::GetExperimentRequest, _impl_.include_metrics_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::GetExperimentRequest, _impl_.hparams_limit_),
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.experiment_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.allowed_statuses_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.col_params_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.aggregation_type_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.aggregation_metric_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.start_index_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.slice_size_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsRequest, _impl_.include_metrics_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_.order_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_.missing_values_first_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_.exclude_missing_values_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_.include_in_result_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ColParams, _impl_.filter_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsResponse, _impl_.session_groups_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListSessionGroupsResponse, _impl_.total_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListMetricEvalsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListMetricEvalsRequest, _impl_.experiment_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListMetricEvalsRequest, _impl_.session_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::ListMetricEvalsRequest, _impl_.metric_name_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::tensorboard::hparams::Experiment)},
+  { 12, -1, -1, sizeof(::tensorboard::hparams::HParamInfo)},
+  { 26, -1, -1, sizeof(::tensorboard::hparams::Interval)},
+  { 34, -1, -1, sizeof(::tensorboard::hparams::MetricName)},
+  { 42, -1, -1, sizeof(::tensorboard::hparams::MetricInfo)},
+  { 52, 60, -1, sizeof(::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse)},
+  { 62, -1, -1, sizeof(::tensorboard::hparams::SessionGroup)},
+  { 73, -1, -1, sizeof(::tensorboard::hparams::MetricValue)},
+  { 83, -1, -1, sizeof(::tensorboard::hparams::Session)},
+  { 96, 105, -1, sizeof(::tensorboard::hparams::GetExperimentRequest)},
+  { 108, 122, -1, sizeof(::tensorboard::hparams::ListSessionGroupsRequest)},
+  { 130, 147, -1, sizeof(::tensorboard::hparams::ColParams)},
+  { 156, -1, -1, sizeof(::tensorboard::hparams::ListSessionGroupsResponse)},
+  { 164, -1, -1, sizeof(::tensorboard::hparams::ListMetricEvalsRequest)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::tensorboard::hparams::_Experiment_default_instance_._instance,
+  &::tensorboard::hparams::_HParamInfo_default_instance_._instance,
+  &::tensorboard::hparams::_Interval_default_instance_._instance,
+  &::tensorboard::hparams::_MetricName_default_instance_._instance,
+  &::tensorboard::hparams::_MetricInfo_default_instance_._instance,
+  &::tensorboard::hparams::_SessionGroup_HparamsEntry_DoNotUse_default_instance_._instance,
+  &::tensorboard::hparams::_SessionGroup_default_instance_._instance,
+  &::tensorboard::hparams::_MetricValue_default_instance_._instance,
+  &::tensorboard::hparams::_Session_default_instance_._instance,
+  &::tensorboard::hparams::_GetExperimentRequest_default_instance_._instance,
+  &::tensorboard::hparams::_ListSessionGroupsRequest_default_instance_._instance,
+  &::tensorboard::hparams::_ColParams_default_instance_._instance,
+  &::tensorboard::hparams::_ListSessionGroupsResponse_default_instance_._instance,
+  &::tensorboard::hparams::_ListMetricEvalsRequest_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_api_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\tapi.proto\022\023tensorboard.hparams\032\034google"
+  "/protobuf/struct.proto\"\306\001\n\nExperiment\022\014\n"
+  "\004name\030\006 \001(\t\022\023\n\013description\030\001 \001(\t\022\014\n\004user"
+  "\030\002 \001(\t\022\031\n\021time_created_secs\030\003 \001(\001\0225\n\014hpa"
+  "ram_infos\030\004 \003(\0132\037.tensorboard.hparams.HP"
+  "aramInfo\0225\n\014metric_infos\030\005 \003(\0132\037.tensorb"
+  "oard.hparams.MetricInfo\"\376\001\n\nHParamInfo\022\014"
+  "\n\004name\030\001 \001(\t\022\024\n\014display_name\030\002 \001(\t\022\023\n\013de"
+  "scription\030\003 \001(\t\022+\n\004type\030\004 \001(\0162\035.tensorbo"
+  "ard.hparams.DataType\0225\n\017domain_discrete\030"
+  "\005 \001(\0132\032.google.protobuf.ListValueH\000\0228\n\017d"
+  "omain_interval\030\006 \001(\0132\035.tensorboard.hpara"
+  "ms.IntervalH\000\022\017\n\007differs\030\007 \001(\010B\010\n\006domain"
+  "\"0\n\010Interval\022\021\n\tmin_value\030\001 \001(\001\022\021\n\tmax_v"
+  "alue\030\002 \001(\001\"(\n\nMetricName\022\r\n\005group\030\001 \001(\t\022"
+  "\013\n\003tag\030\002 \001(\t\"\236\001\n\nMetricInfo\022-\n\004name\030\001 \001("
+  "\0132\037.tensorboard.hparams.MetricName\022\024\n\014di"
+  "splay_name\030\003 \001(\t\022\023\n\013description\030\004 \001(\t\0226\n"
+  "\014dataset_type\030\005 \001(\0162 .tensorboard.hparam"
+  "s.DatasetType\"\243\002\n\014SessionGroup\022\014\n\004name\030\001"
+  " \001(\t\022\?\n\007hparams\030\002 \003(\0132..tensorboard.hpar"
+  "ams.SessionGroup.HparamsEntry\0227\n\rmetric_"
+  "values\030\003 \003(\0132 .tensorboard.hparams.Metri"
+  "cValue\022.\n\010sessions\030\004 \003(\0132\034.tensorboard.h"
+  "params.Session\022\023\n\013monitor_url\030\005 \001(\t\032F\n\014H"
+  "paramsEntry\022\013\n\003key\030\001 \001(\t\022%\n\005value\030\002 \001(\0132"
+  "\026.google.protobuf.Value:\0028\001\"z\n\013MetricVal"
+  "ue\022-\n\004name\030\001 \001(\0132\037.tensorboard.hparams.M"
+  "etricName\022\r\n\005value\030\002 \001(\001\022\025\n\rtraining_ste"
+  "p\030\003 \001(\005\022\026\n\016wall_time_secs\030\004 \001(\001\"\325\001\n\007Sess"
+  "ion\022\014\n\004name\030\001 \001(\t\022\027\n\017start_time_secs\030\002 \001"
+  "(\001\022\025\n\rend_time_secs\030\003 \001(\001\022+\n\006status\030\004 \001("
+  "\0162\033.tensorboard.hparams.Status\022\021\n\tmodel_"
+  "uri\030\005 \001(\t\0227\n\rmetric_values\030\006 \003(\0132 .tenso"
+  "rboard.hparams.MetricValue\022\023\n\013monitor_ur"
+  "l\030\007 \001(\t\"\217\001\n\024GetExperimentRequest\022\027\n\017expe"
+  "riment_name\030\001 \001(\t\022\034\n\017include_metrics\030\002 \001"
+  "(\010H\000\210\001\001\022\032\n\rhparams_limit\030\003 \001(\005H\001\210\001\001B\022\n\020_"
+  "include_metricsB\020\n\016_hparams_limit\"\366\002\n\030Li"
+  "stSessionGroupsRequest\022\027\n\017experiment_nam"
+  "e\030\006 \001(\t\0225\n\020allowed_statuses\030\007 \003(\0162\033.tens"
+  "orboard.hparams.Status\0222\n\ncol_params\030\001 \003"
+  "(\0132\036.tensorboard.hparams.ColParams\022>\n\020ag"
+  "gregation_type\030\002 \001(\0162$.tensorboard.hpara"
+  "ms.AggregationType\022;\n\022aggregation_metric"
+  "\030\003 \001(\0132\037.tensorboard.hparams.MetricName\022"
+  "\023\n\013start_index\030\004 \001(\005\022\022\n\nslice_size\030\005 \001(\005"
+  "\022\034\n\017include_metrics\030\010 \001(\010H\000\210\001\001B\022\n\020_inclu"
+  "de_metrics\"\217\003\n\tColParams\0221\n\006metric\030\001 \001(\013"
+  "2\037.tensorboard.hparams.MetricNameH\000\022\020\n\006h"
+  "param\030\002 \001(\tH\000\022-\n\005order\030\003 \001(\0162\036.tensorboa"
+  "rd.hparams.SortOrder\022\034\n\024missing_values_f"
+  "irst\030\004 \001(\010\022\027\n\rfilter_regexp\030\005 \001(\tH\001\0228\n\017f"
+  "ilter_interval\030\006 \001(\0132\035.tensorboard.hpara"
+  "ms.IntervalH\001\0225\n\017filter_discrete\030\007 \001(\0132\032"
+  ".google.protobuf.ListValueH\001\022\036\n\026exclude_"
+  "missing_values\030\010 \001(\010\022\036\n\021include_in_resul"
+  "t\030\t \001(\010H\002\210\001\001B\006\n\004nameB\010\n\006filterB\024\n\022_inclu"
+  "de_in_result\"j\n\031ListSessionGroupsRespons"
+  "e\0229\n\016session_groups\030\001 \003(\0132!.tensorboard."
+  "hparams.SessionGroup\022\022\n\ntotal_size\030\003 \001(\005"
+  "\"}\n\026ListMetricEvalsRequest\022\027\n\017experiment"
+  "_name\030\003 \001(\t\022\024\n\014session_name\030\001 \001(\t\0224\n\013met"
+  "ric_name\030\002 \001(\0132\037.tensorboard.hparams.Met"
+  "ricName*`\n\010DataType\022\023\n\017DATA_TYPE_UNSET\020\000"
+  "\022\024\n\020DATA_TYPE_STRING\020\001\022\022\n\016DATA_TYPE_BOOL"
+  "\020\002\022\025\n\021DATA_TYPE_FLOAT64\020\003*P\n\013DatasetType"
+  "\022\023\n\017DATASET_UNKNOWN\020\000\022\024\n\020DATASET_TRAININ"
+  "G\020\001\022\026\n\022DATASET_VALIDATION\020\002*X\n\006Status\022\022\n"
+  "\016STATUS_UNKNOWN\020\000\022\022\n\016STATUS_SUCCESS\020\001\022\022\n"
+  "\016STATUS_FAILURE\020\002\022\022\n\016STATUS_RUNNING\020\003*A\n"
+  "\tSortOrder\022\025\n\021ORDER_UNSPECIFIED\020\000\022\r\n\tORD"
+  "ER_ASC\020\001\022\016\n\nORDER_DESC\020\002*\177\n\017AggregationT"
+  "ype\022\025\n\021AGGREGATION_UNSET\020\000\022\023\n\017AGGREGATIO"
+  "N_AVG\020\001\022\026\n\022AGGREGATION_MEDIAN\020\002\022\023\n\017AGGRE"
+  "GATION_MIN\020\003\022\023\n\017AGGREGATION_MAX\020\004b\006proto"
+  "3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_api_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_api_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_api_2eproto = {
+    false, false, 3041, descriptor_table_protodef_api_2eproto,
+    "api.proto",
+    &descriptor_table_api_2eproto_once, descriptor_table_api_2eproto_deps, 1, 14,
+    schemas, file_default_instances, TableStruct_api_2eproto::offsets,
+    file_level_metadata_api_2eproto, file_level_enum_descriptors_api_2eproto,
+    file_level_service_descriptors_api_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_api_2eproto_getter() {
+  return &descriptor_table_api_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_api_2eproto(&descriptor_table_api_2eproto);
+namespace tensorboard {
+namespace hparams {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_api_2eproto);
+  return file_level_enum_descriptors_api_2eproto[0];
+}
+bool DataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DatasetType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_api_2eproto);
+  return file_level_enum_descriptors_api_2eproto[1];
+}
+bool DatasetType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Status_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_api_2eproto);
+  return file_level_enum_descriptors_api_2eproto[2];
+}
+bool Status_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SortOrder_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_api_2eproto);
+  return file_level_enum_descriptors_api_2eproto[3];
+}
+bool SortOrder_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* AggregationType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_api_2eproto);
+  return file_level_enum_descriptors_api_2eproto[4];
+}
+bool AggregationType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class Experiment::_Internal {
+ public:
+};
+
+Experiment::Experiment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.Experiment)
+}
+Experiment::Experiment(const Experiment& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Experiment* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hparam_infos_){from._impl_.hparam_infos_}
+    , decltype(_impl_.metric_infos_){from._impl_.metric_infos_}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.user_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.time_created_secs_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_description().empty()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_user().empty()) {
+    _this->_impl_.user_.Set(from._internal_user(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.time_created_secs_ = from._impl_.time_created_secs_;
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.Experiment)
+}
+
+inline void Experiment::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hparam_infos_){arena}
+    , decltype(_impl_.metric_infos_){arena}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.user_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.time_created_secs_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Experiment::~Experiment() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.Experiment)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Experiment::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hparam_infos_.~RepeatedPtrField();
+  _impl_.metric_infos_.~RepeatedPtrField();
+  _impl_.description_.Destroy();
+  _impl_.user_.Destroy();
+  _impl_.name_.Destroy();
+}
+
+void Experiment::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Experiment::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.Experiment)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hparam_infos_.Clear();
+  _impl_.metric_infos_.Clear();
+  _impl_.description_.ClearToEmpty();
+  _impl_.user_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.time_created_secs_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Experiment::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string description = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.Experiment.description"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_user();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.Experiment.user"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double time_created_secs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.time_created_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorboard.hparams.HParamInfo hparam_infos = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_hparam_infos(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorboard.hparams.MetricInfo metric_infos = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metric_infos(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.Experiment.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Experiment::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.Experiment)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string description = 1;
+  if (!this->_internal_description().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.Experiment.description");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_description(), target);
+  }
+
+  // string user = 2;
+  if (!this->_internal_user().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user().data(), static_cast<int>(this->_internal_user().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.Experiment.user");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_user(), target);
+  }
+
+  // double time_created_secs = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time_created_secs = this->_internal_time_created_secs();
+  uint64_t raw_time_created_secs;
+  memcpy(&raw_time_created_secs, &tmp_time_created_secs, sizeof(tmp_time_created_secs));
+  if (raw_time_created_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_time_created_secs(), target);
+  }
+
+  // repeated .tensorboard.hparams.HParamInfo hparam_infos = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_hparam_infos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_hparam_infos(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .tensorboard.hparams.MetricInfo metric_infos = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metric_infos_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metric_infos(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string name = 6;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.Experiment.name");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.Experiment)
+  return target;
+}
+
+size_t Experiment::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.Experiment)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tensorboard.hparams.HParamInfo hparam_infos = 4;
+  total_size += 1UL * this->_internal_hparam_infos_size();
+  for (const auto& msg : this->_impl_.hparam_infos_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .tensorboard.hparams.MetricInfo metric_infos = 5;
+  total_size += 1UL * this->_internal_metric_infos_size();
+  for (const auto& msg : this->_impl_.metric_infos_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string description = 1;
+  if (!this->_internal_description().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_description());
+  }
+
+  // string user = 2;
+  if (!this->_internal_user().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_user());
+  }
+
+  // string name = 6;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // double time_created_secs = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time_created_secs = this->_internal_time_created_secs();
+  uint64_t raw_time_created_secs;
+  memcpy(&raw_time_created_secs, &tmp_time_created_secs, sizeof(tmp_time_created_secs));
+  if (raw_time_created_secs != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Experiment::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Experiment::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Experiment::GetClassData() const { return &_class_data_; }
+
+
+void Experiment::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Experiment*>(&to_msg);
+  auto& from = static_cast<const Experiment&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.Experiment)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hparam_infos_.MergeFrom(from._impl_.hparam_infos_);
+  _this->_impl_.metric_infos_.MergeFrom(from._impl_.metric_infos_);
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
+  }
+  if (!from._internal_user().empty()) {
+    _this->_internal_set_user(from._internal_user());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_time_created_secs = from._internal_time_created_secs();
+  uint64_t raw_time_created_secs;
+  memcpy(&raw_time_created_secs, &tmp_time_created_secs, sizeof(tmp_time_created_secs));
+  if (raw_time_created_secs != 0) {
+    _this->_internal_set_time_created_secs(from._internal_time_created_secs());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Experiment::CopyFrom(const Experiment& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.Experiment)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Experiment::IsInitialized() const {
+  return true;
+}
+
+void Experiment::InternalSwap(Experiment* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hparam_infos_.InternalSwap(&other->_impl_.hparam_infos_);
+  _impl_.metric_infos_.InternalSwap(&other->_impl_.metric_infos_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_, lhs_arena,
+      &other->_impl_.user_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.time_created_secs_, other->_impl_.time_created_secs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Experiment::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[0]);
+}
+
+// ===================================================================
+
+class HParamInfo::_Internal {
+ public:
+  static const ::PROTOBUF_NAMESPACE_ID::ListValue& domain_discrete(const HParamInfo* msg);
+  static const ::tensorboard::hparams::Interval& domain_interval(const HParamInfo* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::ListValue&
+HParamInfo::_Internal::domain_discrete(const HParamInfo* msg) {
+  return *msg->_impl_.domain_.domain_discrete_;
+}
+const ::tensorboard::hparams::Interval&
+HParamInfo::_Internal::domain_interval(const HParamInfo* msg) {
+  return *msg->_impl_.domain_.domain_interval_;
+}
+void HParamInfo::set_allocated_domain_discrete(::PROTOBUF_NAMESPACE_ID::ListValue* domain_discrete) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_domain();
+  if (domain_discrete) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(domain_discrete));
+    if (message_arena != submessage_arena) {
+      domain_discrete = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, domain_discrete, submessage_arena);
+    }
+    set_has_domain_discrete();
+    _impl_.domain_.domain_discrete_ = domain_discrete;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamInfo.domain_discrete)
+}
+void HParamInfo::clear_domain_discrete() {
+  if (_internal_has_domain_discrete()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.domain_.domain_discrete_;
+    }
+    clear_has_domain();
+  }
+}
+void HParamInfo::set_allocated_domain_interval(::tensorboard::hparams::Interval* domain_interval) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_domain();
+  if (domain_interval) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(domain_interval);
+    if (message_arena != submessage_arena) {
+      domain_interval = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, domain_interval, submessage_arena);
+    }
+    set_has_domain_interval();
+    _impl_.domain_.domain_interval_ = domain_interval;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamInfo.domain_interval)
+}
+HParamInfo::HParamInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.HParamInfo)
+}
+HParamInfo::HParamInfo(const HParamInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HParamInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.display_name_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.differs_){}
+    , decltype(_impl_.domain_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.display_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.display_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_display_name().empty()) {
+    _this->_impl_.display_name_.Set(from._internal_display_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_description().empty()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.differs_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.differs_));
+  clear_has_domain();
+  switch (from.domain_case()) {
+    case kDomainDiscrete: {
+      _this->_internal_mutable_domain_discrete()->::PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(
+          from._internal_domain_discrete());
+      break;
+    }
+    case kDomainInterval: {
+      _this->_internal_mutable_domain_interval()->::tensorboard::hparams::Interval::MergeFrom(
+          from._internal_domain_interval());
+      break;
+    }
+    case DOMAIN_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.HParamInfo)
+}
+
+inline void HParamInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.display_name_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.differs_){false}
+    , decltype(_impl_.domain_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.display_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.display_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_domain();
+}
+
+HParamInfo::~HParamInfo() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.HParamInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HParamInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.display_name_.Destroy();
+  _impl_.description_.Destroy();
+  if (has_domain()) {
+    clear_domain();
+  }
+}
+
+void HParamInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HParamInfo::clear_domain() {
+// @@protoc_insertion_point(one_of_clear_start:tensorboard.hparams.HParamInfo)
+  switch (domain_case()) {
+    case kDomainDiscrete: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.domain_.domain_discrete_;
+      }
+      break;
+    }
+    case kDomainInterval: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.domain_.domain_interval_;
+      }
+      break;
+    }
+    case DOMAIN_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = DOMAIN_NOT_SET;
+}
+
+
+void HParamInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.HParamInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.display_name_.ClearToEmpty();
+  _impl_.description_.ClearToEmpty();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.differs_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.differs_));
+  clear_domain();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HParamInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.HParamInfo.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string display_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_display_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.HParamInfo.display_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string description = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.HParamInfo.description"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.DataType type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::tensorboard::hparams::DataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.ListValue domain_discrete = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_domain_discrete(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.Interval domain_interval = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_domain_interval(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool differs = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.differs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HParamInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.HParamInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.HParamInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // string display_name = 2;
+  if (!this->_internal_display_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_display_name().data(), static_cast<int>(this->_internal_display_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.HParamInfo.display_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_display_name(), target);
+  }
+
+  // string description = 3;
+  if (!this->_internal_description().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.HParamInfo.description");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_description(), target);
+  }
+
+  // .tensorboard.hparams.DataType type = 4;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_type(), target);
+  }
+
+  // .google.protobuf.ListValue domain_discrete = 5;
+  if (_internal_has_domain_discrete()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::domain_discrete(this),
+        _Internal::domain_discrete(this).GetCachedSize(), target, stream);
+  }
+
+  // .tensorboard.hparams.Interval domain_interval = 6;
+  if (_internal_has_domain_interval()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::domain_interval(this),
+        _Internal::domain_interval(this).GetCachedSize(), target, stream);
+  }
+
+  // bool differs = 7;
+  if (this->_internal_differs() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_differs(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.HParamInfo)
+  return target;
+}
+
+size_t HParamInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.HParamInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string display_name = 2;
+  if (!this->_internal_display_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_display_name());
+  }
+
+  // string description = 3;
+  if (!this->_internal_description().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_description());
+  }
+
+  // .tensorboard.hparams.DataType type = 4;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // bool differs = 7;
+  if (this->_internal_differs() != 0) {
+    total_size += 1 + 1;
+  }
+
+  switch (domain_case()) {
+    // .google.protobuf.ListValue domain_discrete = 5;
+    case kDomainDiscrete: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.domain_.domain_discrete_);
+      break;
+    }
+    // .tensorboard.hparams.Interval domain_interval = 6;
+    case kDomainInterval: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.domain_.domain_interval_);
+      break;
+    }
+    case DOMAIN_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HParamInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HParamInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HParamInfo::GetClassData() const { return &_class_data_; }
+
+
+void HParamInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HParamInfo*>(&to_msg);
+  auto& from = static_cast<const HParamInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.HParamInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_display_name().empty()) {
+    _this->_internal_set_display_name(from._internal_display_name());
+  }
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_differs() != 0) {
+    _this->_internal_set_differs(from._internal_differs());
+  }
+  switch (from.domain_case()) {
+    case kDomainDiscrete: {
+      _this->_internal_mutable_domain_discrete()->::PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(
+          from._internal_domain_discrete());
+      break;
+    }
+    case kDomainInterval: {
+      _this->_internal_mutable_domain_interval()->::tensorboard::hparams::Interval::MergeFrom(
+          from._internal_domain_interval());
+      break;
+    }
+    case DOMAIN_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HParamInfo::CopyFrom(const HParamInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.HParamInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HParamInfo::IsInitialized() const {
+  return true;
+}
+
+void HParamInfo::InternalSwap(HParamInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.display_name_, lhs_arena,
+      &other->_impl_.display_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HParamInfo, _impl_.differs_)
+      + sizeof(HParamInfo::_impl_.differs_)
+      - PROTOBUF_FIELD_OFFSET(HParamInfo, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+  swap(_impl_.domain_, other->_impl_.domain_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HParamInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[1]);
+}
+
+// ===================================================================
+
+class Interval::_Internal {
+ public:
+};
+
+Interval::Interval(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.Interval)
+}
+Interval::Interval(const Interval& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Interval* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_value_){}
+    , decltype(_impl_.max_value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_value_, &from._impl_.min_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_value_) -
+    reinterpret_cast<char*>(&_impl_.min_value_)) + sizeof(_impl_.max_value_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.Interval)
+}
+
+inline void Interval::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_value_){0}
+    , decltype(_impl_.max_value_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Interval::~Interval() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.Interval)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Interval::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Interval::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Interval::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.Interval)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.min_value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_value_) -
+      reinterpret_cast<char*>(&_impl_.min_value_)) + sizeof(_impl_.max_value_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Interval::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double min_value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.min_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double max_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.max_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Interval::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.Interval)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double min_value = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_value = this->_internal_min_value();
+  uint64_t raw_min_value;
+  memcpy(&raw_min_value, &tmp_min_value, sizeof(tmp_min_value));
+  if (raw_min_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_min_value(), target);
+  }
+
+  // double max_value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_value = this->_internal_max_value();
+  uint64_t raw_max_value;
+  memcpy(&raw_max_value, &tmp_max_value, sizeof(tmp_max_value));
+  if (raw_max_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_max_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.Interval)
+  return target;
+}
+
+size_t Interval::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.Interval)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double min_value = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_value = this->_internal_min_value();
+  uint64_t raw_min_value;
+  memcpy(&raw_min_value, &tmp_min_value, sizeof(tmp_min_value));
+  if (raw_min_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double max_value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_value = this->_internal_max_value();
+  uint64_t raw_max_value;
+  memcpy(&raw_max_value, &tmp_max_value, sizeof(tmp_max_value));
+  if (raw_max_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Interval::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Interval::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Interval::GetClassData() const { return &_class_data_; }
+
+
+void Interval::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Interval*>(&to_msg);
+  auto& from = static_cast<const Interval&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.Interval)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_value = from._internal_min_value();
+  uint64_t raw_min_value;
+  memcpy(&raw_min_value, &tmp_min_value, sizeof(tmp_min_value));
+  if (raw_min_value != 0) {
+    _this->_internal_set_min_value(from._internal_min_value());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_value = from._internal_max_value();
+  uint64_t raw_max_value;
+  memcpy(&raw_max_value, &tmp_max_value, sizeof(tmp_max_value));
+  if (raw_max_value != 0) {
+    _this->_internal_set_max_value(from._internal_max_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Interval::CopyFrom(const Interval& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.Interval)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Interval::IsInitialized() const {
+  return true;
+}
+
+void Interval::InternalSwap(Interval* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Interval, _impl_.max_value_)
+      + sizeof(Interval::_impl_.max_value_)
+      - PROTOBUF_FIELD_OFFSET(Interval, _impl_.min_value_)>(
+          reinterpret_cast<char*>(&_impl_.min_value_),
+          reinterpret_cast<char*>(&other->_impl_.min_value_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Interval::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[2]);
+}
+
+// ===================================================================
+
+class MetricName::_Internal {
+ public:
+};
+
+MetricName::MetricName(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.MetricName)
+}
+MetricName::MetricName(const MetricName& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricName* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.group_){}
+    , decltype(_impl_.tag_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_group().empty()) {
+    _this->_impl_.group_.Set(from._internal_group(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tag().empty()) {
+    _this->_impl_.tag_.Set(from._internal_tag(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.MetricName)
+}
+
+inline void MetricName::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.group_){}
+    , decltype(_impl_.tag_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetricName::~MetricName() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.MetricName)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricName::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.group_.Destroy();
+  _impl_.tag_.Destroy();
+}
+
+void MetricName::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricName::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.MetricName)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.group_.ClearToEmpty();
+  _impl_.tag_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricName::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string group = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_group();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.MetricName.group"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string tag = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_tag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.MetricName.tag"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricName::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.MetricName)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string group = 1;
+  if (!this->_internal_group().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_group().data(), static_cast<int>(this->_internal_group().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.MetricName.group");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_group(), target);
+  }
+
+  // string tag = 2;
+  if (!this->_internal_tag().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tag().data(), static_cast<int>(this->_internal_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.MetricName.tag");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_tag(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.MetricName)
+  return target;
+}
+
+size_t MetricName::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.MetricName)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string group = 1;
+  if (!this->_internal_group().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_group());
+  }
+
+  // string tag = 2;
+  if (!this->_internal_tag().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tag());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricName::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricName::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricName::GetClassData() const { return &_class_data_; }
+
+
+void MetricName::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricName*>(&to_msg);
+  auto& from = static_cast<const MetricName&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.MetricName)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_group().empty()) {
+    _this->_internal_set_group(from._internal_group());
+  }
+  if (!from._internal_tag().empty()) {
+    _this->_internal_set_tag(from._internal_tag());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricName::CopyFrom(const MetricName& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.MetricName)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricName::IsInitialized() const {
+  return true;
+}
+
+void MetricName::InternalSwap(MetricName* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.group_, lhs_arena,
+      &other->_impl_.group_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tag_, lhs_arena,
+      &other->_impl_.tag_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricName::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[3]);
+}
+
+// ===================================================================
+
+class MetricInfo::_Internal {
+ public:
+  static const ::tensorboard::hparams::MetricName& name(const MetricInfo* msg);
+};
+
+const ::tensorboard::hparams::MetricName&
+MetricInfo::_Internal::name(const MetricInfo* msg) {
+  return *msg->_impl_.name_;
+}
+MetricInfo::MetricInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.MetricInfo)
+}
+MetricInfo::MetricInfo(const MetricInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.display_name_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.name_){nullptr}
+    , decltype(_impl_.dataset_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.display_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.display_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_display_name().empty()) {
+    _this->_impl_.display_name_.Set(from._internal_display_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_description().empty()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_name()) {
+    _this->_impl_.name_ = new ::tensorboard::hparams::MetricName(*from._impl_.name_);
+  }
+  _this->_impl_.dataset_type_ = from._impl_.dataset_type_;
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.MetricInfo)
+}
+
+inline void MetricInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.display_name_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.name_){nullptr}
+    , decltype(_impl_.dataset_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.display_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.display_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetricInfo::~MetricInfo() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.MetricInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.display_name_.Destroy();
+  _impl_.description_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.name_;
+}
+
+void MetricInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.MetricInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.display_name_.ClearToEmpty();
+  _impl_.description_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.name_ != nullptr) {
+    delete _impl_.name_;
+  }
+  _impl_.name_ = nullptr;
+  _impl_.dataset_type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .tensorboard.hparams.MetricName name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string display_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_display_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.MetricInfo.display_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string description = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.MetricInfo.description"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.DatasetType dataset_type = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_dataset_type(static_cast<::tensorboard::hparams::DatasetType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.MetricInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .tensorboard.hparams.MetricName name = 1;
+  if (this->_internal_has_name()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::name(this),
+        _Internal::name(this).GetCachedSize(), target, stream);
+  }
+
+  // string display_name = 3;
+  if (!this->_internal_display_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_display_name().data(), static_cast<int>(this->_internal_display_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.MetricInfo.display_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_display_name(), target);
+  }
+
+  // string description = 4;
+  if (!this->_internal_description().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.MetricInfo.description");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_description(), target);
+  }
+
+  // .tensorboard.hparams.DatasetType dataset_type = 5;
+  if (this->_internal_dataset_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_dataset_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.MetricInfo)
+  return target;
+}
+
+size_t MetricInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.MetricInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string display_name = 3;
+  if (!this->_internal_display_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_display_name());
+  }
+
+  // string description = 4;
+  if (!this->_internal_description().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_description());
+  }
+
+  // .tensorboard.hparams.MetricName name = 1;
+  if (this->_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.name_);
+  }
+
+  // .tensorboard.hparams.DatasetType dataset_type = 5;
+  if (this->_internal_dataset_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_dataset_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricInfo::GetClassData() const { return &_class_data_; }
+
+
+void MetricInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricInfo*>(&to_msg);
+  auto& from = static_cast<const MetricInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.MetricInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_display_name().empty()) {
+    _this->_internal_set_display_name(from._internal_display_name());
+  }
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
+  }
+  if (from._internal_has_name()) {
+    _this->_internal_mutable_name()->::tensorboard::hparams::MetricName::MergeFrom(
+        from._internal_name());
+  }
+  if (from._internal_dataset_type() != 0) {
+    _this->_internal_set_dataset_type(from._internal_dataset_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricInfo::CopyFrom(const MetricInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.MetricInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricInfo::IsInitialized() const {
+  return true;
+}
+
+void MetricInfo::InternalSwap(MetricInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.display_name_, lhs_arena,
+      &other->_impl_.display_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetricInfo, _impl_.dataset_type_)
+      + sizeof(MetricInfo::_impl_.dataset_type_)
+      - PROTOBUF_FIELD_OFFSET(MetricInfo, _impl_.name_)>(
+          reinterpret_cast<char*>(&_impl_.name_),
+          reinterpret_cast<char*>(&other->_impl_.name_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[4]);
+}
+
+// ===================================================================
+
+SessionGroup_HparamsEntry_DoNotUse::SessionGroup_HparamsEntry_DoNotUse() {}
+SessionGroup_HparamsEntry_DoNotUse::SessionGroup_HparamsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SessionGroup_HparamsEntry_DoNotUse::MergeFrom(const SessionGroup_HparamsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SessionGroup_HparamsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[5]);
+}
+
+// ===================================================================
+
+class SessionGroup::_Internal {
+ public:
+};
+
+void SessionGroup::clear_hparams() {
+  _impl_.hparams_.Clear();
+}
+SessionGroup::SessionGroup(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &SessionGroup::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.SessionGroup)
+}
+SessionGroup::SessionGroup(const SessionGroup& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionGroup* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.hparams_)*/{}
+    , decltype(_impl_.metric_values_){from._impl_.metric_values_}
+    , decltype(_impl_.sessions_){from._impl_.sessions_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.monitor_url_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.hparams_.MergeFrom(from._impl_.hparams_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.monitor_url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_monitor_url().empty()) {
+    _this->_impl_.monitor_url_.Set(from._internal_monitor_url(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.SessionGroup)
+}
+
+inline void SessionGroup::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.hparams_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.metric_values_){arena}
+    , decltype(_impl_.sessions_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.monitor_url_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.monitor_url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SessionGroup::~SessionGroup() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.SessionGroup)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionGroup::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hparams_.Destruct();
+  _impl_.hparams_.~MapField();
+  _impl_.metric_values_.~RepeatedPtrField();
+  _impl_.sessions_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.monitor_url_.Destroy();
+}
+
+void SessionGroup::ArenaDtor(void* object) {
+  SessionGroup* _this = reinterpret_cast< SessionGroup* >(object);
+  _this->_impl_.hparams_.Destruct();
+}
+void SessionGroup::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.SessionGroup)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hparams_.Clear();
+  _impl_.metric_values_.Clear();
+  _impl_.sessions_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.monitor_url_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionGroup::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.SessionGroup.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, .google.protobuf.Value> hparams = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.hparams_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorboard.hparams.MetricValue metric_values = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metric_values(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorboard.hparams.Session sessions = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sessions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string monitor_url = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_monitor_url();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.SessionGroup.monitor_url"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionGroup::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.SessionGroup)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.SessionGroup.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // map<string, .google.protobuf.Value> hparams = 2;
+  if (!this->_internal_hparams().empty()) {
+    using MapType = ::_pb::Map<std::string, ::PROTOBUF_NAMESPACE_ID::Value>;
+    using WireHelper = SessionGroup_HparamsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_hparams();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "tensorboard.hparams.SessionGroup.HparamsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // repeated .tensorboard.hparams.MetricValue metric_values = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metric_values_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metric_values(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .tensorboard.hparams.Session sessions = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sessions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sessions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string monitor_url = 5;
+  if (!this->_internal_monitor_url().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_monitor_url().data(), static_cast<int>(this->_internal_monitor_url().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.SessionGroup.monitor_url");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_monitor_url(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.SessionGroup)
+  return target;
+}
+
+size_t SessionGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.SessionGroup)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .google.protobuf.Value> hparams = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_hparams_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >::const_iterator
+      it = this->_internal_hparams().begin();
+      it != this->_internal_hparams().end(); ++it) {
+    total_size += SessionGroup_HparamsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // repeated .tensorboard.hparams.MetricValue metric_values = 3;
+  total_size += 1UL * this->_internal_metric_values_size();
+  for (const auto& msg : this->_impl_.metric_values_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .tensorboard.hparams.Session sessions = 4;
+  total_size += 1UL * this->_internal_sessions_size();
+  for (const auto& msg : this->_impl_.sessions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string monitor_url = 5;
+  if (!this->_internal_monitor_url().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_monitor_url());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionGroup::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionGroup::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionGroup::GetClassData() const { return &_class_data_; }
+
+
+void SessionGroup::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionGroup*>(&to_msg);
+  auto& from = static_cast<const SessionGroup&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.SessionGroup)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hparams_.MergeFrom(from._impl_.hparams_);
+  _this->_impl_.metric_values_.MergeFrom(from._impl_.metric_values_);
+  _this->_impl_.sessions_.MergeFrom(from._impl_.sessions_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_monitor_url().empty()) {
+    _this->_internal_set_monitor_url(from._internal_monitor_url());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionGroup::CopyFrom(const SessionGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.SessionGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionGroup::IsInitialized() const {
+  return true;
+}
+
+void SessionGroup::InternalSwap(SessionGroup* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hparams_.InternalSwap(&other->_impl_.hparams_);
+  _impl_.metric_values_.InternalSwap(&other->_impl_.metric_values_);
+  _impl_.sessions_.InternalSwap(&other->_impl_.sessions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.monitor_url_, lhs_arena,
+      &other->_impl_.monitor_url_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionGroup::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[6]);
+}
+
+// ===================================================================
+
+class MetricValue::_Internal {
+ public:
+  static const ::tensorboard::hparams::MetricName& name(const MetricValue* msg);
+};
+
+const ::tensorboard::hparams::MetricName&
+MetricValue::_Internal::name(const MetricValue* msg) {
+  return *msg->_impl_.name_;
+}
+MetricValue::MetricValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.MetricValue)
+}
+MetricValue::MetricValue(const MetricValue& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetricValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){nullptr}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.wall_time_secs_){}
+    , decltype(_impl_.training_step_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_name()) {
+    _this->_impl_.name_ = new ::tensorboard::hparams::MetricName(*from._impl_.name_);
+  }
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.training_step_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.training_step_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.MetricValue)
+}
+
+inline void MetricValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){nullptr}
+    , decltype(_impl_.value_){0}
+    , decltype(_impl_.wall_time_secs_){0}
+    , decltype(_impl_.training_step_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MetricValue::~MetricValue() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.MetricValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetricValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.name_;
+}
+
+void MetricValue::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetricValue::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.MetricValue)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.name_ != nullptr) {
+    delete _impl_.name_;
+  }
+  _impl_.name_ = nullptr;
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.training_step_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.training_step_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetricValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .tensorboard.hparams.MetricName name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 training_step = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.training_step_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double wall_time_secs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.wall_time_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetricValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.MetricValue)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .tensorboard.hparams.MetricName name = 1;
+  if (this->_internal_has_name()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::name(this),
+        _Internal::name(this).GetCachedSize(), target, stream);
+  }
+
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
+  }
+
+  // int32 training_step = 3;
+  if (this->_internal_training_step() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_training_step(), target);
+  }
+
+  // double wall_time_secs = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_wall_time_secs = this->_internal_wall_time_secs();
+  uint64_t raw_wall_time_secs;
+  memcpy(&raw_wall_time_secs, &tmp_wall_time_secs, sizeof(tmp_wall_time_secs));
+  if (raw_wall_time_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_wall_time_secs(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.MetricValue)
+  return target;
+}
+
+size_t MetricValue::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.MetricValue)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .tensorboard.hparams.MetricName name = 1;
+  if (this->_internal_has_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.name_);
+  }
+
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double wall_time_secs = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_wall_time_secs = this->_internal_wall_time_secs();
+  uint64_t raw_wall_time_secs;
+  memcpy(&raw_wall_time_secs, &tmp_wall_time_secs, sizeof(tmp_wall_time_secs));
+  if (raw_wall_time_secs != 0) {
+    total_size += 1 + 8;
+  }
+
+  // int32 training_step = 3;
+  if (this->_internal_training_step() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_training_step());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetricValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetricValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetricValue::GetClassData() const { return &_class_data_; }
+
+
+void MetricValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetricValue*>(&to_msg);
+  auto& from = static_cast<const MetricValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.MetricValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_name()) {
+    _this->_internal_mutable_name()->::tensorboard::hparams::MetricName::MergeFrom(
+        from._internal_name());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_wall_time_secs = from._internal_wall_time_secs();
+  uint64_t raw_wall_time_secs;
+  memcpy(&raw_wall_time_secs, &tmp_wall_time_secs, sizeof(tmp_wall_time_secs));
+  if (raw_wall_time_secs != 0) {
+    _this->_internal_set_wall_time_secs(from._internal_wall_time_secs());
+  }
+  if (from._internal_training_step() != 0) {
+    _this->_internal_set_training_step(from._internal_training_step());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetricValue::CopyFrom(const MetricValue& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.MetricValue)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetricValue::IsInitialized() const {
+  return true;
+}
+
+void MetricValue::InternalSwap(MetricValue* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetricValue, _impl_.training_step_)
+      + sizeof(MetricValue::_impl_.training_step_)
+      - PROTOBUF_FIELD_OFFSET(MetricValue, _impl_.name_)>(
+          reinterpret_cast<char*>(&_impl_.name_),
+          reinterpret_cast<char*>(&other->_impl_.name_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetricValue::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[7]);
+}
+
+// ===================================================================
+
+class Session::_Internal {
+ public:
+};
+
+Session::Session(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.Session)
+}
+Session::Session(const Session& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Session* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metric_values_){from._impl_.metric_values_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.model_uri_){}
+    , decltype(_impl_.monitor_url_){}
+    , decltype(_impl_.start_time_secs_){}
+    , decltype(_impl_.end_time_secs_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.model_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_model_uri().empty()) {
+    _this->_impl_.model_uri_.Set(from._internal_model_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.monitor_url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_monitor_url().empty()) {
+    _this->_impl_.monitor_url_.Set(from._internal_monitor_url(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.start_time_secs_, &from._impl_.start_time_secs_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.start_time_secs_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.Session)
+}
+
+inline void Session::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metric_values_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.model_uri_){}
+    , decltype(_impl_.monitor_url_){}
+    , decltype(_impl_.start_time_secs_){0}
+    , decltype(_impl_.end_time_secs_){0}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.model_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.monitor_url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Session::~Session() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.Session)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Session::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.metric_values_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.model_uri_.Destroy();
+  _impl_.monitor_url_.Destroy();
+}
+
+void Session::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Session::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.Session)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.metric_values_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.model_uri_.ClearToEmpty();
+  _impl_.monitor_url_.ClearToEmpty();
+  ::memset(&_impl_.start_time_secs_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.start_time_secs_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Session::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.Session.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double start_time_secs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.start_time_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double end_time_secs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.end_time_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.Status status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::tensorboard::hparams::Status>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string model_uri = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_model_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.Session.model_uri"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorboard.hparams.MetricValue metric_values = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metric_values(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string monitor_url = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_monitor_url();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.Session.monitor_url"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Session::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.Session)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.Session.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // double start_time_secs = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_start_time_secs = this->_internal_start_time_secs();
+  uint64_t raw_start_time_secs;
+  memcpy(&raw_start_time_secs, &tmp_start_time_secs, sizeof(tmp_start_time_secs));
+  if (raw_start_time_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_start_time_secs(), target);
+  }
+
+  // double end_time_secs = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_end_time_secs = this->_internal_end_time_secs();
+  uint64_t raw_end_time_secs;
+  memcpy(&raw_end_time_secs, &tmp_end_time_secs, sizeof(tmp_end_time_secs));
+  if (raw_end_time_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_end_time_secs(), target);
+  }
+
+  // .tensorboard.hparams.Status status = 4;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_status(), target);
+  }
+
+  // string model_uri = 5;
+  if (!this->_internal_model_uri().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_model_uri().data(), static_cast<int>(this->_internal_model_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.Session.model_uri");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_model_uri(), target);
+  }
+
+  // repeated .tensorboard.hparams.MetricValue metric_values = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metric_values_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metric_values(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string monitor_url = 7;
+  if (!this->_internal_monitor_url().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_monitor_url().data(), static_cast<int>(this->_internal_monitor_url().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.Session.monitor_url");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_monitor_url(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.Session)
+  return target;
+}
+
+size_t Session::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.Session)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tensorboard.hparams.MetricValue metric_values = 6;
+  total_size += 1UL * this->_internal_metric_values_size();
+  for (const auto& msg : this->_impl_.metric_values_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string model_uri = 5;
+  if (!this->_internal_model_uri().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_model_uri());
+  }
+
+  // string monitor_url = 7;
+  if (!this->_internal_monitor_url().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_monitor_url());
+  }
+
+  // double start_time_secs = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_start_time_secs = this->_internal_start_time_secs();
+  uint64_t raw_start_time_secs;
+  memcpy(&raw_start_time_secs, &tmp_start_time_secs, sizeof(tmp_start_time_secs));
+  if (raw_start_time_secs != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double end_time_secs = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_end_time_secs = this->_internal_end_time_secs();
+  uint64_t raw_end_time_secs;
+  memcpy(&raw_end_time_secs, &tmp_end_time_secs, sizeof(tmp_end_time_secs));
+  if (raw_end_time_secs != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .tensorboard.hparams.Status status = 4;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Session::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Session::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Session::GetClassData() const { return &_class_data_; }
+
+
+void Session::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Session*>(&to_msg);
+  auto& from = static_cast<const Session&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.Session)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.metric_values_.MergeFrom(from._impl_.metric_values_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_model_uri().empty()) {
+    _this->_internal_set_model_uri(from._internal_model_uri());
+  }
+  if (!from._internal_monitor_url().empty()) {
+    _this->_internal_set_monitor_url(from._internal_monitor_url());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_start_time_secs = from._internal_start_time_secs();
+  uint64_t raw_start_time_secs;
+  memcpy(&raw_start_time_secs, &tmp_start_time_secs, sizeof(tmp_start_time_secs));
+  if (raw_start_time_secs != 0) {
+    _this->_internal_set_start_time_secs(from._internal_start_time_secs());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_end_time_secs = from._internal_end_time_secs();
+  uint64_t raw_end_time_secs;
+  memcpy(&raw_end_time_secs, &tmp_end_time_secs, sizeof(tmp_end_time_secs));
+  if (raw_end_time_secs != 0) {
+    _this->_internal_set_end_time_secs(from._internal_end_time_secs());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Session::CopyFrom(const Session& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.Session)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Session::IsInitialized() const {
+  return true;
+}
+
+void Session::InternalSwap(Session* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.metric_values_.InternalSwap(&other->_impl_.metric_values_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.model_uri_, lhs_arena,
+      &other->_impl_.model_uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.monitor_url_, lhs_arena,
+      &other->_impl_.monitor_url_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Session, _impl_.status_)
+      + sizeof(Session::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(Session, _impl_.start_time_secs_)>(
+          reinterpret_cast<char*>(&_impl_.start_time_secs_),
+          reinterpret_cast<char*>(&other->_impl_.start_time_secs_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Session::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[8]);
+}
+
+// ===================================================================
+
+class GetExperimentRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetExperimentRequest>()._impl_._has_bits_);
+  static void set_has_include_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_hparams_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+GetExperimentRequest::GetExperimentRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.GetExperimentRequest)
+}
+GetExperimentRequest::GetExperimentRequest(const GetExperimentRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetExperimentRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.experiment_name_){}
+    , decltype(_impl_.include_metrics_){}
+    , decltype(_impl_.hparams_limit_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.experiment_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_experiment_name().empty()) {
+    _this->_impl_.experiment_name_.Set(from._internal_experiment_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.include_metrics_, &from._impl_.include_metrics_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hparams_limit_) -
+    reinterpret_cast<char*>(&_impl_.include_metrics_)) + sizeof(_impl_.hparams_limit_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.GetExperimentRequest)
+}
+
+inline void GetExperimentRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.experiment_name_){}
+    , decltype(_impl_.include_metrics_){false}
+    , decltype(_impl_.hparams_limit_){0}
+  };
+  _impl_.experiment_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetExperimentRequest::~GetExperimentRequest() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.GetExperimentRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetExperimentRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.experiment_name_.Destroy();
+}
+
+void GetExperimentRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetExperimentRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.GetExperimentRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.experiment_name_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.include_metrics_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.hparams_limit_) -
+        reinterpret_cast<char*>(&_impl_.include_metrics_)) + sizeof(_impl_.hparams_limit_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetExperimentRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string experiment_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_experiment_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.GetExperimentRequest.experiment_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool include_metrics = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_include_metrics(&has_bits);
+          _impl_.include_metrics_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 hparams_limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_hparams_limit(&has_bits);
+          _impl_.hparams_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetExperimentRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.GetExperimentRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string experiment_name = 1;
+  if (!this->_internal_experiment_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_experiment_name().data(), static_cast<int>(this->_internal_experiment_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.GetExperimentRequest.experiment_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_experiment_name(), target);
+  }
+
+  // optional bool include_metrics = 2;
+  if (_internal_has_include_metrics()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_include_metrics(), target);
+  }
+
+  // optional int32 hparams_limit = 3;
+  if (_internal_has_hparams_limit()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_hparams_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.GetExperimentRequest)
+  return target;
+}
+
+size_t GetExperimentRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.GetExperimentRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string experiment_name = 1;
+  if (!this->_internal_experiment_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_experiment_name());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bool include_metrics = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int32 hparams_limit = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_hparams_limit());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetExperimentRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetExperimentRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetExperimentRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetExperimentRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetExperimentRequest*>(&to_msg);
+  auto& from = static_cast<const GetExperimentRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.GetExperimentRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_experiment_name().empty()) {
+    _this->_internal_set_experiment_name(from._internal_experiment_name());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.include_metrics_ = from._impl_.include_metrics_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.hparams_limit_ = from._impl_.hparams_limit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetExperimentRequest::CopyFrom(const GetExperimentRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.GetExperimentRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetExperimentRequest::IsInitialized() const {
+  return true;
+}
+
+void GetExperimentRequest::InternalSwap(GetExperimentRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.experiment_name_, lhs_arena,
+      &other->_impl_.experiment_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetExperimentRequest, _impl_.hparams_limit_)
+      + sizeof(GetExperimentRequest::_impl_.hparams_limit_)
+      - PROTOBUF_FIELD_OFFSET(GetExperimentRequest, _impl_.include_metrics_)>(
+          reinterpret_cast<char*>(&_impl_.include_metrics_),
+          reinterpret_cast<char*>(&other->_impl_.include_metrics_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetExperimentRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[9]);
+}
+
+// ===================================================================
+
+class ListSessionGroupsRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ListSessionGroupsRequest>()._impl_._has_bits_);
+  static const ::tensorboard::hparams::MetricName& aggregation_metric(const ListSessionGroupsRequest* msg);
+  static void set_has_include_metrics(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::tensorboard::hparams::MetricName&
+ListSessionGroupsRequest::_Internal::aggregation_metric(const ListSessionGroupsRequest* msg) {
+  return *msg->_impl_.aggregation_metric_;
+}
+ListSessionGroupsRequest::ListSessionGroupsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.ListSessionGroupsRequest)
+}
+ListSessionGroupsRequest::ListSessionGroupsRequest(const ListSessionGroupsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListSessionGroupsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.col_params_){from._impl_.col_params_}
+    , decltype(_impl_.allowed_statuses_){from._impl_.allowed_statuses_}
+    , /*decltype(_impl_._allowed_statuses_cached_byte_size_)*/{0}
+    , decltype(_impl_.experiment_name_){}
+    , decltype(_impl_.aggregation_metric_){nullptr}
+    , decltype(_impl_.aggregation_type_){}
+    , decltype(_impl_.start_index_){}
+    , decltype(_impl_.slice_size_){}
+    , decltype(_impl_.include_metrics_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.experiment_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_experiment_name().empty()) {
+    _this->_impl_.experiment_name_.Set(from._internal_experiment_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_aggregation_metric()) {
+    _this->_impl_.aggregation_metric_ = new ::tensorboard::hparams::MetricName(*from._impl_.aggregation_metric_);
+  }
+  ::memcpy(&_impl_.aggregation_type_, &from._impl_.aggregation_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.include_metrics_) -
+    reinterpret_cast<char*>(&_impl_.aggregation_type_)) + sizeof(_impl_.include_metrics_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.ListSessionGroupsRequest)
+}
+
+inline void ListSessionGroupsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.col_params_){arena}
+    , decltype(_impl_.allowed_statuses_){arena}
+    , /*decltype(_impl_._allowed_statuses_cached_byte_size_)*/{0}
+    , decltype(_impl_.experiment_name_){}
+    , decltype(_impl_.aggregation_metric_){nullptr}
+    , decltype(_impl_.aggregation_type_){0}
+    , decltype(_impl_.start_index_){0}
+    , decltype(_impl_.slice_size_){0}
+    , decltype(_impl_.include_metrics_){false}
+  };
+  _impl_.experiment_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ListSessionGroupsRequest::~ListSessionGroupsRequest() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.ListSessionGroupsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ListSessionGroupsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.col_params_.~RepeatedPtrField();
+  _impl_.allowed_statuses_.~RepeatedField();
+  _impl_.experiment_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.aggregation_metric_;
+}
+
+void ListSessionGroupsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ListSessionGroupsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.ListSessionGroupsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.col_params_.Clear();
+  _impl_.allowed_statuses_.Clear();
+  _impl_.experiment_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.aggregation_metric_ != nullptr) {
+    delete _impl_.aggregation_metric_;
+  }
+  _impl_.aggregation_metric_ = nullptr;
+  ::memset(&_impl_.aggregation_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.slice_size_) -
+      reinterpret_cast<char*>(&_impl_.aggregation_type_)) + sizeof(_impl_.slice_size_));
+  _impl_.include_metrics_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ListSessionGroupsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .tensorboard.hparams.ColParams col_params = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_col_params(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.AggregationType aggregation_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_aggregation_type(static_cast<::tensorboard::hparams::AggregationType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.MetricName aggregation_metric = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_aggregation_metric(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 start_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.start_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 slice_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.slice_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string experiment_name = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_experiment_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.ListSessionGroupsRequest.experiment_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorboard.hparams.Status allowed_statuses = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(_internal_mutable_allowed_statuses(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_add_allowed_statuses(static_cast<::tensorboard::hparams::Status>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool include_metrics = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_include_metrics(&has_bits);
+          _impl_.include_metrics_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ListSessionGroupsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.ListSessionGroupsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .tensorboard.hparams.ColParams col_params = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_col_params_size()); i < n; i++) {
+    const auto& repfield = this->_internal_col_params(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .tensorboard.hparams.AggregationType aggregation_type = 2;
+  if (this->_internal_aggregation_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_aggregation_type(), target);
+  }
+
+  // .tensorboard.hparams.MetricName aggregation_metric = 3;
+  if (this->_internal_has_aggregation_metric()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::aggregation_metric(this),
+        _Internal::aggregation_metric(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 start_index = 4;
+  if (this->_internal_start_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_start_index(), target);
+  }
+
+  // int32 slice_size = 5;
+  if (this->_internal_slice_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_slice_size(), target);
+  }
+
+  // string experiment_name = 6;
+  if (!this->_internal_experiment_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_experiment_name().data(), static_cast<int>(this->_internal_experiment_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.ListSessionGroupsRequest.experiment_name");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_experiment_name(), target);
+  }
+
+  // repeated .tensorboard.hparams.Status allowed_statuses = 7;
+  {
+    int byte_size = _impl_._allowed_statuses_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          7, _impl_.allowed_statuses_, byte_size, target);
+    }
+  }
+
+  // optional bool include_metrics = 8;
+  if (_internal_has_include_metrics()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_include_metrics(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.ListSessionGroupsRequest)
+  return target;
+}
+
+size_t ListSessionGroupsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.ListSessionGroupsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tensorboard.hparams.ColParams col_params = 1;
+  total_size += 1UL * this->_internal_col_params_size();
+  for (const auto& msg : this->_impl_.col_params_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .tensorboard.hparams.Status allowed_statuses = 7;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_allowed_statuses_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_allowed_statuses(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._allowed_statuses_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string experiment_name = 6;
+  if (!this->_internal_experiment_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_experiment_name());
+  }
+
+  // .tensorboard.hparams.MetricName aggregation_metric = 3;
+  if (this->_internal_has_aggregation_metric()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.aggregation_metric_);
+  }
+
+  // .tensorboard.hparams.AggregationType aggregation_type = 2;
+  if (this->_internal_aggregation_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_aggregation_type());
+  }
+
+  // int32 start_index = 4;
+  if (this->_internal_start_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_start_index());
+  }
+
+  // int32 slice_size = 5;
+  if (this->_internal_slice_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slice_size());
+  }
+
+  // optional bool include_metrics = 8;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListSessionGroupsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListSessionGroupsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListSessionGroupsRequest::GetClassData() const { return &_class_data_; }
+
+
+void ListSessionGroupsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListSessionGroupsRequest*>(&to_msg);
+  auto& from = static_cast<const ListSessionGroupsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.ListSessionGroupsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.col_params_.MergeFrom(from._impl_.col_params_);
+  _this->_impl_.allowed_statuses_.MergeFrom(from._impl_.allowed_statuses_);
+  if (!from._internal_experiment_name().empty()) {
+    _this->_internal_set_experiment_name(from._internal_experiment_name());
+  }
+  if (from._internal_has_aggregation_metric()) {
+    _this->_internal_mutable_aggregation_metric()->::tensorboard::hparams::MetricName::MergeFrom(
+        from._internal_aggregation_metric());
+  }
+  if (from._internal_aggregation_type() != 0) {
+    _this->_internal_set_aggregation_type(from._internal_aggregation_type());
+  }
+  if (from._internal_start_index() != 0) {
+    _this->_internal_set_start_index(from._internal_start_index());
+  }
+  if (from._internal_slice_size() != 0) {
+    _this->_internal_set_slice_size(from._internal_slice_size());
+  }
+  if (from._internal_has_include_metrics()) {
+    _this->_internal_set_include_metrics(from._internal_include_metrics());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListSessionGroupsRequest::CopyFrom(const ListSessionGroupsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.ListSessionGroupsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListSessionGroupsRequest::IsInitialized() const {
+  return true;
+}
+
+void ListSessionGroupsRequest::InternalSwap(ListSessionGroupsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.col_params_.InternalSwap(&other->_impl_.col_params_);
+  _impl_.allowed_statuses_.InternalSwap(&other->_impl_.allowed_statuses_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.experiment_name_, lhs_arena,
+      &other->_impl_.experiment_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ListSessionGroupsRequest, _impl_.include_metrics_)
+      + sizeof(ListSessionGroupsRequest::_impl_.include_metrics_)
+      - PROTOBUF_FIELD_OFFSET(ListSessionGroupsRequest, _impl_.aggregation_metric_)>(
+          reinterpret_cast<char*>(&_impl_.aggregation_metric_),
+          reinterpret_cast<char*>(&other->_impl_.aggregation_metric_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListSessionGroupsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[10]);
+}
+
+// ===================================================================
+
+class ColParams::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ColParams>()._impl_._has_bits_);
+  static const ::tensorboard::hparams::MetricName& metric(const ColParams* msg);
+  static const ::tensorboard::hparams::Interval& filter_interval(const ColParams* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::ListValue& filter_discrete(const ColParams* msg);
+  static void set_has_include_in_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::tensorboard::hparams::MetricName&
+ColParams::_Internal::metric(const ColParams* msg) {
+  return *msg->_impl_.name_.metric_;
+}
+const ::tensorboard::hparams::Interval&
+ColParams::_Internal::filter_interval(const ColParams* msg) {
+  return *msg->_impl_.filter_.filter_interval_;
+}
+const ::PROTOBUF_NAMESPACE_ID::ListValue&
+ColParams::_Internal::filter_discrete(const ColParams* msg) {
+  return *msg->_impl_.filter_.filter_discrete_;
+}
+void ColParams::set_allocated_metric(::tensorboard::hparams::MetricName* metric) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_name();
+  if (metric) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(metric);
+    if (message_arena != submessage_arena) {
+      metric = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, metric, submessage_arena);
+    }
+    set_has_metric();
+    _impl_.name_.metric_ = metric;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ColParams.metric)
+}
+void ColParams::set_allocated_filter_interval(::tensorboard::hparams::Interval* filter_interval) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_filter();
+  if (filter_interval) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(filter_interval);
+    if (message_arena != submessage_arena) {
+      filter_interval = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, filter_interval, submessage_arena);
+    }
+    set_has_filter_interval();
+    _impl_.filter_.filter_interval_ = filter_interval;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ColParams.filter_interval)
+}
+void ColParams::set_allocated_filter_discrete(::PROTOBUF_NAMESPACE_ID::ListValue* filter_discrete) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_filter();
+  if (filter_discrete) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(filter_discrete));
+    if (message_arena != submessage_arena) {
+      filter_discrete = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, filter_discrete, submessage_arena);
+    }
+    set_has_filter_discrete();
+    _impl_.filter_.filter_discrete_ = filter_discrete;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.ColParams.filter_discrete)
+}
+void ColParams::clear_filter_discrete() {
+  if (_internal_has_filter_discrete()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.filter_.filter_discrete_;
+    }
+    clear_has_filter();
+  }
+}
+ColParams::ColParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.ColParams)
+}
+ColParams::ColParams(const ColParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ColParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.order_){}
+    , decltype(_impl_.missing_values_first_){}
+    , decltype(_impl_.exclude_missing_values_){}
+    , decltype(_impl_.include_in_result_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.filter_){}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.order_, &from._impl_.order_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.include_in_result_) -
+    reinterpret_cast<char*>(&_impl_.order_)) + sizeof(_impl_.include_in_result_));
+  clear_has_name();
+  switch (from.name_case()) {
+    case kMetric: {
+      _this->_internal_mutable_metric()->::tensorboard::hparams::MetricName::MergeFrom(
+          from._internal_metric());
+      break;
+    }
+    case kHparam: {
+      _this->_internal_set_hparam(from._internal_hparam());
+      break;
+    }
+    case NAME_NOT_SET: {
+      break;
+    }
+  }
+  clear_has_filter();
+  switch (from.filter_case()) {
+    case kFilterRegexp: {
+      _this->_internal_set_filter_regexp(from._internal_filter_regexp());
+      break;
+    }
+    case kFilterInterval: {
+      _this->_internal_mutable_filter_interval()->::tensorboard::hparams::Interval::MergeFrom(
+          from._internal_filter_interval());
+      break;
+    }
+    case kFilterDiscrete: {
+      _this->_internal_mutable_filter_discrete()->::PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(
+          from._internal_filter_discrete());
+      break;
+    }
+    case FILTER_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.ColParams)
+}
+
+inline void ColParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.order_){0}
+    , decltype(_impl_.missing_values_first_){false}
+    , decltype(_impl_.exclude_missing_values_){false}
+    , decltype(_impl_.include_in_result_){false}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.filter_){}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_name();
+  clear_has_filter();
+}
+
+ColParams::~ColParams() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.ColParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ColParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_name()) {
+    clear_name();
+  }
+  if (has_filter()) {
+    clear_filter();
+  }
+}
+
+void ColParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ColParams::clear_name() {
+// @@protoc_insertion_point(one_of_clear_start:tensorboard.hparams.ColParams)
+  switch (name_case()) {
+    case kMetric: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.name_.metric_;
+      }
+      break;
+    }
+    case kHparam: {
+      _impl_.name_.hparam_.Destroy();
+      break;
+    }
+    case NAME_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = NAME_NOT_SET;
+}
+
+void ColParams::clear_filter() {
+// @@protoc_insertion_point(one_of_clear_start:tensorboard.hparams.ColParams)
+  switch (filter_case()) {
+    case kFilterRegexp: {
+      _impl_.filter_.filter_regexp_.Destroy();
+      break;
+    }
+    case kFilterInterval: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.filter_.filter_interval_;
+      }
+      break;
+    }
+    case kFilterDiscrete: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.filter_.filter_discrete_;
+      }
+      break;
+    }
+    case FILTER_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[1] = FILTER_NOT_SET;
+}
+
+
+void ColParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.ColParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.order_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.exclude_missing_values_) -
+      reinterpret_cast<char*>(&_impl_.order_)) + sizeof(_impl_.exclude_missing_values_));
+  _impl_.include_in_result_ = false;
+  clear_name();
+  clear_filter();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ColParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .tensorboard.hparams.MetricName metric = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_metric(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string hparam = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_hparam();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.ColParams.hparam"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.SortOrder order = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_order(static_cast<::tensorboard::hparams::SortOrder>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool missing_values_first = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.missing_values_first_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string filter_regexp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_filter_regexp();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.ColParams.filter_regexp"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.Interval filter_interval = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filter_interval(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.ListValue filter_discrete = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filter_discrete(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool exclude_missing_values = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.exclude_missing_values_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool include_in_result = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_include_in_result(&has_bits);
+          _impl_.include_in_result_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ColParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.ColParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .tensorboard.hparams.MetricName metric = 1;
+  if (_internal_has_metric()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::metric(this),
+        _Internal::metric(this).GetCachedSize(), target, stream);
+  }
+
+  // string hparam = 2;
+  if (_internal_has_hparam()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hparam().data(), static_cast<int>(this->_internal_hparam().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.ColParams.hparam");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_hparam(), target);
+  }
+
+  // .tensorboard.hparams.SortOrder order = 3;
+  if (this->_internal_order() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_order(), target);
+  }
+
+  // bool missing_values_first = 4;
+  if (this->_internal_missing_values_first() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_missing_values_first(), target);
+  }
+
+  // string filter_regexp = 5;
+  if (_internal_has_filter_regexp()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_filter_regexp().data(), static_cast<int>(this->_internal_filter_regexp().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.ColParams.filter_regexp");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_filter_regexp(), target);
+  }
+
+  // .tensorboard.hparams.Interval filter_interval = 6;
+  if (_internal_has_filter_interval()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::filter_interval(this),
+        _Internal::filter_interval(this).GetCachedSize(), target, stream);
+  }
+
+  // .google.protobuf.ListValue filter_discrete = 7;
+  if (_internal_has_filter_discrete()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::filter_discrete(this),
+        _Internal::filter_discrete(this).GetCachedSize(), target, stream);
+  }
+
+  // bool exclude_missing_values = 8;
+  if (this->_internal_exclude_missing_values() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_exclude_missing_values(), target);
+  }
+
+  // optional bool include_in_result = 9;
+  if (_internal_has_include_in_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_include_in_result(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.ColParams)
+  return target;
+}
+
+size_t ColParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.ColParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .tensorboard.hparams.SortOrder order = 3;
+  if (this->_internal_order() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_order());
+  }
+
+  // bool missing_values_first = 4;
+  if (this->_internal_missing_values_first() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool exclude_missing_values = 8;
+  if (this->_internal_exclude_missing_values() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // optional bool include_in_result = 9;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  switch (name_case()) {
+    // .tensorboard.hparams.MetricName metric = 1;
+    case kMetric: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.name_.metric_);
+      break;
+    }
+    // string hparam = 2;
+    case kHparam: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_hparam());
+      break;
+    }
+    case NAME_NOT_SET: {
+      break;
+    }
+  }
+  switch (filter_case()) {
+    // string filter_regexp = 5;
+    case kFilterRegexp: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_filter_regexp());
+      break;
+    }
+    // .tensorboard.hparams.Interval filter_interval = 6;
+    case kFilterInterval: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.filter_.filter_interval_);
+      break;
+    }
+    // .google.protobuf.ListValue filter_discrete = 7;
+    case kFilterDiscrete: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.filter_.filter_discrete_);
+      break;
+    }
+    case FILTER_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ColParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ColParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ColParams::GetClassData() const { return &_class_data_; }
+
+
+void ColParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ColParams*>(&to_msg);
+  auto& from = static_cast<const ColParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.ColParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_order() != 0) {
+    _this->_internal_set_order(from._internal_order());
+  }
+  if (from._internal_missing_values_first() != 0) {
+    _this->_internal_set_missing_values_first(from._internal_missing_values_first());
+  }
+  if (from._internal_exclude_missing_values() != 0) {
+    _this->_internal_set_exclude_missing_values(from._internal_exclude_missing_values());
+  }
+  if (from._internal_has_include_in_result()) {
+    _this->_internal_set_include_in_result(from._internal_include_in_result());
+  }
+  switch (from.name_case()) {
+    case kMetric: {
+      _this->_internal_mutable_metric()->::tensorboard::hparams::MetricName::MergeFrom(
+          from._internal_metric());
+      break;
+    }
+    case kHparam: {
+      _this->_internal_set_hparam(from._internal_hparam());
+      break;
+    }
+    case NAME_NOT_SET: {
+      break;
+    }
+  }
+  switch (from.filter_case()) {
+    case kFilterRegexp: {
+      _this->_internal_set_filter_regexp(from._internal_filter_regexp());
+      break;
+    }
+    case kFilterInterval: {
+      _this->_internal_mutable_filter_interval()->::tensorboard::hparams::Interval::MergeFrom(
+          from._internal_filter_interval());
+      break;
+    }
+    case kFilterDiscrete: {
+      _this->_internal_mutable_filter_discrete()->::PROTOBUF_NAMESPACE_ID::ListValue::MergeFrom(
+          from._internal_filter_discrete());
+      break;
+    }
+    case FILTER_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ColParams::CopyFrom(const ColParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.ColParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ColParams::IsInitialized() const {
+  return true;
+}
+
+void ColParams::InternalSwap(ColParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ColParams, _impl_.include_in_result_)
+      + sizeof(ColParams::_impl_.include_in_result_)
+      - PROTOBUF_FIELD_OFFSET(ColParams, _impl_.order_)>(
+          reinterpret_cast<char*>(&_impl_.order_),
+          reinterpret_cast<char*>(&other->_impl_.order_));
+  swap(_impl_.name_, other->_impl_.name_);
+  swap(_impl_.filter_, other->_impl_.filter_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+  swap(_impl_._oneof_case_[1], other->_impl_._oneof_case_[1]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ColParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[11]);
+}
+
+// ===================================================================
+
+class ListSessionGroupsResponse::_Internal {
+ public:
+};
+
+ListSessionGroupsResponse::ListSessionGroupsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.ListSessionGroupsResponse)
+}
+ListSessionGroupsResponse::ListSessionGroupsResponse(const ListSessionGroupsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListSessionGroupsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_groups_){from._impl_.session_groups_}
+    , decltype(_impl_.total_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.total_size_ = from._impl_.total_size_;
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.ListSessionGroupsResponse)
+}
+
+inline void ListSessionGroupsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_groups_){arena}
+    , decltype(_impl_.total_size_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ListSessionGroupsResponse::~ListSessionGroupsResponse() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.ListSessionGroupsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ListSessionGroupsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_groups_.~RepeatedPtrField();
+}
+
+void ListSessionGroupsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ListSessionGroupsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.ListSessionGroupsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_groups_.Clear();
+  _impl_.total_size_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ListSessionGroupsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .tensorboard.hparams.SessionGroup session_groups = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_session_groups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 total_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ListSessionGroupsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.ListSessionGroupsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .tensorboard.hparams.SessionGroup session_groups = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_session_groups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_session_groups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 total_size = 3;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_total_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.ListSessionGroupsResponse)
+  return target;
+}
+
+size_t ListSessionGroupsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.ListSessionGroupsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tensorboard.hparams.SessionGroup session_groups = 1;
+  total_size += 1UL * this->_internal_session_groups_size();
+  for (const auto& msg : this->_impl_.session_groups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 total_size = 3;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListSessionGroupsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListSessionGroupsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListSessionGroupsResponse::GetClassData() const { return &_class_data_; }
+
+
+void ListSessionGroupsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListSessionGroupsResponse*>(&to_msg);
+  auto& from = static_cast<const ListSessionGroupsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.ListSessionGroupsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.session_groups_.MergeFrom(from._impl_.session_groups_);
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListSessionGroupsResponse::CopyFrom(const ListSessionGroupsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.ListSessionGroupsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListSessionGroupsResponse::IsInitialized() const {
+  return true;
+}
+
+void ListSessionGroupsResponse::InternalSwap(ListSessionGroupsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.session_groups_.InternalSwap(&other->_impl_.session_groups_);
+  swap(_impl_.total_size_, other->_impl_.total_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListSessionGroupsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[12]);
+}
+
+// ===================================================================
+
+class ListMetricEvalsRequest::_Internal {
+ public:
+  static const ::tensorboard::hparams::MetricName& metric_name(const ListMetricEvalsRequest* msg);
+};
+
+const ::tensorboard::hparams::MetricName&
+ListMetricEvalsRequest::_Internal::metric_name(const ListMetricEvalsRequest* msg) {
+  return *msg->_impl_.metric_name_;
+}
+ListMetricEvalsRequest::ListMetricEvalsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.ListMetricEvalsRequest)
+}
+ListMetricEvalsRequest::ListMetricEvalsRequest(const ListMetricEvalsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListMetricEvalsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_name_){}
+    , decltype(_impl_.experiment_name_){}
+    , decltype(_impl_.metric_name_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_name().empty()) {
+    _this->_impl_.session_name_.Set(from._internal_session_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.experiment_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_experiment_name().empty()) {
+    _this->_impl_.experiment_name_.Set(from._internal_experiment_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_metric_name()) {
+    _this->_impl_.metric_name_ = new ::tensorboard::hparams::MetricName(*from._impl_.metric_name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.ListMetricEvalsRequest)
+}
+
+inline void ListMetricEvalsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_name_){}
+    , decltype(_impl_.experiment_name_){}
+    , decltype(_impl_.metric_name_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.experiment_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.experiment_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ListMetricEvalsRequest::~ListMetricEvalsRequest() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.ListMetricEvalsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ListMetricEvalsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_name_.Destroy();
+  _impl_.experiment_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.metric_name_;
+}
+
+void ListMetricEvalsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ListMetricEvalsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.ListMetricEvalsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_name_.ClearToEmpty();
+  _impl_.experiment_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.metric_name_ != nullptr) {
+    delete _impl_.metric_name_;
+  }
+  _impl_.metric_name_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ListMetricEvalsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string session_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_session_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.ListMetricEvalsRequest.session_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.MetricName metric_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_metric_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string experiment_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_experiment_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.ListMetricEvalsRequest.experiment_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ListMetricEvalsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.ListMetricEvalsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string session_name = 1;
+  if (!this->_internal_session_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_name().data(), static_cast<int>(this->_internal_session_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.ListMetricEvalsRequest.session_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_session_name(), target);
+  }
+
+  // .tensorboard.hparams.MetricName metric_name = 2;
+  if (this->_internal_has_metric_name()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::metric_name(this),
+        _Internal::metric_name(this).GetCachedSize(), target, stream);
+  }
+
+  // string experiment_name = 3;
+  if (!this->_internal_experiment_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_experiment_name().data(), static_cast<int>(this->_internal_experiment_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.ListMetricEvalsRequest.experiment_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_experiment_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.ListMetricEvalsRequest)
+  return target;
+}
+
+size_t ListMetricEvalsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.ListMetricEvalsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_name = 1;
+  if (!this->_internal_session_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_name());
+  }
+
+  // string experiment_name = 3;
+  if (!this->_internal_experiment_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_experiment_name());
+  }
+
+  // .tensorboard.hparams.MetricName metric_name = 2;
+  if (this->_internal_has_metric_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.metric_name_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListMetricEvalsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListMetricEvalsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListMetricEvalsRequest::GetClassData() const { return &_class_data_; }
+
+
+void ListMetricEvalsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListMetricEvalsRequest*>(&to_msg);
+  auto& from = static_cast<const ListMetricEvalsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.ListMetricEvalsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_name().empty()) {
+    _this->_internal_set_session_name(from._internal_session_name());
+  }
+  if (!from._internal_experiment_name().empty()) {
+    _this->_internal_set_experiment_name(from._internal_experiment_name());
+  }
+  if (from._internal_has_metric_name()) {
+    _this->_internal_mutable_metric_name()->::tensorboard::hparams::MetricName::MergeFrom(
+        from._internal_metric_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListMetricEvalsRequest::CopyFrom(const ListMetricEvalsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.ListMetricEvalsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListMetricEvalsRequest::IsInitialized() const {
+  return true;
+}
+
+void ListMetricEvalsRequest::InternalSwap(ListMetricEvalsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_name_, lhs_arena,
+      &other->_impl_.session_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.experiment_name_, lhs_arena,
+      &other->_impl_.experiment_name_, rhs_arena
+  );
+  swap(_impl_.metric_name_, other->_impl_.metric_name_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListMetricEvalsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_api_2eproto_getter, &descriptor_table_api_2eproto_once,
+      file_level_metadata_api_2eproto[13]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace hparams
+}  // namespace tensorboard
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::Experiment*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::Experiment >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::Experiment >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::HParamInfo*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::HParamInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::HParamInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::Interval*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::Interval >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::Interval >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::MetricName*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::MetricName >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::MetricName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::MetricInfo*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::MetricInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::MetricInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::SessionGroup_HparamsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::SessionGroup*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::SessionGroup >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::SessionGroup >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::MetricValue*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::MetricValue >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::MetricValue >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::Session*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::Session >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::Session >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::GetExperimentRequest*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::GetExperimentRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::GetExperimentRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::ListSessionGroupsRequest*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::ListSessionGroupsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::ListSessionGroupsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::ColParams*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::ColParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::ColParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::ListSessionGroupsResponse*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::ListSessionGroupsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::ListSessionGroupsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::ListMetricEvalsRequest*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::ListMetricEvalsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::ListMetricEvalsRequest >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -4,6 +4,13 @@
 #include <cstdint>
 #include <cstring>
 
+#include "crc.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TBL_CRC32C_X86 1
+#include <immintrin.h>
+#endif
+
 /**********************************************************************\
 |* Demonstration program to compute the 32-bit CRC used as the frame  *|
 |* check sequence in ADCCP (ANSI X3.66, also known as FIPS PUB 71     *|
@@ -220,21 +227,318 @@ int crc32file(char *name, uint32_t *crc, long *charcnt)
 
 uint32_t crc32buf(const char *buf, size_t len)
 {
-      uint32_t oldcrc32;
+      return crc32c_extend(0, buf, len);
+}
 
-      oldcrc32 = 0xFFFFFFFF;
+uint32_t masked_crc32c(const char *buf, size_t len) {
+    return mask_crc32c(crc32buf(buf, len));
+}
 
-      for ( ; len; --len, ++buf)
-      {
-            oldcrc32 = UPDC32(*buf, oldcrc32);
-      }
+uint32_t mask_crc32c(uint32_t crc) {
+    return (crc >> 15 | crc << 17) + 0xa282ead8;
+}
+
+/*
+ * Fast CRC32C.
+ *
+ * `crc_32_tab` above is the byte-at-a-time table for the Castagnoli
+ * polynomial, which is what TFRecord framing uses. The functions below compute
+ * exactly the same checksum, but faster:
+ *
+ *  - "portable": slicing-by-8, eight table lookups per 8 input bytes.
+ *  - "sse4.2": the `crc32` instruction on three interleaved streams, so that
+ *    its 3-cycle latency is hidden. The stream CRCs are merged with
+ *    precomputed "shift by N zero bytes" tables.
+ *  - "sse4.2+pclmul": same, but the streams are merged with a carry-less
+ *    multiply, which is cheaper than the table walk and lets large buffers use
+ *    long blocks.
+ *
+ * The implementation is chosen once, at first use, from the running CPU.
+ *
+ * All of them operate on the raw shift register (pre and post inversion is
+ * done by crc32c_extend).
+ */
+
+namespace {
 
-      return ~oldcrc32;
+const uint32_t kCrc32cPoly = 0x82f63b78;  // reflected Castagnoli polynomial
+
+// Multiply a(x) by b(x) modulo the CRC polynomial, both in reflected bit
+// order (the MSB is the x^0 coefficient). `a` must be non-zero.
+uint32_t multmodp(uint32_t a, uint32_t b) {
+    uint32_t m = 1u << 31, p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) break;
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ kCrc32cPoly : b >> 1;
+    }
+    return p;
 }
 
-uint32_t masked_crc32c(const char *buf, size_t len) {
-    uint32_t crc = crc32buf(buf, len);
-    return (crc >> 15 | crc << 17) + 0xa282ead8;
+// x^n modulo the CRC polynomial, in reflected bit order.
+uint32_t xnmodp(uint64_t n) {
+    uint32_t p = 1u << 31, sq = 1u << 30;
+    while (n) {
+        if (n & 1) p = multmodp(sq, p);
+        sq = multmodp(sq, sq);
+        n >>= 1;
+    }
+    return p;
+}
+
+// Table-driven version of "append `n` zero bytes to the shift register",
+// i.e. multiply by x^(8n). The operation is linear, so four 256-entry tables
+// indexed by the register bytes are enough.
+struct ShiftTable {
+    uint32_t tab[4][256];
+
+    void init(size_t n) {
+        uint32_t op = xnmodp(8 * static_cast<uint64_t>(n));
+        for (int k = 0; k < 4; ++k) {
+            for (uint32_t i = 0; i < 256; ++i) {
+                tab[k][i] = multmodp(op, i << (8 * k));
+            }
+        }
+    }
+
+    uint32_t shift(uint32_t crc) const {
+        return tab[0][crc & 0xff] ^ tab[1][(crc >> 8) & 0xff] ^
+               tab[2][(crc >> 16) & 0xff] ^ tab[3][crc >> 24];
+    }
+};
+
+// Block sizes (in bytes, per stream) for the three-way interleaved loops.
+const size_t kShortBlock = 256;
+const size_t kLongBlock = 8192;
+// With PCLMUL merging, the per-block merge cost no longer matters much, so
+// buffers that are large enough use a longer block to stay in the
+// interleaved loop with fewer merges.
+const size_t kHugeBlock = 32768;
+
+struct Crc32cTables {
+    uint32_t slice[8][256];
+    ShiftTable shift_short;
+    ShiftTable shift_long;
+    // Constants x^(8n - 33) for the carry-less merge of n-byte blocks, see
+    // clmul_shift() below.
+    uint32_t clmul_short;
+    uint32_t clmul_long;
+    uint32_t clmul_huge;
+
+    Crc32cTables() {
+        for (uint32_t i = 0; i < 256; ++i) slice[0][i] = crc_32_tab[i];
+        for (int k = 1; k < 8; ++k) {
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = slice[k - 1][i];
+                slice[k][i] = (c >> 8) ^ slice[0][c & 0xff];
+            }
+        }
+        shift_short.init(kShortBlock);
+        shift_long.init(kLongBlock);
+        clmul_short = xnmodp(8 * kShortBlock - 33);
+        clmul_long = xnmodp(8 * kLongBlock - 33);
+        clmul_huge = xnmodp(8 * kHugeBlock - 33);
+    }
+};
+
+const Crc32cTables &tables() {
+    static const Crc32cTables t;
+    return t;
+}
+
+inline uint64_t load_le64(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+uint32_t crc32c_slice8(uint32_t crc, const char *buf, size_t len) {
+    const Crc32cTables &t = tables();
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(buf);
+    while (len && (reinterpret_cast<uintptr_t>(p) & 7)) {
+        crc = t.slice[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+        --len;
+    }
+    while (len >= 8) {
+        uint64_t word = load_le64(p) ^ crc;
+        crc = t.slice[7][word & 0xff] ^ t.slice[6][(word >> 8) & 0xff] ^
+              t.slice[5][(word >> 16) & 0xff] ^ t.slice[4][(word >> 24) & 0xff] ^
+              t.slice[3][(word >> 32) & 0xff] ^ t.slice[2][(word >> 40) & 0xff] ^
+              t.slice[1][(word >> 48) & 0xff] ^ t.slice[0][word >> 56];
+        p += 8;
+        len -= 8;
+    }
+    while (len--) {
+        crc = t.slice[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#ifdef TBL_CRC32C_X86
+
+// Multiply the register by x^(8n) using the precomputed constant
+// k = x^(8n - 33): the carry-less product of two reflected 32-bit polynomials
+// is a reflected 64-bit polynomial carrying one extra factor of x, and running
+// it through the crc32 instruction with a zero register multiplies by x^32
+// and reduces modulo P.
+__attribute__((target("sse4.2,pclmul"))) inline uint32_t clmul_shift(
+    uint32_t crc, uint32_t k) {
+    __m128i prod = _mm_clmulepi64_si128(_mm_cvtsi32_si128(crc),
+                                        _mm_cvtsi32_si128(k), 0);
+    return static_cast<uint32_t>(
+        _mm_crc32_u64(0, static_cast<uint64_t>(_mm_cvtsi128_si64(prod))));
+}
+
+// Three interleaved streams of `block` bytes each; `p` and `len` are advanced
+// past the consumed data.
+#define TBL_CRC32C_3WAY(block, merge)                                        \
+    while (len >= 3 * (block)) {                                             \
+        uint64_t c0 = crc, c1 = 0, c2 = 0;                                   \
+        const unsigned char *end = p + (block);                              \
+        do {                                                                 \
+            c0 = _mm_crc32_u64(c0, load_le64(p));                            \
+            c1 = _mm_crc32_u64(c1, load_le64(p + (block)));                  \
+            c2 = _mm_crc32_u64(c2, load_le64(p + 2 * (block)));              \
+            p += 8;                                                          \
+        } while (p < end);                                                   \
+        crc = merge(static_cast<uint32_t>(c0)) ^ static_cast<uint32_t>(c1); \
+        crc = merge(crc) ^ static_cast<uint32_t>(c2);                        \
+        p += 2 * (block);                                                    \
+        len -= 3 * (block);                                                  \
+    }
+
+#define TBL_CRC32C_TAIL                                                    \
+    while (len >= 8) {                                                     \
+        crc = static_cast<uint32_t>(_mm_crc32_u64(crc, load_le64(p)));     \
+        p += 8;                                                            \
+        len -= 8;                                                          \
+    }                                                                      \
+    while (len--) crc = _mm_crc32_u8(crc, *p++);
+
+__attribute__((target("sse4.2"))) uint32_t crc32c_sse42(uint32_t crc,
+                                                         const char *buf,
+                                                         size_t len) {
+    const Crc32cTables &t = tables();
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(buf);
+    while (len && (reinterpret_cast<uintptr_t>(p) & 7)) {
+        crc = _mm_crc32_u8(crc, *p++);
+        --len;
+    }
+#define TBL_MERGE_LONG(c) t.shift_long.shift(c)
+#define TBL_MERGE_SHORT(c) t.shift_short.shift(c)
+    TBL_CRC32C_3WAY(kLongBlock, TBL_MERGE_LONG)
+    TBL_CRC32C_3WAY(kShortBlock, TBL_MERGE_SHORT)
+#undef TBL_MERGE_LONG
+#undef TBL_MERGE_SHORT
+    TBL_CRC32C_TAIL
+    return crc;
+}
+
+__attribute__((target("sse4.2,pclmul"))) uint32_t crc32c_pclmul(
+    uint32_t crc, const char *buf, size_t len) {
+    const Crc32cTables &t = tables();
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(buf);
+    while (len && (reinterpret_cast<uintptr_t>(p) & 7)) {
+        crc = _mm_crc32_u8(crc, *p++);
+        --len;
+    }
+#define TBL_MERGE_HUGE(c) clmul_shift(c, t.clmul_huge)
+#define TBL_MERGE_LONG(c) clmul_shift(c, t.clmul_long)
+#define TBL_MERGE_SHORT(c) clmul_shift(c, t.clmul_short)
+    TBL_CRC32C_3WAY(kHugeBlock, TBL_MERGE_HUGE)
+    TBL_CRC32C_3WAY(kLongBlock, TBL_MERGE_LONG)
+    TBL_CRC32C_3WAY(kShortBlock, TBL_MERGE_SHORT)
+#undef TBL_MERGE_HUGE
+#undef TBL_MERGE_LONG
+#undef TBL_MERGE_SHORT
+    TBL_CRC32C_TAIL
+    return crc;
+}
+
+#undef TBL_CRC32C_3WAY
+#undef TBL_CRC32C_TAIL
+
+#endif  // TBL_CRC32C_X86
+
+struct Crc32cImpl {
+    const char *name;
+    crc32c_fn fn;
+};
+
+uint32_t crc32c_extend_with(uint32_t (*raw)(uint32_t, const char *, size_t),
+                            uint32_t crc, const char *buf, size_t len) {
+    return ~raw(~crc, buf, len);
+}
+
+uint32_t crc32c_portable_fn(uint32_t crc, const char *buf, size_t len) {
+    return crc32c_extend_with(crc32c_slice8, crc, buf, len);
+}
+
+#ifdef TBL_CRC32C_X86
+uint32_t crc32c_sse42_fn(uint32_t crc, const char *buf, size_t len) {
+    return crc32c_extend_with(crc32c_sse42, crc, buf, len);
+}
+
+uint32_t crc32c_pclmul_fn(uint32_t crc, const char *buf, size_t len) {
+    return crc32c_extend_with(crc32c_pclmul, crc, buf, len);
+}
+#endif
+
+// Fastest first.
+const Crc32cImpl kCrc32cImpls[] = {
+#ifdef TBL_CRC32C_X86
+    {"sse4.2+pclmul", crc32c_pclmul_fn},
+    {"sse4.2", crc32c_sse42_fn},
+#endif
+    {"portable", crc32c_portable_fn},
+};
+
+bool crc32c_impl_supported(const Crc32cImpl &impl) {
+#ifdef TBL_CRC32C_X86
+    __builtin_cpu_init();
+    if (impl.fn == crc32c_pclmul_fn) {
+        return __builtin_cpu_supports("sse4.2") &&
+               __builtin_cpu_supports("pclmul");
+    }
+    if (impl.fn == crc32c_sse42_fn) {
+        return __builtin_cpu_supports("sse4.2");
+    }
+#endif
+    (void)impl;
+    return true;
+}
+
+const Crc32cImpl &best_crc32c_impl() {
+    static const Crc32cImpl *best = [] {
+        for (const auto &impl : kCrc32cImpls) {
+            if (crc32c_impl_supported(impl)) return &impl;
+        }
+        return &kCrc32cImpls[0];
+    }();
+    return *best;
+}
+
+}  // namespace
+
+uint32_t crc32c_extend(uint32_t crc, const char *buf, size_t len) {
+    return best_crc32c_impl().fn(crc, buf, len);
+}
+
+const char *crc32c_implementation() { return best_crc32c_impl().name; }
+
+crc32c_fn crc32c_lookup(const char *name) {
+    for (const auto &impl : kCrc32cImpls) {
+        if (strcmp(impl.name, name) == 0) {
+            return crc32c_impl_supported(impl) ? impl.fn : nullptr;
+        }
+    }
+    return nullptr;
 }
 
 #ifdef TEST
@@ -0,0 +1,241 @@
+#include "embedding_writer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "tensorboard_logger.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+namespace {
+
+std::unique_ptr<Sink> open_sink(const string &what, const string &path,
+                                size_t buffer_bytes) {
+    try {
+        return open_file_sink(SinkType::kPosix, path, false, buffer_bytes, 0);
+    } catch (const std::runtime_error &) {
+        throw std::runtime_error("failed to open " + what + " " + path);
+    }
+}
+
+}  // namespace
+
+EmbeddingWriter::EmbeddingWriter(TensorBoardLogger &logger,
+                                 const string &tensor_name, size_t dim,
+                                 const string &tensordata_filename,
+                                 const string &metadata_filename,
+                                 const EmbeddingWriterOptions &options)
+    : logger_(logger),
+      tensor_name_(tensor_name),
+      dim_(dim),
+      tensordata_filename_(tensordata_filename),
+      metadata_filename_(metadata_filename),
+      tensordata_path_(logger.log_dir_ + tensordata_filename),
+      options_(options) {
+    if (dim == 0) throw std::invalid_argument("embedding dim must be > 0");
+    if (options_.buffer_bytes_ == 0) options_.buffer_bytes_ = 1;
+#if defined(_WIN32)
+    options_.mmap_ = false;
+#else
+    if (options_.mmap_) {
+        fd_ = open(tensordata_path_.c_str(),
+                   O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            throw std::runtime_error("failed to open binary tensor file " +
+                                     tensordata_path_);
+        }
+    }
+#endif
+    if (!options_.mmap_) {
+        // with background_, rows are buffered here and written as they are
+        tensor_sink_ =
+            open_sink("binary tensor file", tensordata_path_,
+                      options_.background_ ? 0 : options_.buffer_bytes_);
+    }
+    if (!metadata_filename_.empty()) {
+        metadata_sink_ = open_sink("metadata file",
+                                   logger.log_dir_ + metadata_filename_,
+                                   options_.buffer_bytes_);
+    }
+    if (options_.background_ && !options_.mmap_) {
+        buffer_.reserve(options_.buffer_bytes_);
+        writer_thread_ =
+            std::thread(&EmbeddingWriter::background_writer, this);
+    }
+}
+
+EmbeddingWriter::~EmbeddingWriter() {
+    try {
+        close();
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+    }
+}
+
+void EmbeddingWriter::append_rows(const float *rows, size_t num_rows,
+                                  const string *metadata) {
+    if (closed_) {
+        throw std::runtime_error("embedding writer of " + tensor_name_ +
+                                 " is closed");
+    }
+    if ((metadata != nullptr) != (metadata_sink_ != nullptr)) {
+        throw std::invalid_argument(
+            metadata_sink_ ? "rows of " + tensor_name_ + " need metadata"
+                           : "no metadata file for " + tensor_name_);
+    }
+    write_tensor(reinterpret_cast<const char *>(rows),
+                 num_rows * dim_ * sizeof(float));
+    for (size_t i = 0; metadata != nullptr && i < num_rows; ++i) {
+        const Sink::Buffer line[] = {{metadata[i].data(), metadata[i].size()},
+                                     {"\n", 1}};
+        metadata_sink_->writev(line, 2);
+    }
+    num_rows_ += num_rows;
+}
+
+void EmbeddingWriter::write_tensor(const char *data, size_t size) {
+#if !defined(_WIN32)
+    if (fd_ >= 0) {
+        grow_mapping(used_bytes_ + size);
+        memcpy(mapping_ + used_bytes_, data, size);
+        used_bytes_ += size;
+        return;
+    }
+#endif
+    if (!writer_thread_.joinable()) {
+        tensor_sink_->write(data, size);
+        return;
+    }
+    check_background_error();
+    while (size > 0) {
+        size_t n = options_.buffer_bytes_ - buffer_.size();
+        n = n < size ? n : size;
+        buffer_.append(data, n);
+        data += n;
+        size -= n;
+        if (buffer_.size() == options_.buffer_bytes_) hand_over_buffer();
+    }
+}
+
+// Maps at least `size` bytes of the tensor file, growing the file and the
+// mapping geometrically.
+void EmbeddingWriter::grow_mapping(size_t size) {
+#if !defined(_WIN32)
+    if (size <= mapped_bytes_) return;
+    size_t new_size = mapped_bytes_ * 2;
+    if (new_size < options_.buffer_bytes_) new_size = options_.buffer_bytes_;
+    if (new_size < size) new_size = size;
+    new_size = (new_size + 4095) & ~static_cast<size_t>(4095);
+
+    if (mapping_ != nullptr) munmap(mapping_, mapped_bytes_);
+    mapping_ = nullptr;
+    mapped_bytes_ = 0;
+    void *p = MAP_FAILED;
+    if (ftruncate(fd_, static_cast<off_t>(new_size)) == 0) {
+        p = mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+                 0);
+    }
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("failed to map binary tensor file " +
+                                 tensordata_path_ + ": " + strerror(errno));
+    }
+    mapping_ = static_cast<char *>(p);
+    mapped_bytes_ = new_size;
+#else
+    (void)size;
+#endif
+}
+
+void EmbeddingWriter::hand_over_buffer() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    // one buffer waiting and one being written at most
+    cv_.wait(lock, [this] {
+        return full_buffers_.empty() || background_error_ != nullptr;
+    });
+    if (background_error_) std::rethrow_exception(background_error_);
+    full_buffers_.push_back(std::move(buffer_));
+    if (free_buffers_.empty()) {
+        buffer_ = string();
+        buffer_.reserve(options_.buffer_bytes_);
+    } else {
+        buffer_ = std::move(free_buffers_.back());
+        free_buffers_.pop_back();
+    }
+    cv_.notify_all();
+}
+
+void EmbeddingWriter::background_writer() {
+    std::unique_lock<std::mutex> lock{mtx_};
+    for (;;) {
+        cv_.wait(lock, [this] { return stop_ || !full_buffers_.empty(); });
+        if (full_buffers_.empty()) return;  // stopping, everything written
+        string buffer = std::move(full_buffers_.front());
+        full_buffers_.pop_front();
+        cv_.notify_all();
+        lock.unlock();
+
+        try {
+            tensor_sink_->write(buffer.data(), buffer.size());
+        } catch (...) {
+            lock.lock();
+            background_error_ = std::current_exception();
+            cv_.notify_all();
+            return;
+        }
+
+        buffer.clear();
+        lock.lock();
+        free_buffers_.push_back(std::move(buffer));
+    }
+}
+
+void EmbeddingWriter::check_background_error() {
+    std::lock_guard<std::mutex> lock{mtx_};
+    if (background_error_) std::rethrow_exception(background_error_);
+}
+
+void EmbeddingWriter::close() {
+    if (closed_) return;
+    closed_ = true;
+
+    if (writer_thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{mtx_};
+            if (!buffer_.empty()) full_buffers_.push_back(std::move(buffer_));
+            stop_ = true;
+        }
+        cv_.notify_all();
+        writer_thread_.join();
+        if (background_error_) std::rethrow_exception(background_error_);
+    }
+#if !defined(_WIN32)
+    if (fd_ >= 0) {
+        if (mapping_ != nullptr) munmap(mapping_, mapped_bytes_);
+        mapping_ = nullptr;
+        // cut the file back to the rows actually written
+        bool ok = ftruncate(fd_, static_cast<off_t>(used_bytes_)) == 0;
+        ok = ::close(fd_) == 0 && ok;
+        fd_ = -1;
+        if (!ok) {
+            throw std::runtime_error("failed to write binary tensor file " +
+                                     tensordata_path_);
+        }
+    }
+#endif
+    if (tensor_sink_) tensor_sink_->close();
+    if (metadata_sink_) metadata_sink_->close();
+
+    std::vector<uint32_t> tensor_shape;
+    tensor_shape.push_back(static_cast<uint32_t>(num_rows_));
+    tensor_shape.push_back(static_cast<uint32_t>(dim_));
+    logger_.add_embedding(tensor_name_, tensordata_filename_,
+                          metadata_filename_, tensor_shape);
+}
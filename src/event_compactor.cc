@@ -0,0 +1,599 @@
+#include "event_compactor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+#include "crc.h"
+#include "event_reader.h"
+#include "tensorboard_logger.h"
+#include "thread_pool.h"
+
+using std::string;
+using std::vector;
+
+namespace {
+
+// length, masked crc of the length ... data ... masked crc of the data
+const size_t kHeaderSize = sizeof(uint64_t) + sizeof(uint32_t);
+const size_t kFooterSize = sizeof(uint32_t);
+
+// Records are re-encoded this many at a time, then written in order.
+const size_t kWindow = 1024;
+
+// Runs merged at once, and items read from a spilled run at a time.
+const size_t kMergeFanIn = 64;
+const size_t kReadItems = 1024;
+
+// Point::index of an event without summary values
+const uint32_t kNoValue = UINT32_MAX;
+
+// Point::flags
+const uint8_t kHasMetadata = 1;
+
+// A summary value, or an event without any. 48 bytes, sorted and spilled
+// to the temporary files as they are.
+struct Point {
+    int64_t step;
+    double wall_time;
+    uint64_t offset;  // of the record in its file
+    uint32_t file;
+    uint32_t num_values;  // of the record
+    uint32_t index;       // of the value in the record
+    uint32_t tag;
+    uint8_t flags;
+};
+
+struct TagInfo {
+    bool decimatable = false;
+    // the first value carrying the metadata of the tag, in input order
+    bool has_metadata = false;
+    uint32_t file = 0, index = 0;
+    uint64_t offset = 0;
+};
+
+// The tags of all files, numbered as the indexing threads meet them.
+struct Tags {
+    std::mutex mtx;
+    std::unordered_map<string, uint32_t> ids;
+    vector<TagInfo> info;
+};
+
+// Wall times compared with NaN as the lowest, keeping the sort orders
+// strict weak orderings.
+bool earlier(double a, double b) {
+    return std::isnan(a) ? !std::isnan(b) : a < b;
+}
+
+// by position in the inputs
+bool before(const Point &a, const Point &b) {
+    if (a.file != b.file) return a.file < b.file;
+    if (a.offset != b.offset) return a.offset < b.offset;
+    return a.index < b.index;
+}
+
+// by tag and step, the latest value of each last
+struct ByTag {
+    bool operator()(const Point &a, const Point &b) const {
+        if (a.tag != b.tag) return a.tag < b.tag;
+        if (a.step != b.step) return a.step < b.step;
+        if (earlier(a.wall_time, b.wall_time)) return true;
+        if (earlier(b.wall_time, a.wall_time)) return false;
+        return before(a, b);
+    }
+};
+
+// the order of the output, values grouped by record
+struct ByStep {
+    bool operator()(const Point &a, const Point &b) const {
+        if (a.step != b.step) return a.step < b.step;
+        if (earlier(a.wall_time, b.wall_time)) return true;
+        if (earlier(b.wall_time, a.wall_time)) return false;
+        return before(a, b);
+    }
+};
+
+// An unnamed temporary file in `dir`, or where std::tmpfile() puts them.
+FILE *temp_file(const string &dir) {
+    FILE *file = nullptr;
+    if (dir.empty()) {
+        file = std::tmpfile();
+    } else {
+#if !defined(_WIN32)
+        string path = dir + "/tb_compact.XXXXXX";
+        int fd = mkstemp(&path[0]);
+        if (fd >= 0) {
+            unlink(path.c_str());
+            file = fdopen(fd, "w+b");
+            if (file == nullptr) close(fd);
+        }
+#endif
+    }
+    if (file == nullptr) {
+        throw std::runtime_error("cannot create a temporary file" +
+                                 (dir.empty() ? string() : " in " + dir));
+    }
+    return file;
+}
+
+void seek_file(FILE *file, uint64_t offset) {
+#if defined(_WIN32)
+    int ret = _fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+#else
+    int ret = fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+    if (ret != 0) throw std::runtime_error("cannot seek a temporary file");
+}
+
+// Items sorted in runs, kept in memory up to a budget and spilled to a
+// temporary file beyond it, then merged.
+template <typename T, typename Less>
+class SortedRuns {
+   public:
+    SortedRuns(size_t memory_items, const string &temp_dir)
+        : memory_items_(memory_items), temp_dir_(temp_dir) {}
+    ~SortedRuns() {
+        if (file_ != nullptr) fclose(file_);
+    }
+
+    SortedRuns(const SortedRuns &) = delete;
+    SortedRuns &operator=(const SortedRuns &) = delete;
+
+    // Sorts `items` and adds them as a run, leaving `items` empty. Thread
+    // safe.
+    void add(vector<T> *items) {
+        if (items->empty()) return;
+        std::sort(items->begin(), items->end(), Less());
+        Run run;
+        run.size = items->size();
+        std::lock_guard<std::mutex> lock{mtx_};
+        if (in_memory_ + items->size() <= memory_items_) {
+            in_memory_ += items->size();
+            run.items.swap(*items);
+        } else {
+            run.offset = spill(items->data(), items->size());
+            items->clear();
+        }
+        runs_.push_back(std::move(run));
+    }
+
+    // Calls fn(item) on the items of all runs, in order. The runs are read
+    // anew on every call.
+    template <typename F>
+    void merge(F fn) {
+        while (runs_.size() > kMergeFanIn) {
+            vector<Run> group;
+            for (size_t i = 0; i < kMergeFanIn; ++i) {
+                group.push_back(std::move(runs_[i]));
+            }
+            runs_.erase(runs_.begin(), runs_.begin() + kMergeFanIn);
+            Run merged;
+            merged.offset = file_size_;
+            vector<T> out;
+            out.reserve(kReadItems);
+            merge_runs(group, [&](const T &item) {
+                out.push_back(item);
+                if (out.size() == kReadItems) {
+                    spill(out.data(), out.size());
+                    out.clear();
+                }
+                ++merged.size;
+            });
+            spill(out.data(), out.size());
+            for (const Run &run : group) in_memory_ -= run.items.size();
+            runs_.push_back(std::move(merged));
+        }
+        merge_runs(runs_, fn);
+    }
+
+   private:
+    // in memory, or at `offset` of the file
+    struct Run {
+        vector<T> items;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    struct Cursor {
+        const Run *run;
+        uint64_t read;  // items of the run read so far
+        vector<T> buffer;
+        const T *item, *end;
+    };
+
+    // Appends `n` items to the file, returns where they start.
+    uint64_t spill(const T *items, size_t n) {
+        if (file_ == nullptr) file_ = temp_file(temp_dir_);
+        uint64_t offset = file_size_;
+        if (n == 0) return offset;
+        seek_file(file_, offset);
+        if (fwrite(items, sizeof(T), n, file_) != n) {
+            throw std::runtime_error("cannot write a temporary file");
+        }
+        file_size_ += n * sizeof(T);
+        return offset;
+    }
+
+    // Points the cursor at the next items of its run, false at the end.
+    bool refill(Cursor *cursor) {
+        const Run &run = *cursor->run;
+        if (cursor->read == run.size) return false;
+        if (!run.items.empty()) {
+            cursor->item = run.items.data();
+            cursor->end = cursor->item + run.items.size();
+            cursor->read = run.size;
+            return true;
+        }
+        size_t n = static_cast<size_t>(
+            std::min<uint64_t>(kReadItems, run.size - cursor->read));
+        cursor->buffer.resize(n);
+        seek_file(file_, run.offset + cursor->read * sizeof(T));
+        if (fread(cursor->buffer.data(), sizeof(T), n, file_) != n) {
+            throw std::runtime_error("cannot read a temporary file");
+        }
+        cursor->item = cursor->buffer.data();
+        cursor->end = cursor->item + n;
+        cursor->read += n;
+        return true;
+    }
+
+    template <typename F>
+    void merge_runs(const vector<Run> &runs, F fn) {
+        vector<Cursor> cursors(runs.size());
+        auto greater = [&cursors](size_t a, size_t b) {
+            return Less()(*cursors[b].item, *cursors[a].item);
+        };
+        std::priority_queue<size_t, vector<size_t>, decltype(greater)> heap(
+            greater);
+        for (size_t i = 0; i < runs.size(); ++i) {
+            cursors[i].run = &runs[i];
+            cursors[i].read = 0;
+            if (refill(&cursors[i])) heap.push(i);
+        }
+        while (!heap.empty()) {
+            size_t i = heap.top();
+            heap.pop();
+            Cursor &cursor = cursors[i];
+            fn(*cursor.item);
+            if (++cursor.item != cursor.end || refill(&cursor)) heap.push(i);
+        }
+    }
+
+    const size_t memory_items_;
+    const string temp_dir_;
+    std::mutex mtx_;
+    vector<Run> runs_;
+    size_t in_memory_ = 0;  // items of the runs kept in memory
+    FILE *file_ = nullptr;
+    uint64_t file_size_ = 0;
+};
+
+typedef SortedRuns<Point, ByTag> PointsByTag;
+typedef SortedRuns<Point, ByStep> PointsByStep;
+
+struct IndexStats {
+    uint64_t records = 0;
+    uint64_t values = 0;
+    string error;
+};
+
+bool is_plugin(const TensorBoardEventReader::RawValue &value,
+               const char *name) {
+    return value.plugin_name_size == strlen(name) &&
+           memcmp(value.plugin_name, name, value.plugin_name_size) == 0;
+}
+
+// Reads the records raw, without parsing them: the summary values go to
+// `values`, the events without any to `events`, `buffer_items` at a time.
+void index_file(uint32_t f, TensorBoardEventReader *reader, Tags *tags,
+                size_t buffer_items, PointsByTag *values,
+                PointsByStep *events, IndexStats *stats) {
+    // the tags of the file, and what the file tells of them
+    std::unordered_map<string, uint32_t> local_ids;
+    vector<std::pair<uint32_t, TagInfo>> seen;
+    vector<Point> points, empty;
+    while (reader->next()) {
+        if (reader->has_file_version()) continue;
+        ++stats->records;
+        Point point{reader->step(), reader->wall_time(), reader->offset(),
+                    f,  0, kNoValue, 0, 0};
+        auto raw_values = reader->values();
+        if (raw_values.empty()) {
+            empty.push_back(point);
+            if (empty.size() >= buffer_items) events->add(&empty);
+            continue;
+        }
+        stats->values += raw_values.size();
+        point.num_values = static_cast<uint32_t>(raw_values.size());
+        for (uint32_t i = 0; i < raw_values.size(); ++i) {
+            const auto &value = raw_values[i];
+            string tag(value.tag, value.tag_size);
+            auto local = local_ids.emplace(tag, seen.size());
+            if (local.second) {
+                std::lock_guard<std::mutex> lock{tags->mtx};
+                auto id = static_cast<uint32_t>(tags->info.size());
+                auto inserted = tags->ids.emplace(std::move(tag), id);
+                if (inserted.second) tags->info.emplace_back();
+                seen.emplace_back(inserted.first->second, TagInfo());
+            }
+            auto &tag_info = seen[local.first->second];
+            TagInfo &info = tag_info.second;
+            point.index = i;
+            point.tag = tag_info.first;
+            point.flags = 0;
+            if (value.has_metadata) {
+                point.flags |= kHasMetadata;
+                if (!info.has_metadata) {
+                    info.has_metadata = true;
+                    info.file = f;
+                    info.offset = point.offset;
+                    info.index = i;
+                }
+            }
+            // simple_value (2) or histo (5)
+            if (value.kind == 2 || value.kind == 5 ||
+                is_plugin(value, "scalars") || is_plugin(value, "histograms")) {
+                info.decimatable = true;
+            }
+            points.push_back(point);
+            if (points.size() >= buffer_items) values->add(&points);
+        }
+    }
+    values->add(&points);
+    events->add(&empty);
+    if (!reader->ok()) stats->error = reader->error();
+
+    std::lock_guard<std::mutex> lock{tags->mtx};
+    for (const auto &tag_info : seen) {
+        TagInfo &info = tags->info[tag_info.first];
+        const TagInfo &local = tag_info.second;
+        info.decimatable = info.decimatable || local.decimatable;
+        if (local.has_metadata &&
+            (!info.has_metadata || local.file < info.file ||
+             (local.file == info.file && local.offset < info.offset))) {
+            info.has_metadata = true;
+            info.file = local.file;
+            info.offset = local.offset;
+            info.index = local.index;
+        }
+    }
+}
+
+// length, masked crc of the length, data, masked crc of the data
+string framed_record(const string &data) {
+    uint64_t data_len = data.size();
+    uint32_t len_crc =
+        masked_crc32c((char *)&data_len, sizeof(data_len));  // NOLINT
+    uint32_t data_crc = masked_crc32c(data.data(), data.size());
+    string record;
+    record.reserve(kHeaderSize + data.size() + kFooterSize);
+    record.append((char *)&data_len, sizeof(data_len));  // NOLINT
+    record.append((char *)&len_crc, sizeof(len_crc));    // NOLINT
+    record.append(data);
+    record.append((char *)&data_crc, sizeof(data_crc));  // NOLINT
+    return record;
+}
+
+// An event read in place from the mapped file.
+struct Record {
+    const char *data = nullptr;
+    size_t size = 0;
+};
+
+tensorflow::Event parse_record(const Record &record) {
+    tensorflow::Event event;
+    event.ParseFromArray(record.data, static_cast<int>(record.size));
+    return event;
+}
+
+// A record to write, with the indices of the values it keeps and of those
+// the metadata of their tag moves to.
+struct Output {
+    Record record;
+    uint32_t num_values = 0;
+    vector<uint32_t> kept;
+    vector<std::pair<uint32_t, uint32_t>> gets_metadata;  // index, tag
+    string rewritten;
+};
+
+// The value carrying the metadata of a tag.
+struct MetadataSource {
+    Record record;
+    uint32_t index = 0;
+};
+
+// The kept values of the record, with the metadata moved to them, or an
+// empty string if the record can be copied as it is.
+string rewrite_record(const Output &out,
+                      const vector<MetadataSource> &sources) {
+    if (out.kept.size() == out.num_values && out.gets_metadata.empty()) {
+        return string();
+    }
+    auto event = parse_record(out.record);
+    auto *values = event.mutable_summary()->mutable_value();
+    for (const auto &moved : out.gets_metadata) {
+        const MetadataSource &source = sources[moved.second];
+        auto source_event = parse_record(source.record);
+        *values->Mutable(static_cast<int>(moved.first))->mutable_metadata() =
+            source_event.summary()
+                .value(static_cast<int>(source.index))
+                .metadata();
+    }
+    int kept = 0;
+    for (uint32_t index : out.kept) {
+        values->SwapElements(static_cast<int>(index), kept++);
+    }
+    values->DeleteSubrange(kept, values->size() - kept);
+    return framed_record(event.SerializeAsString());
+}
+
+// The record at `offset`, seen by the reader before.
+Record record_at(TensorBoardEventReader *reader, uint64_t offset) {
+    reader->seek(offset);
+    if (!reader->next()) {
+        throw std::runtime_error("cannot read back an input record: " +
+                                 reader->error());
+    }
+    Record record;
+    record.data = reader->data();
+    record.size = reader->size();
+    return record;
+}
+
+}  // namespace
+
+CompactStats compact_event_files(const vector<string> &inputs,
+                                 TensorBoardLogger &logger,
+                                 const CompactOptions &options) {
+    CompactStats stats;
+    vector<std::unique_ptr<TensorBoardEventReader>> readers(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        readers[i].reset(new TensorBoardEventReader(inputs[i]));
+    }
+    ThreadPool pool(options.num_threads_);
+
+    // A quarter of the budget for the buffers of the indexing threads, one
+    // for the runs kept in memory of each order, one for the selection.
+    size_t quarter = options.memory_bytes_ / 4 / sizeof(Point);
+    size_t buffer_items = std::max<size_t>(quarter / pool.size(), 64);
+    size_t selected_items = std::max<size_t>(quarter, 64);
+    PointsByTag values(quarter, options.temp_dir_);
+    PointsByStep events(quarter, options.temp_dir_);
+    Tags tags;
+    vector<IndexStats> index_stats(readers.size());
+    pool.parallel_for(readers.size(), [&](size_t i) {
+        index_file(static_cast<uint32_t>(i), readers[i].get(), &tags,
+                   buffer_items, &values, &events, &index_stats[i]);
+    });
+    for (const auto &index : index_stats) {
+        if (!index.error.empty()) stats.errors.push_back(index.error);
+        stats.records_read += index.records;
+        stats.values_read += index.values;
+    }
+    std::unordered_map<string, uint32_t>().swap(tags.ids);
+
+    // the steps of the tags, to spread the points kept over them
+    vector<uint64_t> num_steps(tags.info.size(), 0);
+    if (options.max_points_ > 0) {
+        bool have = false;
+        Point prev;
+        values.merge([&](const Point &point) {
+            if (!have || point.tag != prev.tag || point.step != prev.step) {
+                ++num_steps[point.tag];
+            }
+            prev = point;
+            have = true;
+        });
+    }
+
+    // the latest value of each tag and step, the kept ones by step
+    vector<Point> selected;
+    uint32_t tag = 0;
+    uint64_t n = 0, keep = 0, i = 0, k = 0;
+    auto select = [&](const Point &latest) {
+        if (i == 0 || latest.tag != tag) {
+            tag = latest.tag;
+            n = num_steps[tag];
+            keep = n;
+            if (tags.info[tag].decimatable && options.max_points_ > 0 &&
+                keep > options.max_points_) {
+                keep = options.max_points_;
+            }
+            i = k = 0;
+        }
+        // keep == n keeps every step, n is 0 if steps were not counted
+        bool kept = keep == n;
+        if (!kept && k < keep) {
+            // k * (n - 1) / (keep - 1), rounded
+            uint64_t j = keep == 1 ? n - 1
+                                   : (k * (n - 1) + (keep - 1) / 2) /
+                                         (keep - 1);
+            kept = i == j;
+        }
+        ++i;
+        if (kept) {
+            ++k;
+            selected.push_back(latest);
+            if (selected.size() >= selected_items) events.add(&selected);
+        } else {
+            ++stats.decimated;
+        }
+    };
+    bool have = false;
+    Point prev;
+    values.merge([&](const Point &point) {
+        if (have) {
+            if (point.tag != prev.tag || point.step != prev.step) {
+                select(prev);
+            } else {
+                ++stats.duplicates;
+            }
+        }
+        prev = point;
+        have = true;
+    });
+    if (have) select(prev);
+    events.add(&selected);
+    vector<Point>().swap(selected);
+
+    vector<MetadataSource> sources(tags.info.size());
+    vector<bool> has_metadata(tags.info.size(), false);
+    for (auto &reader : readers) reader->verify_crc(false);
+    vector<Output> window;
+    window.reserve(kWindow);
+    auto write_window = [&]() {
+        pool.parallel_for(window.size(), [&](size_t w) {
+            window[w].rewritten = rewrite_record(window[w], sources);
+        });
+        for (const Output &out : window) {
+            if (out.rewritten.empty()) {
+                // framed as it is in the mapped file, checked by the reader
+                logger.write_records(out.record.data - kHeaderSize,
+                                     kHeaderSize + out.record.size +
+                                         kFooterSize);
+            } else {
+                logger.write_records(out.rewritten.data(),
+                                     out.rewritten.size());
+                ++stats.records_rewritten;
+            }
+            ++stats.records_written;
+        }
+        window.clear();
+    };
+    have = false;
+    events.merge([&](const Point &point) {
+        if (!have || point.file != prev.file || point.offset != prev.offset) {
+            if (window.size() == kWindow) write_window();
+            window.emplace_back();
+            Output &out = window.back();
+            out.record = record_at(readers[point.file].get(), point.offset);
+            out.num_values = point.num_values;
+        }
+        prev = point;
+        have = true;
+        if (point.index == kNoValue) return;
+        Output &out = window.back();
+        out.kept.push_back(point.index);
+        // the first value written of a tag needs its metadata
+        if (has_metadata[point.tag]) return;
+        has_metadata[point.tag] = true;
+        const TagInfo &info = tags.info[point.tag];
+        if ((point.flags & kHasMetadata) || !info.has_metadata) return;
+        out.gets_metadata.emplace_back(point.index, point.tag);
+        MetadataSource &source = sources[point.tag];
+        source.record = record_at(readers[info.file].get(), info.offset);
+        source.index = info.index;
+    });
+    write_window();
+    return stats;
+}
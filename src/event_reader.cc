@@ -0,0 +1,404 @@
+#include "event_reader.h"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "crc.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+namespace {
+
+// length, masked crc of the length ... data ... masked crc of the data
+const uint64_t kHeaderSize = sizeof(uint64_t) + sizeof(uint32_t);
+const uint64_t kFooterSize = sizeof(uint32_t);
+
+// Just enough of the protobuf wire format to find the step, the wall time
+// and the summary values of a serialized Event without parsing it. All reads
+// are bounds checked, so garbage in a record makes them fail rather than
+// overrun.
+enum WireType {
+    kVarint = 0,
+    kFixed64 = 1,
+    kLengthDelimited = 2,
+    kFixed32 = 5,
+};
+
+bool read_varint(const char **p, const char *end, uint64_t *value) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64 && *p < end; shift += 7) {
+        auto byte = static_cast<uint8_t>(*(*p)++);
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Reads the key of the field at `*p` and moves past the whole field. For
+// length-delimited and fixed-size fields, [*value, *value_end) is the
+// payload.
+bool next_field(const char **p, const char *end, uint32_t *field_number,
+                uint32_t *wire_type, uint64_t *varint, const char **value,
+                const char **value_end) {
+    uint64_t key, n;
+    if (!read_varint(p, end, &key)) return false;
+    *field_number = static_cast<uint32_t>(key >> 3);
+    *wire_type = static_cast<uint32_t>(key & 7);
+    switch (*wire_type) {
+        case kVarint:
+            return read_varint(p, end, varint);
+        case kFixed64:
+            if (end - *p < 8) return false;
+            *value = *p;
+            *value_end = *p += 8;
+            return true;
+        case kLengthDelimited:
+            if (!read_varint(p, end, &n) ||
+                n > static_cast<uint64_t>(end - *p)) {
+                return false;
+            }
+            *value = *p;
+            *value_end = *p + n;
+            *p += n;
+            return true;
+        case kFixed32:
+            if (end - *p < 4) return false;
+            *value = *p;
+            *value_end = *p += 4;
+            return true;
+        default:  // groups, not used by the event protos
+            return false;
+    }
+}
+
+// The fields of an Event read without parsing it, by field number.
+struct RawEvent {
+    double wall_time = 0;           // 1
+    int64_t step = 0;               // 2
+    bool file_version = false;      // 3, whether it is set
+    const char *summary = nullptr;  // 5, the serialized Summary
+    const char *summary_end = nullptr;
+};
+
+bool peek_event(const char *p, const char *end, RawEvent *event) {
+    *event = RawEvent();
+    uint32_t field_number, wire_type;
+    uint64_t varint;
+    const char *value, *value_end;
+    while (p < end) {
+        if (!next_field(&p, end, &field_number, &wire_type, &varint, &value,
+                        &value_end)) {
+            return false;
+        }
+        if (field_number == 1 && wire_type == kFixed64) {
+            memcpy(&event->wall_time, value, sizeof(event->wall_time));
+        } else if (field_number == 2 && wire_type == kVarint) {
+            event->step = static_cast<int64_t>(varint);
+        } else if (field_number == 3 && wire_type == kLengthDelimited) {
+            event->file_version = true;
+        } else if (field_number == 5 && wire_type == kLengthDelimited) {
+            event->summary = value;
+            event->summary_end = value_end;
+        }
+    }
+    return true;
+}
+
+// SummaryMetadata.plugin_data (1).plugin_name (1) in [p, end), left null if
+// unset.
+void find_plugin_name(const char *p, const char *end, const char **name,
+                      size_t *name_size) {
+    uint32_t field_number, wire_type;
+    uint64_t varint;
+    const char *value, *value_end;
+    while (p < end) {
+        if (!next_field(&p, end, &field_number, &wire_type, &varint, &value,
+                        &value_end)) {
+            return;
+        }
+        if (field_number != 1 || wire_type != kLengthDelimited) continue;
+        const char *q = value;
+        const char *plugin, *plugin_end;
+        while (q < value_end) {
+            if (!next_field(&q, value_end, &field_number, &wire_type, &varint,
+                            &plugin, &plugin_end)) {
+                return;
+            }
+            if (field_number == 1 && wire_type == kLengthDelimited) {
+                *name = plugin;
+                *name_size = static_cast<size_t>(plugin_end - plugin);
+            }
+        }
+    }
+}
+
+// Calls fn(tag, tag_size) with the Value.tag (1) of every Summary.value (1),
+// until it returns true. Returns whether it did.
+template <typename F>
+bool find_tag(const char *p, const char *end, F fn) {
+    uint32_t field_number, wire_type;
+    uint64_t varint;
+    const char *value, *value_end;
+    while (p < end) {
+        if (!next_field(&p, end, &field_number, &wire_type, &varint, &value,
+                        &value_end)) {
+            return false;
+        }
+        if (field_number != 1 || wire_type != kLengthDelimited) continue;
+
+        const char *q = value;
+        const char *tag, *tag_end;
+        while (q < value_end) {
+            if (!next_field(&q, value_end, &field_number, &wire_type, &varint,
+                            &tag, &tag_end)) {
+                return false;
+            }
+            if (field_number != 1 || wire_type != kLengthDelimited) continue;
+            if (fn(tag, static_cast<size_t>(tag_end - tag))) return true;
+        }
+    }
+    return false;
+}
+
+bool has_tag(const char *p, const char *end, const std::vector<string> &tags) {
+    return find_tag(p, end, [&tags](const char *tag, size_t tag_size) {
+        for (const auto &t : tags) {
+            if (t.size() == tag_size && memcmp(t.data(), tag, tag_size) == 0)
+                return true;
+        }
+        return false;
+    });
+}
+
+// Whether a record with valid length and data CRCs starts at `pos`.
+bool valid_record_at(const char *file_data, uint64_t file_size,
+                     uint64_t pos) {
+    if (pos > file_size || file_size - pos < kHeaderSize + kFooterSize) {
+        return false;
+    }
+    const char *record = file_data + pos;
+    uint64_t len;
+    uint32_t len_crc, data_crc;
+    memcpy(&len, record, sizeof(len));
+    memcpy(&len_crc, record + sizeof(len), sizeof(len_crc));
+    if (masked_crc32c(record, sizeof(len)) != len_crc ||
+        len > file_size - pos - kHeaderSize - kFooterSize) {
+        return false;
+    }
+    memcpy(&data_crc, record + kHeaderSize + len, sizeof(data_crc));
+    return masked_crc32c(record + kHeaderSize, len) == data_crc;
+}
+
+}  // namespace
+
+TensorBoardEventReader::TensorBoardEventReader(const string &filename)
+    : filename_(filename) {
+#if defined(_WIN32)
+    std::ifstream fin(filename, std::ios::binary);
+    if (!fin.is_open()) {
+        throw std::runtime_error("failed to open event file " + filename);
+    }
+    std::ostringstream ss;
+    ss << fin.rdbuf();
+    buffer_ = ss.str();
+    file_data_ = buffer_.data();
+    file_size_ = buffer_.size();
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("failed to open event file " + filename);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw std::runtime_error("failed to stat event file " + filename);
+    }
+    file_size_ = static_cast<uint64_t>(st.st_size);
+    if (file_size_ > 0) {
+        void *p = mmap(nullptr, file_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("failed to map event file " + filename);
+        }
+        madvise(p, file_size_, MADV_SEQUENTIAL);
+        file_data_ = static_cast<const char *>(p);
+        mapped_ = true;
+    }
+    close(fd);
+#endif
+}
+
+TensorBoardEventReader::~TensorBoardEventReader() {
+#if !defined(_WIN32)
+    if (mapped_) {
+        munmap(const_cast<char *>(file_data_), file_size_);
+    }
+#endif
+}
+
+bool TensorBoardEventReader::next() {
+    data_ = nullptr;
+    size_ = 0;
+    parsed_ = false;
+    if (!ok()) return false;
+
+    while (pos_ < file_size_) {
+        const char *record = file_data_ + pos_;
+        uint64_t remaining = file_size_ - pos_;
+        const char *what = nullptr;
+
+        uint64_t len = 0;
+        uint32_t len_crc, data_crc;
+        if (remaining < kHeaderSize) {
+            what = "truncated record header";
+        } else {
+            memcpy(&len, record, sizeof(len));
+            memcpy(&len_crc, record + sizeof(len), sizeof(len_crc));
+            if (masked_crc32c(record, sizeof(len)) != len_crc) {
+                what = "corrupted record length";
+            } else if (remaining < kHeaderSize + kFooterSize ||
+                       len > remaining - kHeaderSize - kFooterSize) {
+                what = "truncated record";
+            }
+        }
+        const char *data = record + kHeaderSize;
+        RawEvent event;
+        if (what == nullptr && !peek_event(data, data + len, &event)) {
+            memcpy(&data_crc, data + len, sizeof(data_crc));
+            what = masked_crc32c(data, len) != data_crc
+                       ? "corrupted record data"
+                       : "malformed event";
+        }
+        if (what != nullptr) {
+            std::ostringstream ss;
+            ss << what << " at offset " << pos_ << " of " << filename_;
+            error_ = ss.str();
+            return false;
+        }
+
+        uint64_t offset = pos_;
+        pos_ += kHeaderSize + len + kFooterSize;
+        if (event.step < min_step_ || event.step > max_step_) continue;
+        if (!tags_.empty() &&
+            (event.summary == nullptr ||
+             !has_tag(event.summary, event.summary_end, tags_))) {
+            continue;
+        }
+
+        // data CRCs are only computed for the records we stop at
+        if (verify_crc_) {
+            memcpy(&data_crc, data + len, sizeof(data_crc));
+            if (masked_crc32c(data, len) != data_crc) {
+                pos_ = offset;
+                std::ostringstream ss;
+                ss << "corrupted record data at offset " << offset << " of "
+                   << filename_;
+                error_ = ss.str();
+                return false;
+            }
+        }
+        data_ = data;
+        size_ = len;
+        offset_ = offset;
+        step_ = event.step;
+        wall_time_ = event.wall_time;
+        file_version_ = event.file_version;
+        return true;
+    }
+    return false;
+}
+
+void TensorBoardEventReader::seek(uint64_t offset) {
+    pos_ = offset < file_size_ ? offset : file_size_;
+    data_ = nullptr;
+    size_ = 0;
+    parsed_ = false;
+    error_.clear();
+}
+
+bool TensorBoardEventReader::sync(uint64_t offset) {
+    seek(offset);
+    for (; pos_ < file_size_; ++pos_) {
+        if (valid_record_at(file_data_, file_size_, pos_)) return true;
+    }
+    return false;
+}
+
+std::vector<string> TensorBoardEventReader::tags() const {
+    std::vector<string> tags;
+    RawEvent event;
+    if (data_ != nullptr && peek_event(data_, data_ + size_, &event) &&
+        event.summary != nullptr) {
+        find_tag(event.summary, event.summary_end,
+                 [&tags](const char *tag, size_t size) {
+                     tags.emplace_back(tag, size);
+                     return false;
+                 });
+    }
+    return tags;
+}
+
+std::vector<TensorBoardEventReader::RawValue> TensorBoardEventReader::values()
+    const {
+    std::vector<RawValue> values;
+    RawEvent event;
+    if (data_ == nullptr || !peek_event(data_, data_ + size_, &event)) {
+        return values;
+    }
+    uint32_t field_number, wire_type;
+    uint64_t varint;
+    const char *p = event.summary, *end = event.summary_end;
+    const char *value, *value_end;
+    while (p < end) {
+        if (!next_field(&p, end, &field_number, &wire_type, &varint, &value,
+                        &value_end)) {
+            break;
+        }
+        if (field_number != 1 || wire_type != kLengthDelimited) continue;
+
+        // Summary.Value { tag = 1; metadata = 9; the value in 2 to 8 }
+        RawValue raw;
+        const char *q = value, *field, *field_end;
+        while (q < value_end) {
+            if (!next_field(&q, value_end, &field_number, &wire_type, &varint,
+                            &field, &field_end)) {
+                break;
+            }
+            if (field_number == 1 && wire_type == kLengthDelimited) {
+                raw.tag = field;
+                raw.tag_size = static_cast<size_t>(field_end - field);
+            } else if (field_number == 9 && wire_type == kLengthDelimited) {
+                raw.has_metadata = true;
+                find_plugin_name(field, field_end, &raw.plugin_name,
+                                 &raw.plugin_name_size);
+            } else if (field_number >= 2 && field_number <= 8 &&
+                       field_number != 7) {
+                raw.kind = field_number;
+            }
+        }
+        values.push_back(raw);
+    }
+    return values;
+}
+
+const tensorflow::Event &TensorBoardEventReader::event() {
+    if (!parsed_) {
+        if (!event_.ParseFromArray(data_, static_cast<int>(size_))) {
+            event_.Clear();
+        }
+        parsed_ = true;
+    }
+    return event_;
+}
@@ -0,0 +1,298 @@
+#include "histogram.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TBL_FLOAT16_X86 1
+#include <immintrin.h>
+#endif
+
+using std::numeric_limits;
+using std::vector;
+
+const int DefaultHistogramBuckets::kMantissaBits;
+const size_t Histogram::kChunkSize;
+const size_t Histogram::kBlockSize;
+
+const DefaultHistogramBuckets &DefaultHistogramBuckets::get() {
+    static const DefaultHistogramBuckets buckets;
+    return buckets;
+}
+
+DefaultHistogramBuckets::DefaultHistogramBuckets() {
+    // same construction as summary.py, so that the limits are bit-identical
+    double v = 1e-12;
+    while (v < 1e20) {
+        positive_.push_back(v);
+        v *= 1.1;
+    }
+
+    limits_.push_back(numeric_limits<double>::lowest());
+    for (auto it = positive_.rbegin(); it != positive_.rend(); ++it) {
+        limits_.push_back(-*it);
+    }
+    limits_.insert(limits_.end(), positive_.begin(), positive_.end());
+    limits_.push_back(numeric_limits<double>::max());
+
+    auto biased_exponent = [](double x) {
+        uint64_t bits;
+        memcpy(&bits, &x, sizeof(bits));
+        return static_cast<int>(bits >> 52);
+    };
+    min_exponent_ = biased_exponent(positive_.front());
+    max_exponent_ = biased_exponent(positive_.back());
+    num_positive_ = positive_.size();
+
+    const int sub_ranges = 1 << kMantissaBits;
+    sub_range_start_.resize((max_exponent_ - min_exponent_ + 1) * sub_ranges);
+    for (int e = min_exponent_; e <= max_exponent_; ++e) {
+        for (int t = 0; t < sub_ranges; ++t) {
+            double lo = std::ldexp(1.0 + static_cast<double>(t) / sub_ranges,
+                                   e - 1023);
+            auto j = std::lower_bound(positive_.begin(), positive_.end(), lo) -
+                     positive_.begin();
+            sub_range_start_[(e - min_exponent_) * sub_ranges + t] =
+                static_cast<uint16_t>(j);
+        }
+    }
+    positive_.push_back(numeric_limits<double>::infinity());
+}
+
+void Histogram::merge(const Histogram &other) {
+    for (size_t i = 0; i < counts_.size(); ++i) counts_[i] += other.counts_[i];
+    num_ += other.num_;
+    min_ = other.min_ < min_ ? other.min_ : min_;
+    max_ = other.max_ > max_ ? other.max_ : max_;
+    sum_ += other.sum_;
+    sum_squares_ += other.sum_squares_;
+}
+
+void Histogram::clear() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    num_ = 0;
+    min_ = numeric_limits<double>::max();
+    max_ = numeric_limits<double>::lowest();
+    sum_ = 0.0;
+    sum_squares_ = 0.0;
+}
+
+void Histogram::to_proto(tensorflow::HistogramProto *histo) const {
+    const auto &limits = DefaultHistogramBuckets::get().limits();
+    histo->set_min(min_);
+    histo->set_max(max_);
+    histo->set_num(num_);
+    histo->set_sum(sum_);
+    histo->set_sum_squares(sum_squares_);
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        if (counts_[i] > 0) {
+            histo->add_bucket_limit(limits[i]);
+            histo->add_bucket(counts_[i]);
+        }
+    }
+}
+
+namespace {
+std::atomic<uint64_t> next_accumulator_id{1};
+}  // namespace
+
+HistogramAccumulator::HistogramAccumulator()
+    : id_(next_accumulator_id.fetch_add(1)) {}
+
+HistogramAccumulator::Partial *HistogramAccumulator::local_partial() {
+    // Most threads keep feeding the same accumulator, so remember the last
+    // one each thread used and only search when it changes.
+    struct Cache {
+        uint64_t id = 0;
+        Partial *partial = nullptr;
+    };
+    static thread_local Cache cache;
+    if (cache.id == id_) return cache.partial;
+
+    auto self = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock{mtx_};
+    Partial *partial = nullptr;
+    for (size_t i = 0; i < owners_.size(); ++i) {
+        if (owners_[i] == self) partial = partials_[i].get();
+    }
+    if (partial == nullptr) {
+        partials_.emplace_back(new Partial());
+        owners_.push_back(self);
+        partial = partials_.back().get();
+    }
+    cache.id = id_;
+    cache.partial = partial;
+    return partial;
+}
+
+void HistogramAccumulator::merge(const HistogramAccumulator &other) {
+    if (&other == this) return;
+    Histogram histogram = other.snapshot();
+    Partial *partial = local_partial();
+    std::lock_guard<std::mutex> lock{partial->mtx};
+    partial->histogram.merge(histogram);
+}
+
+Histogram HistogramAccumulator::snapshot() const {
+    Histogram histogram;
+    std::lock_guard<std::mutex> lock{mtx_};
+    for (const auto &partial : partials_) {
+        std::lock_guard<std::mutex> partial_lock{partial->mtx};
+        histogram.merge(partial->histogram);
+    }
+    return histogram;
+}
+
+void HistogramAccumulator::reset() {
+    std::lock_guard<std::mutex> lock{mtx_};
+    for (const auto &partial : partials_) {
+        std::lock_guard<std::mutex> partial_lock{partial->mtx};
+        partial->histogram.clear();
+    }
+}
+
+template <typename T>
+void Histogram::add_byte_counts(const HistogramView<T> &view, size_t begin,
+                                size_t num) {
+    // Four tables, so that runs of equal bytes do not wait on each other's
+    // increments.
+    uint32_t tables[4][256] = {};
+    const bool contiguous = view.stride == 1 && view.mask == nullptr;
+    size_t i = begin, end = begin + num;
+    if (contiguous) {
+        const T *values = view.values;
+        for (; i + 4 <= end; i += 4) {
+            for (int k = 0; k < 4; ++k) {
+                tables[k][static_cast<uint8_t>(values[i + k])]++;
+            }
+        }
+    }
+    for (; i < end; ++i) {
+        bool counts = view.mask == nullptr || view.mask[i] != 0;
+        tables[0][static_cast<uint8_t>(view.values[i * view.stride])] +=
+            counts;
+    }
+
+    const auto &buckets = DefaultHistogramBuckets::get();
+    Moments moments;
+    uint64_t counted = 0;
+    for (int v = std::numeric_limits<T>::min();
+         v <= std::numeric_limits<T>::max(); ++v) {
+        auto byte = static_cast<uint8_t>(v);
+        uint64_t n = static_cast<uint64_t>(tables[0][byte]) +
+                     tables[1][byte] + tables[2][byte] + tables[3][byte];
+        if (n == 0) continue;
+        double x = v;
+        counts_[buckets.index(x)] += n;
+        counted += n;
+        moments.min = x < moments.min ? x : moments.min;
+        moments.max = x > moments.max ? x : moments.max;
+        // exact: integers far below 2^53
+        moments.sum += x * n;
+        moments.sum_squares += x * x * n;
+    }
+    num_ += counted;
+    min_ = moments.min < min_ ? moments.min : min_;
+    max_ = moments.max > max_ ? moments.max : max_;
+    sum_ += moments.sum;
+    sum_squares_ += moments.sum_squares;
+}
+
+void Histogram::add_range(const HistogramView<int8_t> &view, size_t begin,
+                          size_t num) {
+    add_byte_counts(view, begin, num);
+}
+
+void Histogram::add_range(const HistogramView<uint8_t> &view, size_t begin,
+                          size_t num) {
+    add_byte_counts(view, begin, num);
+}
+
+float to_float(Float16 value) {
+    uint32_t sign = static_cast<uint32_t>(value.bits & 0x8000) << 16;
+    uint32_t exponent = (value.bits >> 10) & 0x1f;
+    uint32_t mantissa = value.bits & 0x3ff;
+    uint32_t bits;
+    if (exponent == 0x1f) {
+        // infinities, and NaNs with their payload
+        bits = sign | 0x7f800000u | mantissa << 13;
+    } else if (exponent != 0) {
+        bits = sign | (exponent + 127 - 15) << 23 | mantissa << 13;
+    } else {
+        // zeros and subnormals, mantissa * 2^-24, exact in float
+        float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        memcpy(&bits, &magnitude, sizeof(bits));
+        bits |= sign;
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+namespace {
+
+void float16_portable(const Float16 *values, size_t num, float *out) {
+    for (size_t i = 0; i < num; ++i) out[i] = to_float(values[i]);
+}
+
+#ifdef TBL_FLOAT16_X86
+
+__attribute__((target("avx,f16c"))) void float16_f16c(const Float16 *values,
+                                                      size_t num, float *out) {
+    size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m128i half =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+    }
+    float16_portable(values + i, num - i, out + i);
+}
+
+#endif  // TBL_FLOAT16_X86
+
+struct Float16Impl {
+    const char *name;
+    void (*fn)(const Float16 *, size_t, float *);
+};
+
+const Float16Impl &best_float16_impl() {
+    static const Float16Impl impl = [] {
+#ifdef TBL_FLOAT16_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) {
+            return Float16Impl{"f16c", float16_f16c};
+        }
+#endif
+        return Float16Impl{"portable", float16_portable};
+    }();
+    return impl;
+}
+
+}  // namespace
+
+void to_float(const Float16 *values, size_t num, float *out) {
+    best_float16_impl().fn(values, num, out);
+}
+
+void to_float(const BFloat16 *values, size_t num, float *out) {
+    size_t i = 0;
+#ifdef TBL_FLOAT16_X86
+    // the 16 bits become the high half of each float, SSE2 is part of x86-64
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= num; i += 8) {
+        __m128i x =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                         _mm_unpacklo_epi16(zero, x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i + 4),
+                         _mm_unpackhi_epi16(zero, x));
+    }
+#endif
+    for (; i < num; ++i) out[i] = to_float(values[i]);
+}
+
+const char *float16_implementation() { return best_float16_impl().name; }
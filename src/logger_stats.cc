@@ -0,0 +1,258 @@
+#include "logger_stats.h"
+
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+struct StatsThreads {
+    std::mutex mtx;
+    // cleared when the registry is destroyed, with the counters freed
+    bool alive = true;
+    std::vector<std::unique_ptr<ThreadStats>> live;
+    // the counters of the threads that exited, written under mtx
+    ThreadStats exited;
+    uint64_t num_exited = 0;
+};
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+std::atomic<uint64_t> next_registry_id{1};
+
+// innermost counting scope of the thread, linked to the enclosing ones
+thread_local StatsScope *top_scope = nullptr;
+
+void fold(const ThreadStats &from, ThreadStats *into) {
+    for (size_t k = 0; k < kNumEventKinds; ++k) {
+        into->calls[k].add(from.calls[k].get());
+        into->records[k].add(from.records[k].get());
+        into->bytes[k].add(from.bytes[k].get());
+        into->latency[k].add(from.latency[k]);
+    }
+    into->all_records.add(from.all_records.get());
+    into->all_bytes.add(from.all_bytes.get());
+    into->lock_acquisitions.add(from.lock_acquisitions.get());
+    into->lock_contended.add(from.lock_contended.get());
+    into->lock_wait_ns.add(from.lock_wait_ns.get());
+    into->serialize_ns.add(from.serialize_ns.get());
+    into->crc_ns.add(from.crc_ns.get());
+    into->flush_latency.add(from.flush_latency);
+    into->sync_latency.add(from.sync_latency);
+    into->flusher_wakeups.add(from.flusher_wakeups.get());
+    into->rotations.add(from.rotations.get());
+}
+
+// The ThreadStats of the calling thread for each registry it used: the last
+// one is cached, the rest are looked up by registry id, which is never
+// reused. At thread exit they are folded into the `exited` counters of
+// their registries.
+struct LocalStats {
+    struct Entry {
+        std::shared_ptr<StatsThreads> threads;
+        ThreadStats *stats;
+    };
+    uint64_t last_id = 0;
+    ThreadStats *last = nullptr;
+    std::unordered_map<uint64_t, Entry> by_id;
+
+    ~LocalStats() {
+        for (auto &entry : by_id) {
+            StatsThreads &threads = *entry.second.threads;
+            std::lock_guard<std::mutex> lock{threads.mtx};
+            if (!threads.alive) continue;
+            fold(*entry.second.stats, &threads.exited);
+            ++threads.num_exited;
+            for (auto &live : threads.live) {
+                if (live.get() != entry.second.stats) continue;
+                std::swap(live, threads.live.back());
+                threads.live.pop_back();
+                break;
+            }
+        }
+    }
+
+    // Forgets the registries destroyed since.
+    void drop_dead() {
+        for (auto it = by_id.begin(); it != by_id.end();) {
+            bool alive;
+            {
+                std::lock_guard<std::mutex> lock{it->second.threads->mtx};
+                alive = it->second.threads->alive;
+            }
+            // may free the mutex, unlocked above
+            it = alive ? std::next(it) : by_id.erase(it);
+        }
+    }
+};
+
+LocalStats &local_stats() {
+    static thread_local LocalStats local;
+    return local;
+}
+
+size_t bucket_of(uint64_t ns) {
+    if (ns < 4) return static_cast<size_t>(ns);
+#if defined(__GNUC__) || defined(__clang__)
+    int log2 = 63 - __builtin_clzll(ns);
+#else
+    int log2 = 2;
+    while (ns >> (log2 + 1)) ++log2;
+#endif
+    size_t mantissa = static_cast<size_t>(ns >> (log2 - 2)) & 3;
+    return 4 * static_cast<size_t>(log2 - 1) + mantissa;
+}
+
+double bucket_middle(size_t bucket) {
+    if (bucket < 4) return static_cast<double>(bucket);
+    int log2 = static_cast<int>(bucket / 4) + 1;
+    double width = static_cast<double>(uint64_t(1) << (log2 - 2));
+    return (4 + bucket % 4) * width + width / 2;
+}
+
+}  // namespace
+
+const char *event_kind_name(EventKind kind) {
+    static const char *const kNames[kNumEventKinds] = {
+        "scalar",    "histogram", "image",   "audio", "text",
+        "pr_curve",  "embedding", "hparams", "batch", "records"};
+    return kNames[static_cast<size_t>(kind)];
+}
+
+void LatencyHistogram::record(uint64_t ns) { buckets_[bucket_of(ns)].add(1); }
+
+void LatencyHistogram::merge_into(uint64_t *counts) const {
+    for (size_t i = 0; i < kNumBuckets; ++i) counts[i] += buckets_[i].get();
+}
+
+void LatencyHistogram::add(const LatencyHistogram &other) {
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        buckets_[i].add(other.buckets_[i].get());
+    }
+}
+
+LatencySummary LatencyHistogram::summarize(const uint64_t *counts) {
+    LatencySummary summary;
+    for (size_t i = 0; i < kNumBuckets; ++i) summary.count += counts[i];
+    if (summary.count == 0) return summary;
+    // ranks of the percentiles, 1-based
+    uint64_t p50_rank = (summary.count + 1) / 2;
+    uint64_t p99_rank = summary.count - summary.count / 100;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        if (counts[i] == 0) continue;
+        if (seen < p50_rank && seen + counts[i] >= p50_rank) {
+            summary.p50_ns = bucket_middle(i);
+        }
+        if (seen < p99_rank && seen + counts[i] >= p99_rank) {
+            summary.p99_ns = bucket_middle(i);
+        }
+        seen += counts[i];
+        summary.max_ns = bucket_middle(i);
+    }
+    return summary;
+}
+
+StatsRegistry::StatsRegistry()
+    : id_(next_registry_id.fetch_add(1)), threads_(new StatsThreads()) {}
+
+StatsRegistry::~StatsRegistry() {
+    // the threads still holding counters skip them when they exit
+    std::lock_guard<std::mutex> lock{threads_->mtx};
+    threads_->alive = false;
+    threads_->live.clear();
+}
+
+ThreadStats &StatsRegistry::local() {
+    LocalStats &local = local_stats();
+    if (local.last_id == id_) return *local.last;
+    auto it = local.by_id.find(id_);
+    ThreadStats *stats;
+    if (it != local.by_id.end()) {
+        stats = it->second.stats;
+    } else {
+        // the first use of this registry by the thread, rare enough to
+        // clean up after the dead ones here
+        local.drop_dead();
+        stats = &add_thread();
+        local.by_id[id_] = {threads_, stats};
+    }
+    local.last_id = id_;
+    local.last = stats;
+    return *stats;
+}
+
+ThreadStats &StatsRegistry::add_thread() {
+    std::lock_guard<std::mutex> lock{threads_->mtx};
+    threads_->live.emplace_back(new ThreadStats());
+    return *threads_->live.back();
+}
+
+LoggerStats StatsRegistry::snapshot() const {
+    LoggerStats stats;
+    uint64_t latency[kNumEventKinds][LatencyHistogram::kNumBuckets] = {};
+    uint64_t flush[LatencyHistogram::kNumBuckets] = {};
+    uint64_t sync[LatencyHistogram::kNumBuckets] = {};
+
+    std::lock_guard<std::mutex> lock{threads_->mtx};
+    auto add = [&](const ThreadStats *thread) {
+        for (size_t k = 0; k < kNumEventKinds; ++k) {
+            stats.kinds[k].calls += thread->calls[k].get();
+            stats.kinds[k].records += thread->records[k].get();
+            stats.kinds[k].bytes += thread->bytes[k].get();
+            thread->latency[k].merge_into(latency[k]);
+        }
+        stats.records += thread->all_records.get();
+        stats.bytes += thread->all_bytes.get();
+        stats.lock_acquisitions += thread->lock_acquisitions.get();
+        stats.lock_contended += thread->lock_contended.get();
+        stats.lock_wait_ns += thread->lock_wait_ns.get();
+        stats.serialize_ns += thread->serialize_ns.get();
+        stats.crc_ns += thread->crc_ns.get();
+        thread->flush_latency.merge_into(flush);
+        thread->sync_latency.merge_into(sync);
+        stats.flusher_wakeups += thread->flusher_wakeups.get();
+        stats.rotations += thread->rotations.get();
+    };
+    add(&threads_->exited);
+    for (const auto &thread : threads_->live) add(thread.get());
+    stats.live_threads = threads_->live.size();
+    stats.threads = stats.live_threads + threads_->num_exited;
+    for (size_t k = 0; k < kNumEventKinds; ++k) {
+        stats.kinds[k].latency = LatencyHistogram::summarize(latency[k]);
+    }
+    stats.flush_latency = LatencyHistogram::summarize(flush);
+    stats.sync_latency = LatencyHistogram::summarize(sync);
+    return stats;
+}
+
+StatsScope::StatsScope(StatsRegistry &registry, EventKind kind)
+    : registry_(&registry), kind_(kind), previous_(top_scope) {
+    if (current(registry) != nullptr) return;
+    counting_ = true;
+    stats_ = &registry.local();
+    size_t k = static_cast<size_t>(kind);
+    stats_->calls[k].add(1);
+    sampled_ = stats_->sample_tick[k]++ % kStatsLatencySampling == 0;
+    if (sampled_) start_ = Clock::now();
+    top_scope = this;
+}
+
+StatsScope::~StatsScope() {
+    if (!counting_) return;
+    top_scope = previous_;
+    if (sampled_) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - start_);
+        stats_->latency[static_cast<size_t>(kind_)].record(
+            static_cast<uint64_t>(elapsed.count()));
+    }
+}
+
+StatsScope *StatsScope::current(const StatsRegistry &registry) {
+    for (StatsScope *scope = top_scope; scope != nullptr;
+         scope = scope->previous_) {
+        if (scope->registry_ == &registry) return scope;
+    }
+    return nullptr;
+}
@@ -0,0 +1,1256 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: plugin_data.proto
+
+#include "plugin_data.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace tensorboard {
+namespace hparams {
+PROTOBUF_CONSTEXPR HParamsPluginData::HParamsPluginData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.version_)*/0
+  , /*decltype(_impl_.data_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct HParamsPluginDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HParamsPluginDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HParamsPluginDataDefaultTypeInternal() {}
+  union {
+    HParamsPluginData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HParamsPluginDataDefaultTypeInternal _HParamsPluginData_default_instance_;
+PROTOBUF_CONSTEXPR SessionStartInfo_HparamsEntry_DoNotUse::SessionStartInfo_HparamsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct SessionStartInfo_HparamsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionStartInfo_HparamsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionStartInfo_HparamsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    SessionStartInfo_HparamsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionStartInfo_HparamsEntry_DoNotUseDefaultTypeInternal _SessionStartInfo_HparamsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR SessionStartInfo::SessionStartInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hparams_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.model_uri_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.monitor_url_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.group_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_time_secs_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionStartInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionStartInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionStartInfoDefaultTypeInternal() {}
+  union {
+    SessionStartInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionStartInfoDefaultTypeInternal _SessionStartInfo_default_instance_;
+PROTOBUF_CONSTEXPR SessionEndInfo::SessionEndInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.end_time_secs_)*/0
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionEndInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionEndInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionEndInfoDefaultTypeInternal() {}
+  union {
+    SessionEndInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionEndInfoDefaultTypeInternal _SessionEndInfo_default_instance_;
+}  // namespace hparams
+}  // namespace tensorboard
+static ::_pb::Metadata file_level_metadata_plugin_5fdata_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_plugin_5fdata_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_plugin_5fdata_2eproto = nullptr;
+
+const uint32_t TableStruct_plugin_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamsPluginData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamsPluginData, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamsPluginData, _impl_.version_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::HParamsPluginData, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo, _impl_.hparams_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo, _impl_.model_uri_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo, _impl_.monitor_url_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo, _impl_.group_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionStartInfo, _impl_.start_time_secs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionEndInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionEndInfo, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::hparams::SessionEndInfo, _impl_.end_time_secs_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::tensorboard::hparams::HParamsPluginData)},
+  { 11, 19, -1, sizeof(::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse)},
+  { 21, -1, -1, sizeof(::tensorboard::hparams::SessionStartInfo)},
+  { 32, -1, -1, sizeof(::tensorboard::hparams::SessionEndInfo)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::tensorboard::hparams::_HParamsPluginData_default_instance_._instance,
+  &::tensorboard::hparams::_SessionStartInfo_HparamsEntry_DoNotUse_default_instance_._instance,
+  &::tensorboard::hparams::_SessionStartInfo_default_instance_._instance,
+  &::tensorboard::hparams::_SessionEndInfo_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_plugin_5fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021plugin_data.proto\022\023tensorboard.hparams"
+  "\032\tapi.proto\032\034google/protobuf/struct.prot"
+  "o\"\351\001\n\021HParamsPluginData\022\017\n\007version\030\001 \001(\005"
+  "\0225\n\nexperiment\030\002 \001(\0132\037.tensorboard.hpara"
+  "ms.ExperimentH\000\022C\n\022session_start_info\030\003 "
+  "\001(\0132%.tensorboard.hparams.SessionStartIn"
+  "foH\000\022\?\n\020session_end_info\030\004 \001(\0132#.tensorb"
+  "oard.hparams.SessionEndInfoH\000B\006\n\004data\"\364\001"
+  "\n\020SessionStartInfo\022C\n\007hparams\030\001 \003(\01322.te"
+  "nsorboard.hparams.SessionStartInfo.Hpara"
+  "msEntry\022\021\n\tmodel_uri\030\002 \001(\t\022\023\n\013monitor_ur"
+  "l\030\003 \001(\t\022\022\n\ngroup_name\030\004 \001(\t\022\027\n\017start_tim"
+  "e_secs\030\005 \001(\001\032F\n\014HparamsEntry\022\013\n\003key\030\001 \001("
+  "\t\022%\n\005value\030\002 \001(\0132\026.google.protobuf.Value"
+  ":\0028\001\"T\n\016SessionEndInfo\022+\n\006status\030\001 \001(\0162\033"
+  ".tensorboard.hparams.Status\022\025\n\rend_time_"
+  "secs\030\002 \001(\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_plugin_5fdata_2eproto_deps[2] = {
+  &::descriptor_table_api_2eproto,
+  &::descriptor_table_google_2fprotobuf_2fstruct_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_plugin_5fdata_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_plugin_5fdata_2eproto = {
+    false, false, 658, descriptor_table_protodef_plugin_5fdata_2eproto,
+    "plugin_data.proto",
+    &descriptor_table_plugin_5fdata_2eproto_once, descriptor_table_plugin_5fdata_2eproto_deps, 2, 4,
+    schemas, file_default_instances, TableStruct_plugin_5fdata_2eproto::offsets,
+    file_level_metadata_plugin_5fdata_2eproto, file_level_enum_descriptors_plugin_5fdata_2eproto,
+    file_level_service_descriptors_plugin_5fdata_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_plugin_5fdata_2eproto_getter() {
+  return &descriptor_table_plugin_5fdata_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_plugin_5fdata_2eproto(&descriptor_table_plugin_5fdata_2eproto);
+namespace tensorboard {
+namespace hparams {
+
+// ===================================================================
+
+class HParamsPluginData::_Internal {
+ public:
+  static const ::tensorboard::hparams::Experiment& experiment(const HParamsPluginData* msg);
+  static const ::tensorboard::hparams::SessionStartInfo& session_start_info(const HParamsPluginData* msg);
+  static const ::tensorboard::hparams::SessionEndInfo& session_end_info(const HParamsPluginData* msg);
+};
+
+const ::tensorboard::hparams::Experiment&
+HParamsPluginData::_Internal::experiment(const HParamsPluginData* msg) {
+  return *msg->_impl_.data_.experiment_;
+}
+const ::tensorboard::hparams::SessionStartInfo&
+HParamsPluginData::_Internal::session_start_info(const HParamsPluginData* msg) {
+  return *msg->_impl_.data_.session_start_info_;
+}
+const ::tensorboard::hparams::SessionEndInfo&
+HParamsPluginData::_Internal::session_end_info(const HParamsPluginData* msg) {
+  return *msg->_impl_.data_.session_end_info_;
+}
+void HParamsPluginData::set_allocated_experiment(::tensorboard::hparams::Experiment* experiment) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (experiment) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(experiment));
+    if (message_arena != submessage_arena) {
+      experiment = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, experiment, submessage_arena);
+    }
+    set_has_experiment();
+    _impl_.data_.experiment_ = experiment;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamsPluginData.experiment)
+}
+void HParamsPluginData::clear_experiment() {
+  if (_internal_has_experiment()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.experiment_;
+    }
+    clear_has_data();
+  }
+}
+void HParamsPluginData::set_allocated_session_start_info(::tensorboard::hparams::SessionStartInfo* session_start_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (session_start_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session_start_info);
+    if (message_arena != submessage_arena) {
+      session_start_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, session_start_info, submessage_arena);
+    }
+    set_has_session_start_info();
+    _impl_.data_.session_start_info_ = session_start_info;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamsPluginData.session_start_info)
+}
+void HParamsPluginData::set_allocated_session_end_info(::tensorboard::hparams::SessionEndInfo* session_end_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (session_end_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session_end_info);
+    if (message_arena != submessage_arena) {
+      session_end_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, session_end_info, submessage_arena);
+    }
+    set_has_session_end_info();
+    _impl_.data_.session_end_info_ = session_end_info;
+  }
+  // @@protoc_insertion_point(field_set_allocated:tensorboard.hparams.HParamsPluginData.session_end_info)
+}
+HParamsPluginData::HParamsPluginData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.HParamsPluginData)
+}
+HParamsPluginData::HParamsPluginData(const HParamsPluginData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HParamsPluginData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.version_ = from._impl_.version_;
+  clear_has_data();
+  switch (from.data_case()) {
+    case kExperiment: {
+      _this->_internal_mutable_experiment()->::tensorboard::hparams::Experiment::MergeFrom(
+          from._internal_experiment());
+      break;
+    }
+    case kSessionStartInfo: {
+      _this->_internal_mutable_session_start_info()->::tensorboard::hparams::SessionStartInfo::MergeFrom(
+          from._internal_session_start_info());
+      break;
+    }
+    case kSessionEndInfo: {
+      _this->_internal_mutable_session_end_info()->::tensorboard::hparams::SessionEndInfo::MergeFrom(
+          from._internal_session_end_info());
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.HParamsPluginData)
+}
+
+inline void HParamsPluginData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){0}
+    , decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_data();
+}
+
+HParamsPluginData::~HParamsPluginData() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.HParamsPluginData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HParamsPluginData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_data()) {
+    clear_data();
+  }
+}
+
+void HParamsPluginData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HParamsPluginData::clear_data() {
+// @@protoc_insertion_point(one_of_clear_start:tensorboard.hparams.HParamsPluginData)
+  switch (data_case()) {
+    case kExperiment: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.experiment_;
+      }
+      break;
+    }
+    case kSessionStartInfo: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.session_start_info_;
+      }
+      break;
+    }
+    case kSessionEndInfo: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.session_end_info_;
+      }
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
+}
+
+
+void HParamsPluginData::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.HParamsPluginData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.version_ = 0;
+  clear_data();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HParamsPluginData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.Experiment experiment = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_experiment(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.SessionStartInfo session_start_info = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session_start_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorboard.hparams.SessionEndInfo session_end_info = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session_end_info(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HParamsPluginData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.HParamsPluginData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
+  }
+
+  // .tensorboard.hparams.Experiment experiment = 2;
+  if (_internal_has_experiment()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::experiment(this),
+        _Internal::experiment(this).GetCachedSize(), target, stream);
+  }
+
+  // .tensorboard.hparams.SessionStartInfo session_start_info = 3;
+  if (_internal_has_session_start_info()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::session_start_info(this),
+        _Internal::session_start_info(this).GetCachedSize(), target, stream);
+  }
+
+  // .tensorboard.hparams.SessionEndInfo session_end_info = 4;
+  if (_internal_has_session_end_info()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::session_end_info(this),
+        _Internal::session_end_info(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.HParamsPluginData)
+  return target;
+}
+
+size_t HParamsPluginData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.HParamsPluginData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
+  }
+
+  switch (data_case()) {
+    // .tensorboard.hparams.Experiment experiment = 2;
+    case kExperiment: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.experiment_);
+      break;
+    }
+    // .tensorboard.hparams.SessionStartInfo session_start_info = 3;
+    case kSessionStartInfo: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.session_start_info_);
+      break;
+    }
+    // .tensorboard.hparams.SessionEndInfo session_end_info = 4;
+    case kSessionEndInfo: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.session_end_info_);
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HParamsPluginData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HParamsPluginData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HParamsPluginData::GetClassData() const { return &_class_data_; }
+
+
+void HParamsPluginData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HParamsPluginData*>(&to_msg);
+  auto& from = static_cast<const HParamsPluginData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.HParamsPluginData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  switch (from.data_case()) {
+    case kExperiment: {
+      _this->_internal_mutable_experiment()->::tensorboard::hparams::Experiment::MergeFrom(
+          from._internal_experiment());
+      break;
+    }
+    case kSessionStartInfo: {
+      _this->_internal_mutable_session_start_info()->::tensorboard::hparams::SessionStartInfo::MergeFrom(
+          from._internal_session_start_info());
+      break;
+    }
+    case kSessionEndInfo: {
+      _this->_internal_mutable_session_end_info()->::tensorboard::hparams::SessionEndInfo::MergeFrom(
+          from._internal_session_end_info());
+      break;
+    }
+    case DATA_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HParamsPluginData::CopyFrom(const HParamsPluginData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.HParamsPluginData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HParamsPluginData::IsInitialized() const {
+  return true;
+}
+
+void HParamsPluginData::InternalSwap(HParamsPluginData* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.version_, other->_impl_.version_);
+  swap(_impl_.data_, other->_impl_.data_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HParamsPluginData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_5fdata_2eproto_getter, &descriptor_table_plugin_5fdata_2eproto_once,
+      file_level_metadata_plugin_5fdata_2eproto[0]);
+}
+
+// ===================================================================
+
+SessionStartInfo_HparamsEntry_DoNotUse::SessionStartInfo_HparamsEntry_DoNotUse() {}
+SessionStartInfo_HparamsEntry_DoNotUse::SessionStartInfo_HparamsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SessionStartInfo_HparamsEntry_DoNotUse::MergeFrom(const SessionStartInfo_HparamsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SessionStartInfo_HparamsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_5fdata_2eproto_getter, &descriptor_table_plugin_5fdata_2eproto_once,
+      file_level_metadata_plugin_5fdata_2eproto[1]);
+}
+
+// ===================================================================
+
+class SessionStartInfo::_Internal {
+ public:
+};
+
+void SessionStartInfo::clear_hparams() {
+  _impl_.hparams_.Clear();
+}
+SessionStartInfo::SessionStartInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &SessionStartInfo::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.SessionStartInfo)
+}
+SessionStartInfo::SessionStartInfo(const SessionStartInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionStartInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.hparams_)*/{}
+    , decltype(_impl_.model_uri_){}
+    , decltype(_impl_.monitor_url_){}
+    , decltype(_impl_.group_name_){}
+    , decltype(_impl_.start_time_secs_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.hparams_.MergeFrom(from._impl_.hparams_);
+  _impl_.model_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_model_uri().empty()) {
+    _this->_impl_.model_uri_.Set(from._internal_model_uri(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.monitor_url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_monitor_url().empty()) {
+    _this->_impl_.monitor_url_.Set(from._internal_monitor_url(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.group_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_group_name().empty()) {
+    _this->_impl_.group_name_.Set(from._internal_group_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.start_time_secs_ = from._impl_.start_time_secs_;
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.SessionStartInfo)
+}
+
+inline void SessionStartInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.hparams_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.model_uri_){}
+    , decltype(_impl_.monitor_url_){}
+    , decltype(_impl_.group_name_){}
+    , decltype(_impl_.start_time_secs_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.model_uri_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_uri_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.monitor_url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.monitor_url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.group_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SessionStartInfo::~SessionStartInfo() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.SessionStartInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionStartInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hparams_.Destruct();
+  _impl_.hparams_.~MapField();
+  _impl_.model_uri_.Destroy();
+  _impl_.monitor_url_.Destroy();
+  _impl_.group_name_.Destroy();
+}
+
+void SessionStartInfo::ArenaDtor(void* object) {
+  SessionStartInfo* _this = reinterpret_cast< SessionStartInfo* >(object);
+  _this->_impl_.hparams_.Destruct();
+}
+void SessionStartInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionStartInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.SessionStartInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hparams_.Clear();
+  _impl_.model_uri_.ClearToEmpty();
+  _impl_.monitor_url_.ClearToEmpty();
+  _impl_.group_name_.ClearToEmpty();
+  _impl_.start_time_secs_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionStartInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<string, .google.protobuf.Value> hparams = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.hparams_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string model_uri = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_model_uri();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.SessionStartInfo.model_uri"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string monitor_url = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_monitor_url();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.SessionStartInfo.monitor_url"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string group_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_group_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorboard.hparams.SessionStartInfo.group_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double start_time_secs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.start_time_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionStartInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.SessionStartInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<string, .google.protobuf.Value> hparams = 1;
+  if (!this->_internal_hparams().empty()) {
+    using MapType = ::_pb::Map<std::string, ::PROTOBUF_NAMESPACE_ID::Value>;
+    using WireHelper = SessionStartInfo_HparamsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_hparams();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "tensorboard.hparams.SessionStartInfo.HparamsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // string model_uri = 2;
+  if (!this->_internal_model_uri().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_model_uri().data(), static_cast<int>(this->_internal_model_uri().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.SessionStartInfo.model_uri");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_model_uri(), target);
+  }
+
+  // string monitor_url = 3;
+  if (!this->_internal_monitor_url().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_monitor_url().data(), static_cast<int>(this->_internal_monitor_url().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.SessionStartInfo.monitor_url");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_monitor_url(), target);
+  }
+
+  // string group_name = 4;
+  if (!this->_internal_group_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_group_name().data(), static_cast<int>(this->_internal_group_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorboard.hparams.SessionStartInfo.group_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_group_name(), target);
+  }
+
+  // double start_time_secs = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_start_time_secs = this->_internal_start_time_secs();
+  uint64_t raw_start_time_secs;
+  memcpy(&raw_start_time_secs, &tmp_start_time_secs, sizeof(tmp_start_time_secs));
+  if (raw_start_time_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_start_time_secs(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.SessionStartInfo)
+  return target;
+}
+
+size_t SessionStartInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.SessionStartInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, .google.protobuf.Value> hparams = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_hparams_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::Value >::const_iterator
+      it = this->_internal_hparams().begin();
+      it != this->_internal_hparams().end(); ++it) {
+    total_size += SessionStartInfo_HparamsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string model_uri = 2;
+  if (!this->_internal_model_uri().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_model_uri());
+  }
+
+  // string monitor_url = 3;
+  if (!this->_internal_monitor_url().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_monitor_url());
+  }
+
+  // string group_name = 4;
+  if (!this->_internal_group_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_group_name());
+  }
+
+  // double start_time_secs = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_start_time_secs = this->_internal_start_time_secs();
+  uint64_t raw_start_time_secs;
+  memcpy(&raw_start_time_secs, &tmp_start_time_secs, sizeof(tmp_start_time_secs));
+  if (raw_start_time_secs != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionStartInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionStartInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionStartInfo::GetClassData() const { return &_class_data_; }
+
+
+void SessionStartInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionStartInfo*>(&to_msg);
+  auto& from = static_cast<const SessionStartInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.SessionStartInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hparams_.MergeFrom(from._impl_.hparams_);
+  if (!from._internal_model_uri().empty()) {
+    _this->_internal_set_model_uri(from._internal_model_uri());
+  }
+  if (!from._internal_monitor_url().empty()) {
+    _this->_internal_set_monitor_url(from._internal_monitor_url());
+  }
+  if (!from._internal_group_name().empty()) {
+    _this->_internal_set_group_name(from._internal_group_name());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_start_time_secs = from._internal_start_time_secs();
+  uint64_t raw_start_time_secs;
+  memcpy(&raw_start_time_secs, &tmp_start_time_secs, sizeof(tmp_start_time_secs));
+  if (raw_start_time_secs != 0) {
+    _this->_internal_set_start_time_secs(from._internal_start_time_secs());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionStartInfo::CopyFrom(const SessionStartInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.SessionStartInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionStartInfo::IsInitialized() const {
+  return true;
+}
+
+void SessionStartInfo::InternalSwap(SessionStartInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hparams_.InternalSwap(&other->_impl_.hparams_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.model_uri_, lhs_arena,
+      &other->_impl_.model_uri_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.monitor_url_, lhs_arena,
+      &other->_impl_.monitor_url_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.group_name_, lhs_arena,
+      &other->_impl_.group_name_, rhs_arena
+  );
+  swap(_impl_.start_time_secs_, other->_impl_.start_time_secs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionStartInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_5fdata_2eproto_getter, &descriptor_table_plugin_5fdata_2eproto_once,
+      file_level_metadata_plugin_5fdata_2eproto[2]);
+}
+
+// ===================================================================
+
+class SessionEndInfo::_Internal {
+ public:
+};
+
+SessionEndInfo::SessionEndInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.hparams.SessionEndInfo)
+}
+SessionEndInfo::SessionEndInfo(const SessionEndInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionEndInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.end_time_secs_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.end_time_secs_, &from._impl_.end_time_secs_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.end_time_secs_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.hparams.SessionEndInfo)
+}
+
+inline void SessionEndInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.end_time_secs_){0}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SessionEndInfo::~SessionEndInfo() {
+  // @@protoc_insertion_point(destructor:tensorboard.hparams.SessionEndInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionEndInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SessionEndInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionEndInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.hparams.SessionEndInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.end_time_secs_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.end_time_secs_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionEndInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .tensorboard.hparams.Status status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::tensorboard::hparams::Status>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // double end_time_secs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.end_time_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionEndInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.hparams.SessionEndInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .tensorboard.hparams.Status status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // double end_time_secs = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_end_time_secs = this->_internal_end_time_secs();
+  uint64_t raw_end_time_secs;
+  memcpy(&raw_end_time_secs, &tmp_end_time_secs, sizeof(tmp_end_time_secs));
+  if (raw_end_time_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_end_time_secs(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.hparams.SessionEndInfo)
+  return target;
+}
+
+size_t SessionEndInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.hparams.SessionEndInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double end_time_secs = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_end_time_secs = this->_internal_end_time_secs();
+  uint64_t raw_end_time_secs;
+  memcpy(&raw_end_time_secs, &tmp_end_time_secs, sizeof(tmp_end_time_secs));
+  if (raw_end_time_secs != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .tensorboard.hparams.Status status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionEndInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionEndInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionEndInfo::GetClassData() const { return &_class_data_; }
+
+
+void SessionEndInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionEndInfo*>(&to_msg);
+  auto& from = static_cast<const SessionEndInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.hparams.SessionEndInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_end_time_secs = from._internal_end_time_secs();
+  uint64_t raw_end_time_secs;
+  memcpy(&raw_end_time_secs, &tmp_end_time_secs, sizeof(tmp_end_time_secs));
+  if (raw_end_time_secs != 0) {
+    _this->_internal_set_end_time_secs(from._internal_end_time_secs());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionEndInfo::CopyFrom(const SessionEndInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.hparams.SessionEndInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SessionEndInfo::IsInitialized() const {
+  return true;
+}
+
+void SessionEndInfo::InternalSwap(SessionEndInfo* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionEndInfo, _impl_.status_)
+      + sizeof(SessionEndInfo::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(SessionEndInfo, _impl_.end_time_secs_)>(
+          reinterpret_cast<char*>(&_impl_.end_time_secs_),
+          reinterpret_cast<char*>(&other->_impl_.end_time_secs_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionEndInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_5fdata_2eproto_getter, &descriptor_table_plugin_5fdata_2eproto_once,
+      file_level_metadata_plugin_5fdata_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace hparams
+}  // namespace tensorboard
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::HParamsPluginData*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::HParamsPluginData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::HParamsPluginData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::SessionStartInfo_HparamsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::SessionStartInfo*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::SessionStartInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::SessionStartInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorboard::hparams::SessionEndInfo*
+Arena::CreateMaybeMessage< ::tensorboard::hparams::SessionEndInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::hparams::SessionEndInfo >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
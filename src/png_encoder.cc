@@ -0,0 +1,162 @@
+#include "png_encoder.h"
+
+#include <zlib.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using std::string;
+
+namespace {
+
+void put_u32(string &out, uint32_t v) {
+    char b[4] = {static_cast<char>(v >> 24), static_cast<char>(v >> 16),
+                 static_cast<char>(v >> 8), static_cast<char>(v)};
+    out.append(b, 4);
+}
+
+// Completes the chunk at `start`, an 8 byte placeholder for its length and
+// type followed by its data, and appends its CRC.
+void finish_chunk(string &out, size_t start, const char *type) {
+    uint32_t length = static_cast<uint32_t>(out.size() - start - 8);
+    string header;
+    put_u32(header, length);
+    header.append(type, 4);
+    out.replace(start, 8, header);
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, reinterpret_cast<const Bytef *>(&out[start + 4]),
+                static_cast<uInt>(length + 4));
+    put_u32(out, static_cast<uint32_t>(crc));
+}
+
+uint8_t paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) return static_cast<uint8_t>(a);
+    return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+// Filters `row` into `out` (without the filter type byte), `prev` is the
+// previous row or zeros for the first one and `bpp` the bytes per pixel.
+void filter_row(PngFilter filter, const uint8_t *row, const uint8_t *prev,
+                size_t size, size_t bpp, uint8_t *out) {
+    switch (filter) {
+        case PngFilter::kNone:
+            memcpy(out, row, size);
+            break;
+        case PngFilter::kSub:
+            for (size_t i = 0; i < size; ++i) {
+                out[i] = row[i] - (i >= bpp ? row[i - bpp] : 0);
+            }
+            break;
+        case PngFilter::kUp:
+            for (size_t i = 0; i < size; ++i) out[i] = row[i] - prev[i];
+            break;
+        case PngFilter::kAverage:
+            for (size_t i = 0; i < size; ++i) {
+                int left = i >= bpp ? row[i - bpp] : 0;
+                out[i] = row[i] - static_cast<uint8_t>((left + prev[i]) / 2);
+            }
+            break;
+        case PngFilter::kPaeth:
+            for (size_t i = 0; i < size; ++i) {
+                int left = i >= bpp ? row[i - bpp] : 0;
+                int upper_left = i >= bpp ? prev[i - bpp] : 0;
+                out[i] = row[i] - paeth(left, prev[i], upper_left);
+            }
+            break;
+        case PngFilter::kAdaptive:
+            break;
+    }
+}
+
+// Sum of the filtered bytes taken as signed values.
+size_t sum_abs(const uint8_t *data, size_t size) {
+    size_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+        sum += static_cast<size_t>(std::abs(static_cast<int8_t>(data[i])));
+    }
+    return sum;
+}
+
+}  // namespace
+
+string encode_png(const uint8_t *hwc, int height, int width, int channels,
+                  const PngOptions &options) {
+    static const uint8_t kColorTypes[] = {0, 0, 4, 2, 6};
+    if (height <= 0 || width <= 0 || channels < 1 || channels > 4) {
+        throw std::invalid_argument("png image must be height x width x "
+                                    "channels with 1 to 4 channels");
+    }
+    const size_t bpp = static_cast<size_t>(channels);
+    const size_t row_bytes = static_cast<size_t>(width) * bpp;
+
+    // one filter type byte before every row
+    std::vector<uint8_t> filtered((row_bytes + 1) * height);
+    std::vector<uint8_t> zeros(row_bytes, 0), candidate(row_bytes);
+    for (int y = 0; y < height; ++y) {
+        const uint8_t *row = hwc + y * row_bytes;
+        const uint8_t *prev = y > 0 ? row - row_bytes : zeros.data();
+        uint8_t *out = &filtered[y * (row_bytes + 1)];
+        PngFilter filter = options.filter_;
+        if (filter == PngFilter::kAdaptive) {
+            filter = PngFilter::kNone;
+            size_t best = sum_abs(row, row_bytes);
+            for (PngFilter f : {PngFilter::kSub, PngFilter::kUp,
+                                PngFilter::kAverage, PngFilter::kPaeth}) {
+                filter_row(f, row, prev, row_bytes, bpp, candidate.data());
+                size_t sum = sum_abs(candidate.data(), row_bytes);
+                if (sum < best) {
+                    best = sum;
+                    filter = f;
+                }
+            }
+        }
+        out[0] = static_cast<uint8_t>(filter);
+        filter_row(filter, row, prev, row_bytes, bpp, out + 1);
+    }
+
+    string png("\x89PNG\r\n\x1a\n", 8);
+
+    size_t start = png.size();
+    png.append(8, '\0');
+    put_u32(png, static_cast<uint32_t>(width));
+    put_u32(png, static_cast<uint32_t>(height));
+    const char ihdr[] = {8,  // bit depth
+                         static_cast<char>(kColorTypes[channels]),
+                         0,   // deflate
+                         0,   // adaptive filtering
+                         0};  // no interlace
+    png.append(ihdr, sizeof(ihdr));
+    finish_chunk(png, start, "IHDR");
+
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    // filtered data compresses better with Z_FILTERED, as in libpng
+    int strategy = options.filter_ == PngFilter::kNone ? Z_DEFAULT_STRATEGY
+                                                       : Z_FILTERED;
+    if (deflateInit2(&z, options.compression_level_, Z_DEFLATED, 15, 8,
+                     strategy) != Z_OK) {
+        throw std::runtime_error("png deflateInit failed");
+    }
+    start = png.size();
+    png.append(8, '\0');
+    png.resize(start + 8 + deflateBound(&z, filtered.size()));
+    z.next_in = filtered.data();
+    z.avail_in = static_cast<uInt>(filtered.size());
+    z.next_out = reinterpret_cast<Bytef *>(&png[start + 8]);
+    z.avail_out = static_cast<uInt>(png.size() - start - 8);
+    int ret = deflate(&z, Z_FINISH);
+    size_t compressed = z.total_out;
+    deflateEnd(&z);
+    if (ret != Z_STREAM_END) throw std::runtime_error("png deflate failed");
+    png.resize(start + 8 + compressed);
+    finish_chunk(png, start, "IDAT");
+
+    start = png.size();
+    png.append(8, '\0');
+    finish_chunk(png, start, "IEND");
+    return png;
+}
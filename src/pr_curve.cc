@@ -0,0 +1,154 @@
+#include "pr_curve.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TBL_PR_CURVE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Predictions are turned into count slots a block at a time, then counted.
+const size_t kBlock = 1024;
+
+// 2 * bucket + label, the index into the counts
+inline int32_t slot_of(float prediction, uint8_t label, float max_bucket) {
+    float scaled = prediction * max_bucket;
+    // written so that NaN falls through to 0, as max_ps does below
+    scaled = scaled > 0.0f ? scaled : 0.0f;
+    scaled = scaled < max_bucket ? scaled : max_bucket;
+    return 2 * static_cast<int32_t>(scaled) + (label != 0);
+}
+
+void slots_portable(const float *predictions, const uint8_t *labels,
+                    size_t num, float max_bucket, int32_t *slots) {
+    for (size_t i = 0; i < num; ++i) {
+        slots[i] = slot_of(predictions[i], labels[i], max_bucket);
+    }
+}
+
+#ifdef TBL_PR_CURVE_X86
+
+// SSE2 is part of x86-64, no need to check for it.
+void slots_sse2(const float *predictions, const uint8_t *labels, size_t num,
+                float max_bucket, int32_t *slots) {
+    const __m128 zero = _mm_setzero_ps(), max = _mm_set1_ps(max_bucket);
+    const __m128i zero_i = _mm_setzero_si128(), one = _mm_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        __m128 scaled = _mm_mul_ps(_mm_loadu_ps(predictions + i), max);
+        // max_ps returns its second operand for NaN
+        scaled = _mm_min_ps(_mm_max_ps(scaled, zero), max);
+        __m128i bucket = _mm_cvttps_epi32(scaled);
+        int32_t four_labels;
+        memcpy(&four_labels, labels + i, 4);
+        __m128i label = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(four_labels), zero_i),
+            zero_i);
+        // 1 + (label == 0 ? -1 : 0)
+        label = _mm_add_epi32(one, _mm_cmpeq_epi32(label, zero_i));
+        __m128i slot = _mm_add_epi32(_mm_add_epi32(bucket, bucket), label);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(slots + i), slot);
+    }
+    slots_portable(predictions + i, labels + i, num - i, max_bucket,
+                   slots + i);
+}
+
+__attribute__((target("avx2"))) void slots_avx2(const float *predictions,
+                                                const uint8_t *labels,
+                                                size_t num, float max_bucket,
+                                                int32_t *slots) {
+    const __m256 zero = _mm256_setzero_ps(), max = _mm256_set1_ps(max_bucket);
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256 scaled = _mm256_mul_ps(_mm256_loadu_ps(predictions + i), max);
+        scaled = _mm256_min_ps(_mm256_max_ps(scaled, zero), max);
+        __m256i bucket = _mm256_cvttps_epi32(scaled);
+        __m256i label = _mm256_min_epu32(
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                reinterpret_cast<const __m128i *>(labels + i))),
+            one);
+        __m256i slot =
+            _mm256_add_epi32(_mm256_add_epi32(bucket, bucket), label);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(slots + i), slot);
+    }
+    slots_sse2(predictions + i, labels + i, num - i, max_bucket, slots + i);
+}
+
+#endif  // TBL_PR_CURVE_X86
+
+struct SlotsImpl {
+    const char *name;
+    void (*fn)(const float *, const uint8_t *, size_t, float, int32_t *);
+};
+
+const SlotsImpl &best_slots_impl() {
+    static const SlotsImpl impl = [] {
+#ifdef TBL_PR_CURVE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return SlotsImpl{"avx2", slots_avx2};
+        }
+        return SlotsImpl{"sse2", slots_sse2};
+#else
+        return SlotsImpl{"portable", slots_portable};
+#endif
+    }();
+    return impl;
+}
+
+}  // namespace
+
+void bin_pr_predictions(const float *predictions, const uint8_t *labels,
+                        const float *weights, size_t num,
+                        uint32_t num_thresholds, double *counts) {
+    const auto slots_fn = best_slots_impl().fn;
+    const float max_bucket = static_cast<float>(num_thresholds - 1);
+    int32_t slots[kBlock];
+    for (size_t begin = 0; begin < num; begin += kBlock) {
+        size_t n = num - begin < kBlock ? num - begin : kBlock;
+        slots_fn(predictions + begin, labels + begin, n, max_bucket, slots);
+        if (weights == nullptr) {
+            for (size_t i = 0; i < n; ++i) counts[slots[i]] += 1.0;
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                counts[slots[i]] += weights[begin + i];
+            }
+        }
+    }
+}
+
+void pr_curve_rows(const double *counts, uint32_t num_thresholds,
+                   float *rows) {
+    const size_t n = num_thresholds;
+    float *tp_row = rows, *fp_row = rows + n, *tn_row = rows + 2 * n,
+          *fn_row = rows + 3 * n, *precision_row = rows + 4 * n,
+          *recall_row = rows + 5 * n;
+    double all_tp = 0, all_fp = 0;
+    for (size_t i = 0; i < n; ++i) {
+        all_fp += counts[2 * i];
+        all_tp += counts[2 * i + 1];
+    }
+    // suffix sums, from the highest threshold down
+    double tp = 0, fp = 0;
+    for (size_t i = n; i-- > 0;) {
+        fp += counts[2 * i];
+        tp += counts[2 * i + 1];
+        double tn = all_fp - fp, fn = all_tp - tp;
+        tp_row[i] = static_cast<float>(tp);
+        fp_row[i] = static_cast<float>(fp);
+        tn_row[i] = static_cast<float>(tn);
+        fn_row[i] = static_cast<float>(fn);
+        // as TensorBoard does, to avoid dividing by zero
+        const double kMinDivisor = 1e-7;
+        double predicted = tp + fp, actual = tp + fn;
+        precision_row[i] = static_cast<float>(
+            tp / (predicted > kMinDivisor ? predicted : kMinDivisor));
+        recall_row[i] = static_cast<float>(
+            tp / (actual > kMinDivisor ? actual : kMinDivisor));
+    }
+}
+
+const char *pr_curve_implementation() { return best_slots_impl().name; }
@@ -0,0 +1,304 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: pr_curve_plugin_data.proto
+
+#include "pr_curve_plugin_data.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace tensorboard {
+PROTOBUF_CONSTEXPR PrCurvePluginData::PrCurvePluginData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.version_)*/0
+  , /*decltype(_impl_.num_thresholds_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrCurvePluginDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrCurvePluginDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrCurvePluginDataDefaultTypeInternal() {}
+  union {
+    PrCurvePluginData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrCurvePluginDataDefaultTypeInternal _PrCurvePluginData_default_instance_;
+}  // namespace tensorboard
+static ::_pb::Metadata file_level_metadata_pr_5fcurve_5fplugin_5fdata_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_pr_5fcurve_5fplugin_5fdata_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_pr_5fcurve_5fplugin_5fdata_2eproto = nullptr;
+
+const uint32_t TableStruct_pr_5fcurve_5fplugin_5fdata_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::PrCurvePluginData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorboard::PrCurvePluginData, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::tensorboard::PrCurvePluginData, _impl_.num_thresholds_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::tensorboard::PrCurvePluginData)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::tensorboard::_PrCurvePluginData_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_pr_5fcurve_5fplugin_5fdata_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\032pr_curve_plugin_data.proto\022\013tensorboar"
+  "d\"<\n\021PrCurvePluginData\022\017\n\007version\030\001 \001(\005\022"
+  "\026\n\016num_thresholds\030\002 \001(\rb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto = {
+    false, false, 111, descriptor_table_protodef_pr_5fcurve_5fplugin_5fdata_2eproto,
+    "pr_curve_plugin_data.proto",
+    &descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_pr_5fcurve_5fplugin_5fdata_2eproto::offsets,
+    file_level_metadata_pr_5fcurve_5fplugin_5fdata_2eproto, file_level_enum_descriptors_pr_5fcurve_5fplugin_5fdata_2eproto,
+    file_level_service_descriptors_pr_5fcurve_5fplugin_5fdata_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto_getter() {
+  return &descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_pr_5fcurve_5fplugin_5fdata_2eproto(&descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto);
+namespace tensorboard {
+
+// ===================================================================
+
+class PrCurvePluginData::_Internal {
+ public:
+};
+
+PrCurvePluginData::PrCurvePluginData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorboard.PrCurvePluginData)
+}
+PrCurvePluginData::PrCurvePluginData(const PrCurvePluginData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrCurvePluginData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){}
+    , decltype(_impl_.num_thresholds_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_thresholds_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.num_thresholds_));
+  // @@protoc_insertion_point(copy_constructor:tensorboard.PrCurvePluginData)
+}
+
+inline void PrCurvePluginData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.version_){0}
+    , decltype(_impl_.num_thresholds_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PrCurvePluginData::~PrCurvePluginData() {
+  // @@protoc_insertion_point(destructor:tensorboard.PrCurvePluginData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrCurvePluginData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PrCurvePluginData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrCurvePluginData::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorboard.PrCurvePluginData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.num_thresholds_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.num_thresholds_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrCurvePluginData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 num_thresholds = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.num_thresholds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrCurvePluginData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorboard.PrCurvePluginData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
+  }
+
+  // uint32 num_thresholds = 2;
+  if (this->_internal_num_thresholds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_num_thresholds(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorboard.PrCurvePluginData)
+  return target;
+}
+
+size_t PrCurvePluginData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorboard.PrCurvePluginData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
+  }
+
+  // uint32 num_thresholds = 2;
+  if (this->_internal_num_thresholds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_thresholds());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrCurvePluginData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrCurvePluginData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrCurvePluginData::GetClassData() const { return &_class_data_; }
+
+
+void PrCurvePluginData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrCurvePluginData*>(&to_msg);
+  auto& from = static_cast<const PrCurvePluginData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorboard.PrCurvePluginData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_num_thresholds() != 0) {
+    _this->_internal_set_num_thresholds(from._internal_num_thresholds());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrCurvePluginData::CopyFrom(const PrCurvePluginData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorboard.PrCurvePluginData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrCurvePluginData::IsInitialized() const {
+  return true;
+}
+
+void PrCurvePluginData::InternalSwap(PrCurvePluginData* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrCurvePluginData, _impl_.num_thresholds_)
+      + sizeof(PrCurvePluginData::_impl_.num_thresholds_)
+      - PROTOBUF_FIELD_OFFSET(PrCurvePluginData, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrCurvePluginData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto_getter, &descriptor_table_pr_5fcurve_5fplugin_5fdata_2eproto_once,
+      file_level_metadata_pr_5fcurve_5fplugin_5fdata_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace tensorboard
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tensorboard::PrCurvePluginData*
+Arena::CreateMaybeMessage< ::tensorboard::PrCurvePluginData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorboard::PrCurvePluginData >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
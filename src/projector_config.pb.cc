@@ -0,0 +1,1138 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: projector_config.proto
+
+#include "projector_config.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace tensorflow {
+PROTOBUF_CONSTEXPR SpriteMetadata::SpriteMetadata(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.single_image_dim_)*/{}
+  , /*decltype(_impl_._single_image_dim_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.image_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpriteMetadataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpriteMetadataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpriteMetadataDefaultTypeInternal() {}
+  union {
+    SpriteMetadata _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpriteMetadataDefaultTypeInternal _SpriteMetadata_default_instance_;
+PROTOBUF_CONSTEXPR EmbeddingInfo::EmbeddingInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tensor_shape_)*/{}
+  , /*decltype(_impl_._tensor_shape_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.tensor_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.metadata_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bookmarks_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tensor_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sprite_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EmbeddingInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmbeddingInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmbeddingInfoDefaultTypeInternal() {}
+  union {
+    EmbeddingInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmbeddingInfoDefaultTypeInternal _EmbeddingInfo_default_instance_;
+PROTOBUF_CONSTEXPR ProjectorConfig::ProjectorConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.embeddings_)*/{}
+  , /*decltype(_impl_.model_checkpoint_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.model_checkpoint_dir_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ProjectorConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProjectorConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProjectorConfigDefaultTypeInternal() {}
+  union {
+    ProjectorConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProjectorConfigDefaultTypeInternal _ProjectorConfig_default_instance_;
+}  // namespace tensorflow
+static ::_pb::Metadata file_level_metadata_projector_5fconfig_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_projector_5fconfig_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_projector_5fconfig_2eproto = nullptr;
+
+const uint32_t TableStruct_projector_5fconfig_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorflow::SpriteMetadata, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorflow::SpriteMetadata, _impl_.image_path_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::SpriteMetadata, _impl_.single_image_dim_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _impl_.tensor_name_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _impl_.metadata_path_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _impl_.bookmarks_path_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _impl_.tensor_shape_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _impl_.sprite_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::EmbeddingInfo, _impl_.tensor_path_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tensorflow::ProjectorConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tensorflow::ProjectorConfig, _impl_.model_checkpoint_path_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::ProjectorConfig, _impl_.embeddings_),
+  PROTOBUF_FIELD_OFFSET(::tensorflow::ProjectorConfig, _impl_.model_checkpoint_dir_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::tensorflow::SpriteMetadata)},
+  { 8, -1, -1, sizeof(::tensorflow::EmbeddingInfo)},
+  { 20, -1, -1, sizeof(::tensorflow::ProjectorConfig)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::tensorflow::_SpriteMetadata_default_instance_._instance,
+  &::tensorflow::_EmbeddingInfo_default_instance_._instance,
+  &::tensorflow::_ProjectorConfig_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_projector_5fconfig_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026projector_config.proto\022\ntensorflow\">\n\016"
+  "SpriteMetadata\022\022\n\nimage_path\030\001 \001(\t\022\030\n\020si"
+  "ngle_image_dim\030\002 \003(\r\"\252\001\n\rEmbeddingInfo\022\023"
+  "\n\013tensor_name\030\001 \001(\t\022\025\n\rmetadata_path\030\002 \001"
+  "(\t\022\026\n\016bookmarks_path\030\003 \001(\t\022\024\n\014tensor_sha"
+  "pe\030\004 \003(\r\022*\n\006sprite\030\005 \001(\0132\032.tensorflow.Sp"
+  "riteMetadata\022\023\n\013tensor_path\030\006 \001(\t\"}\n\017Pro"
+  "jectorConfig\022\035\n\025model_checkpoint_path\030\001 "
+  "\001(\t\022-\n\nembeddings\030\002 \003(\0132\031.tensorflow.Emb"
+  "eddingInfo\022\034\n\024model_checkpoint_dir\030\003 \001(\t"
+  "B\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_projector_5fconfig_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_projector_5fconfig_2eproto = {
+    false, false, 413, descriptor_table_protodef_projector_5fconfig_2eproto,
+    "projector_config.proto",
+    &descriptor_table_projector_5fconfig_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_projector_5fconfig_2eproto::offsets,
+    file_level_metadata_projector_5fconfig_2eproto, file_level_enum_descriptors_projector_5fconfig_2eproto,
+    file_level_service_descriptors_projector_5fconfig_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_projector_5fconfig_2eproto_getter() {
+  return &descriptor_table_projector_5fconfig_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_projector_5fconfig_2eproto(&descriptor_table_projector_5fconfig_2eproto);
+namespace tensorflow {
+
+// ===================================================================
+
+class SpriteMetadata::_Internal {
+ public:
+};
+
+SpriteMetadata::SpriteMetadata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorflow.SpriteMetadata)
+}
+SpriteMetadata::SpriteMetadata(const SpriteMetadata& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpriteMetadata* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.single_image_dim_){from._impl_.single_image_dim_}
+    , /*decltype(_impl_._single_image_dim_cached_byte_size_)*/{0}
+    , decltype(_impl_.image_path_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.image_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_image_path().empty()) {
+    _this->_impl_.image_path_.Set(from._internal_image_path(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorflow.SpriteMetadata)
+}
+
+inline void SpriteMetadata::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.single_image_dim_){arena}
+    , /*decltype(_impl_._single_image_dim_cached_byte_size_)*/{0}
+    , decltype(_impl_.image_path_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.image_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SpriteMetadata::~SpriteMetadata() {
+  // @@protoc_insertion_point(destructor:tensorflow.SpriteMetadata)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SpriteMetadata::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.single_image_dim_.~RepeatedField();
+  _impl_.image_path_.Destroy();
+}
+
+void SpriteMetadata::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SpriteMetadata::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorflow.SpriteMetadata)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.single_image_dim_.Clear();
+  _impl_.image_path_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SpriteMetadata::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string image_path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_image_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.SpriteMetadata.image_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 single_image_dim = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_single_image_dim(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_single_image_dim(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SpriteMetadata::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorflow.SpriteMetadata)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string image_path = 1;
+  if (!this->_internal_image_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_image_path().data(), static_cast<int>(this->_internal_image_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.SpriteMetadata.image_path");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_image_path(), target);
+  }
+
+  // repeated uint32 single_image_dim = 2;
+  {
+    int byte_size = _impl_._single_image_dim_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_single_image_dim(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorflow.SpriteMetadata)
+  return target;
+}
+
+size_t SpriteMetadata::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorflow.SpriteMetadata)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 single_image_dim = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.single_image_dim_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._single_image_dim_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string image_path = 1;
+  if (!this->_internal_image_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_image_path());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpriteMetadata::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpriteMetadata::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpriteMetadata::GetClassData() const { return &_class_data_; }
+
+
+void SpriteMetadata::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpriteMetadata*>(&to_msg);
+  auto& from = static_cast<const SpriteMetadata&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorflow.SpriteMetadata)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.single_image_dim_.MergeFrom(from._impl_.single_image_dim_);
+  if (!from._internal_image_path().empty()) {
+    _this->_internal_set_image_path(from._internal_image_path());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SpriteMetadata::CopyFrom(const SpriteMetadata& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorflow.SpriteMetadata)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SpriteMetadata::IsInitialized() const {
+  return true;
+}
+
+void SpriteMetadata::InternalSwap(SpriteMetadata* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.single_image_dim_.InternalSwap(&other->_impl_.single_image_dim_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.image_path_, lhs_arena,
+      &other->_impl_.image_path_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SpriteMetadata::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_projector_5fconfig_2eproto_getter, &descriptor_table_projector_5fconfig_2eproto_once,
+      file_level_metadata_projector_5fconfig_2eproto[0]);
+}
+
+// ===================================================================
+
+class EmbeddingInfo::_Internal {
+ public:
+  static const ::tensorflow::SpriteMetadata& sprite(const EmbeddingInfo* msg);
+};
+
+const ::tensorflow::SpriteMetadata&
+EmbeddingInfo::_Internal::sprite(const EmbeddingInfo* msg) {
+  return *msg->_impl_.sprite_;
+}
+EmbeddingInfo::EmbeddingInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorflow.EmbeddingInfo)
+}
+EmbeddingInfo::EmbeddingInfo(const EmbeddingInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EmbeddingInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tensor_shape_){from._impl_.tensor_shape_}
+    , /*decltype(_impl_._tensor_shape_cached_byte_size_)*/{0}
+    , decltype(_impl_.tensor_name_){}
+    , decltype(_impl_.metadata_path_){}
+    , decltype(_impl_.bookmarks_path_){}
+    , decltype(_impl_.tensor_path_){}
+    , decltype(_impl_.sprite_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.tensor_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tensor_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tensor_name().empty()) {
+    _this->_impl_.tensor_name_.Set(from._internal_tensor_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.metadata_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.metadata_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_metadata_path().empty()) {
+    _this->_impl_.metadata_path_.Set(from._internal_metadata_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.bookmarks_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bookmarks_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_bookmarks_path().empty()) {
+    _this->_impl_.bookmarks_path_.Set(from._internal_bookmarks_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.tensor_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tensor_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tensor_path().empty()) {
+    _this->_impl_.tensor_path_.Set(from._internal_tensor_path(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_sprite()) {
+    _this->_impl_.sprite_ = new ::tensorflow::SpriteMetadata(*from._impl_.sprite_);
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorflow.EmbeddingInfo)
+}
+
+inline void EmbeddingInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tensor_shape_){arena}
+    , /*decltype(_impl_._tensor_shape_cached_byte_size_)*/{0}
+    , decltype(_impl_.tensor_name_){}
+    , decltype(_impl_.metadata_path_){}
+    , decltype(_impl_.bookmarks_path_){}
+    , decltype(_impl_.tensor_path_){}
+    , decltype(_impl_.sprite_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.tensor_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tensor_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.metadata_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.metadata_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.bookmarks_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bookmarks_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tensor_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tensor_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EmbeddingInfo::~EmbeddingInfo() {
+  // @@protoc_insertion_point(destructor:tensorflow.EmbeddingInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EmbeddingInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tensor_shape_.~RepeatedField();
+  _impl_.tensor_name_.Destroy();
+  _impl_.metadata_path_.Destroy();
+  _impl_.bookmarks_path_.Destroy();
+  _impl_.tensor_path_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.sprite_;
+}
+
+void EmbeddingInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EmbeddingInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorflow.EmbeddingInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tensor_shape_.Clear();
+  _impl_.tensor_name_.ClearToEmpty();
+  _impl_.metadata_path_.ClearToEmpty();
+  _impl_.bookmarks_path_.ClearToEmpty();
+  _impl_.tensor_path_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.sprite_ != nullptr) {
+    delete _impl_.sprite_;
+  }
+  _impl_.sprite_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EmbeddingInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string tensor_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_tensor_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.EmbeddingInfo.tensor_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string metadata_path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_metadata_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.EmbeddingInfo.metadata_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string bookmarks_path = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_bookmarks_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.EmbeddingInfo.bookmarks_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 tensor_shape = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_tensor_shape(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_tensor_shape(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .tensorflow.SpriteMetadata sprite = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_sprite(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string tensor_path = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_tensor_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.EmbeddingInfo.tensor_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EmbeddingInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorflow.EmbeddingInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string tensor_name = 1;
+  if (!this->_internal_tensor_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tensor_name().data(), static_cast<int>(this->_internal_tensor_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.EmbeddingInfo.tensor_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_tensor_name(), target);
+  }
+
+  // string metadata_path = 2;
+  if (!this->_internal_metadata_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_metadata_path().data(), static_cast<int>(this->_internal_metadata_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.EmbeddingInfo.metadata_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_metadata_path(), target);
+  }
+
+  // string bookmarks_path = 3;
+  if (!this->_internal_bookmarks_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_bookmarks_path().data(), static_cast<int>(this->_internal_bookmarks_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.EmbeddingInfo.bookmarks_path");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_bookmarks_path(), target);
+  }
+
+  // repeated uint32 tensor_shape = 4;
+  {
+    int byte_size = _impl_._tensor_shape_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_tensor_shape(), byte_size, target);
+    }
+  }
+
+  // .tensorflow.SpriteMetadata sprite = 5;
+  if (this->_internal_has_sprite()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::sprite(this),
+        _Internal::sprite(this).GetCachedSize(), target, stream);
+  }
+
+  // string tensor_path = 6;
+  if (!this->_internal_tensor_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tensor_path().data(), static_cast<int>(this->_internal_tensor_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.EmbeddingInfo.tensor_path");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_tensor_path(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorflow.EmbeddingInfo)
+  return target;
+}
+
+size_t EmbeddingInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorflow.EmbeddingInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 tensor_shape = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.tensor_shape_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._tensor_shape_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string tensor_name = 1;
+  if (!this->_internal_tensor_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tensor_name());
+  }
+
+  // string metadata_path = 2;
+  if (!this->_internal_metadata_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_metadata_path());
+  }
+
+  // string bookmarks_path = 3;
+  if (!this->_internal_bookmarks_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_bookmarks_path());
+  }
+
+  // string tensor_path = 6;
+  if (!this->_internal_tensor_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tensor_path());
+  }
+
+  // .tensorflow.SpriteMetadata sprite = 5;
+  if (this->_internal_has_sprite()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.sprite_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EmbeddingInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EmbeddingInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EmbeddingInfo::GetClassData() const { return &_class_data_; }
+
+
+void EmbeddingInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EmbeddingInfo*>(&to_msg);
+  auto& from = static_cast<const EmbeddingInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorflow.EmbeddingInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tensor_shape_.MergeFrom(from._impl_.tensor_shape_);
+  if (!from._internal_tensor_name().empty()) {
+    _this->_internal_set_tensor_name(from._internal_tensor_name());
+  }
+  if (!from._internal_metadata_path().empty()) {
+    _this->_internal_set_metadata_path(from._internal_metadata_path());
+  }
+  if (!from._internal_bookmarks_path().empty()) {
+    _this->_internal_set_bookmarks_path(from._internal_bookmarks_path());
+  }
+  if (!from._internal_tensor_path().empty()) {
+    _this->_internal_set_tensor_path(from._internal_tensor_path());
+  }
+  if (from._internal_has_sprite()) {
+    _this->_internal_mutable_sprite()->::tensorflow::SpriteMetadata::MergeFrom(
+        from._internal_sprite());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EmbeddingInfo::CopyFrom(const EmbeddingInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorflow.EmbeddingInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EmbeddingInfo::IsInitialized() const {
+  return true;
+}
+
+void EmbeddingInfo::InternalSwap(EmbeddingInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.tensor_shape_.InternalSwap(&other->_impl_.tensor_shape_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tensor_name_, lhs_arena,
+      &other->_impl_.tensor_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.metadata_path_, lhs_arena,
+      &other->_impl_.metadata_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bookmarks_path_, lhs_arena,
+      &other->_impl_.bookmarks_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tensor_path_, lhs_arena,
+      &other->_impl_.tensor_path_, rhs_arena
+  );
+  swap(_impl_.sprite_, other->_impl_.sprite_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EmbeddingInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_projector_5fconfig_2eproto_getter, &descriptor_table_projector_5fconfig_2eproto_once,
+      file_level_metadata_projector_5fconfig_2eproto[1]);
+}
+
+// ===================================================================
+
+class ProjectorConfig::_Internal {
+ public:
+};
+
+ProjectorConfig::ProjectorConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:tensorflow.ProjectorConfig)
+}
+ProjectorConfig::ProjectorConfig(const ProjectorConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProjectorConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.embeddings_){from._impl_.embeddings_}
+    , decltype(_impl_.model_checkpoint_path_){}
+    , decltype(_impl_.model_checkpoint_dir_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.model_checkpoint_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_checkpoint_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_model_checkpoint_path().empty()) {
+    _this->_impl_.model_checkpoint_path_.Set(from._internal_model_checkpoint_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.model_checkpoint_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_checkpoint_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_model_checkpoint_dir().empty()) {
+    _this->_impl_.model_checkpoint_dir_.Set(from._internal_model_checkpoint_dir(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tensorflow.ProjectorConfig)
+}
+
+inline void ProjectorConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.embeddings_){arena}
+    , decltype(_impl_.model_checkpoint_path_){}
+    , decltype(_impl_.model_checkpoint_dir_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.model_checkpoint_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_checkpoint_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.model_checkpoint_dir_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_checkpoint_dir_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProjectorConfig::~ProjectorConfig() {
+  // @@protoc_insertion_point(destructor:tensorflow.ProjectorConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProjectorConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.embeddings_.~RepeatedPtrField();
+  _impl_.model_checkpoint_path_.Destroy();
+  _impl_.model_checkpoint_dir_.Destroy();
+}
+
+void ProjectorConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProjectorConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:tensorflow.ProjectorConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.embeddings_.Clear();
+  _impl_.model_checkpoint_path_.ClearToEmpty();
+  _impl_.model_checkpoint_dir_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProjectorConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string model_checkpoint_path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_model_checkpoint_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.ProjectorConfig.model_checkpoint_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .tensorflow.EmbeddingInfo embeddings = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_embeddings(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string model_checkpoint_dir = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_model_checkpoint_dir();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "tensorflow.ProjectorConfig.model_checkpoint_dir"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProjectorConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tensorflow.ProjectorConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string model_checkpoint_path = 1;
+  if (!this->_internal_model_checkpoint_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_model_checkpoint_path().data(), static_cast<int>(this->_internal_model_checkpoint_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.ProjectorConfig.model_checkpoint_path");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_model_checkpoint_path(), target);
+  }
+
+  // repeated .tensorflow.EmbeddingInfo embeddings = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_embeddings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_embeddings(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string model_checkpoint_dir = 3;
+  if (!this->_internal_model_checkpoint_dir().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_model_checkpoint_dir().data(), static_cast<int>(this->_internal_model_checkpoint_dir().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "tensorflow.ProjectorConfig.model_checkpoint_dir");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_model_checkpoint_dir(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tensorflow.ProjectorConfig)
+  return target;
+}
+
+size_t ProjectorConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tensorflow.ProjectorConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tensorflow.EmbeddingInfo embeddings = 2;
+  total_size += 1UL * this->_internal_embeddings_size();
+  for (const auto& msg : this->_impl_.embeddings_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string model_checkpoint_path = 1;
+  if (!this->_internal_model_checkpoint_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_model_checkpoint_path());
+  }
+
+  // string model_checkpoint_dir = 3;
+  if (!this->_internal_model_checkpoint_dir().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_model_checkpoint_dir());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProjectorConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProjectorConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProjectorConfig::GetClassData() const { return &_class_data_; }
+
+
+void ProjectorConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProjectorConfig*>(&to_msg);
+  auto& from = static_cast<const ProjectorConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:tensorflow.ProjectorConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.embeddings_.MergeFrom(from._impl_.embeddings_);
+  if (!from._internal_model_checkpoint_path().empty()) {
+    _this->_internal_set_model_checkpoint_path(from._internal_model_checkpoint_path());
+  }
+  if (!from._internal_model_checkpoint_dir().empty()) {
+    _this->_internal_set_model_checkpoint_dir(from._internal_model_checkpoint_dir());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProjectorConfig::CopyFrom(const ProjectorConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tensorflow.ProjectorConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProjectorConfig::IsInitialized() const {
+  return true;
+}
+
+void ProjectorConfig::InternalSwap(ProjectorConfig* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.embeddings_.InternalSwap(&other->_impl_.embeddings_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.model_checkpoint_path_, lhs_arena,
+      &other->_impl_.model_checkpoint_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.model_checkpoint_dir_, lhs_arena,
+      &other->_impl_.model_checkpoint_dir_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProjectorConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_projector_5fconfig_2eproto_getter, &descriptor_table_projector_5fconfig_2eproto_once,
+      file_level_metadata_projector_5fconfig_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace tensorflow
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tensorflow::SpriteMetadata*
+Arena::CreateMaybeMessage< ::tensorflow::SpriteMetadata >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorflow::SpriteMetadata >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorflow::EmbeddingInfo*
+Arena::CreateMaybeMessage< ::tensorflow::EmbeddingInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorflow::EmbeddingInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tensorflow::ProjectorConfig*
+Arena::CreateMaybeMessage< ::tensorflow::ProjectorConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tensorflow::ProjectorConfig >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
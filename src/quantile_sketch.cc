@@ -0,0 +1,303 @@
+#include "quantile_sketch.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+const double kMinIndexable = std::numeric_limits<double>::min();
+const uint8_t kFormatVersion = 1;
+
+void append_varint(std::string *s, uint64_t value) {
+    while (value >= 0x80) {
+        s->push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    s->push_back(static_cast<char>(value));
+}
+
+void append_double(std::string *s, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i) s->push_back(static_cast<char>(bits >> 8 * i));
+}
+
+// Reads what append_varint() and append_double() wrote, throwing on
+// truncated or malformed data.
+class Reader {
+   public:
+    explicit Reader(const std::string &data) : data_(data) {}
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = next();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        fail();
+        return 0;
+    }
+
+    double float64() {
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i) {
+            bits |= static_cast<uint64_t>(next()) << 8 * i;
+        }
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    uint8_t next() {
+        if (pos_ >= data_.size()) fail();
+        return static_cast<uint8_t>(data_[pos_++]);
+    }
+    bool done() const { return pos_ == data_.size(); }
+
+    [[noreturn]] static void fail() {
+        throw std::invalid_argument("malformed quantile sketch");
+    }
+
+   private:
+    const std::string &data_;
+    size_t pos_ = 0;
+};
+
+}  // namespace
+
+QuantileSketch::QuantileSketch(double relative_accuracy, size_t max_buckets)
+    : relative_accuracy_(relative_accuracy), max_buckets_(max_buckets) {
+    // below 1e-6, the keys of the largest doubles would overflow
+    if (!(relative_accuracy >= 1e-6 && relative_accuracy < 1)) {
+        throw std::invalid_argument(
+            "quantile sketch relative accuracy must be in [1e-6, 1)");
+    }
+    if (max_buckets < 1) {
+        throw std::invalid_argument("quantile sketch needs a bucket");
+    }
+    // log2 grows up to this many times faster than its cubic approximation
+    // (at powers of two), buckets are made narrower accordingly to keep
+    // their ratio.
+    const double kCorrectingFactor = 7.0 / (10.0 * std::log(2.0));
+    double gamma = (1 + relative_accuracy) / (1 - relative_accuracy);
+    multiplier_ = kCorrectingFactor * std::log(2.0) / std::log(gamma);
+}
+
+// Solves the cubic of key() for the mantissa, with Cardano's formula.
+double QuantileSketch::lower_bound(int32_t key) const {
+    const double kA = 6.0 / 35.0, kB = -3.0 / 5.0, kC = 10.0 / 7.0;
+    double log2 = key / multiplier_;
+    double exponent = std::floor(log2);
+    double d0 = kB * kB - 3 * kA * kC;
+    double d1 = 2 * kB * kB * kB - 9 * kA * kB * kC -
+                27 * kA * kA * (log2 - exponent);
+    double p = std::cbrt((d1 - std::sqrt(d1 * d1 - 4 * d0 * d0 * d0)) / 2);
+    double s = -(kB + p + d0 / p) / (3 * kA);
+    return std::ldexp(1 + s, static_cast<int>(exponent));
+}
+
+double QuantileSketch::bucket_value(int32_t key) const {
+    // harmonic mean of the bounds, still finite if the upper one is not
+    return 2.0 / (1.0 / lower_bound(key) + 1.0 / lower_bound(key + 1));
+}
+
+void QuantileSketch::Store::grow_and_add(int32_t key, uint64_t n,
+                                        size_t max_buckets) {
+    if (counts.empty()) {
+        offset = key;
+        counts.push_back(0);
+    }
+    if (key < offset) {
+        // below the kept range, the key goes to the lowest bucket kept
+        int64_t lowest = static_cast<int64_t>(offset) + counts.size() -
+                         static_cast<int64_t>(max_buckets);
+        if (key < lowest) key = static_cast<int32_t>(lowest);
+        if (key < offset) {
+            counts.insert(counts.begin(), offset - key, 0);
+            offset = key;
+        }
+    } else if (static_cast<size_t>(key - offset) >= counts.size()) {
+        // keep the top max_buckets keys, folding the ones below them into
+        // the lowest kept before growing
+        int64_t lowest = static_cast<int64_t>(key) -
+                         static_cast<int64_t>(max_buckets) + 1;
+        uint64_t folded = 0;
+        if (lowest > offset) {
+            size_t drop = lowest - offset < static_cast<int64_t>(counts.size())
+                              ? static_cast<size_t>(lowest - offset)
+                              : counts.size();
+            for (size_t i = 0; i < drop; ++i) folded += counts[i];
+            counts.erase(counts.begin(), counts.begin() + drop);
+            offset = static_cast<int32_t>(lowest);
+        }
+        counts.resize(static_cast<size_t>(key - offset) + 1, 0);
+        counts[0] += folded;
+    }
+    counts[key - offset] += n;
+}
+
+void QuantileSketch::merge(const QuantileSketch &other) {
+    if (other.relative_accuracy_ != relative_accuracy_) {
+        throw std::invalid_argument(
+            "cannot merge quantile sketches of different accuracies");
+    }
+    if (&other == this) {
+        QuantileSketch copy(other);
+        merge(copy);
+        return;
+    }
+    struct Stores {
+        Store &to;
+        const Store &from;
+    };
+    for (const auto &stores : {Stores{positive_, other.positive_},
+                               Stores{negative_, other.negative_}}) {
+        const auto &counts = stores.from.counts;
+        // from the highest key down, so that folding happens at most once
+        for (size_t i = counts.size(); i-- > 0;) {
+            if (counts[i] == 0) continue;
+            stores.to.add(stores.from.offset + static_cast<int32_t>(i),
+                          counts[i], max_buckets_);
+        }
+    }
+    zero_count_ += other.zero_count_;
+    count_ += other.count_;
+    min_ = other.min_ < min_ ? other.min_ : min_;
+    max_ = other.max_ > max_ ? other.max_ : max_;
+    sum_ += other.sum_;
+    sum_squares_ += other.sum_squares_;
+}
+
+double QuantileSketch::quantile(double q) const {
+    if (count_ == 0) return std::numeric_limits<double>::quiet_NaN();
+    q = q < 0 ? 0 : (q > 1 ? 1 : q);
+    auto rank = static_cast<uint64_t>(q * (count_ - 1));
+    auto clamp = [this](double value) {
+        return value < min_ ? min_ : (value > max_ ? max_ : value);
+    };
+    uint64_t seen = 0;
+    // in increasing order of value: negatives by decreasing magnitude,
+    // zeros, positives
+    const auto &negative = negative_.counts;
+    for (size_t i = negative.size(); i-- > 0;) {
+        seen += negative[i];
+        if (seen > rank) {
+            return clamp(
+                -bucket_value(negative_.offset + static_cast<int32_t>(i)));
+        }
+    }
+    seen += zero_count_;
+    if (seen > rank) return clamp(0.0);
+    const auto &positive = positive_.counts;
+    for (size_t i = 0; i < positive.size(); ++i) {
+        seen += positive[i];
+        if (seen > rank) {
+            return clamp(
+                bucket_value(positive_.offset + static_cast<int32_t>(i)));
+        }
+    }
+    return max_;
+}
+
+void QuantileSketch::to_proto(tensorflow::HistogramProto *histo) const {
+    histo->set_min(min_);
+    histo->set_max(max_);
+    histo->set_num(count_);
+    histo->set_sum(sum_);
+    histo->set_sum_squares(sum_squares_);
+    // limits are the upper bounds of the buckets
+    const auto &negative = negative_.counts;
+    for (size_t i = negative.size(); i-- > 0;) {
+        if (negative[i] == 0) continue;
+        histo->add_bucket_limit(
+            -lower_bound(negative_.offset + static_cast<int32_t>(i)));
+        histo->add_bucket(negative[i]);
+    }
+    if (zero_count_ > 0) {
+        histo->add_bucket_limit(kMinIndexable);
+        histo->add_bucket(zero_count_);
+    }
+    const auto &positive = positive_.counts;
+    for (size_t i = 0; i < positive.size(); ++i) {
+        if (positive[i] == 0) continue;
+        histo->add_bucket_limit(
+            lower_bound(positive_.offset + static_cast<int32_t>(i) + 1));
+        histo->add_bucket(positive[i]);
+    }
+}
+
+// version, relative accuracy, max buckets, count, zero count, min, max, sum,
+// sum of squares, then for the positive and negative stores: offset
+// (zigzag), number of counts, counts. Integers are varints, doubles
+// little-endian.
+std::string QuantileSketch::serialize() const {
+    std::string data;
+    data.push_back(static_cast<char>(kFormatVersion));
+    append_double(&data, relative_accuracy_);
+    append_varint(&data, max_buckets_);
+    append_varint(&data, count_);
+    append_varint(&data, zero_count_);
+    append_double(&data, min_);
+    append_double(&data, max_);
+    append_double(&data, sum_);
+    append_double(&data, sum_squares_);
+    for (const Store *store : {&positive_, &negative_}) {
+        auto offset = static_cast<uint32_t>(store->offset);
+        append_varint(&data, (offset << 1) ^ (store->offset < 0 ? ~0u : 0u));
+        append_varint(&data, store->counts.size());
+        for (uint64_t n : store->counts) append_varint(&data, n);
+    }
+    return data;
+}
+
+QuantileSketch QuantileSketch::deserialize(const std::string &data) {
+    Reader reader(data);
+    if (reader.next() != kFormatVersion) Reader::fail();
+    double relative_accuracy = reader.float64();
+    uint64_t max_buckets = reader.varint();
+    if (!(relative_accuracy >= 1e-6 && relative_accuracy < 1) ||
+        max_buckets < 1 || max_buckets > (1u << 31)) {
+        Reader::fail();
+    }
+    QuantileSketch sketch(relative_accuracy, max_buckets);
+    sketch.count_ = reader.varint();
+    sketch.zero_count_ = reader.varint();
+    sketch.min_ = reader.float64();
+    sketch.max_ = reader.float64();
+    sketch.sum_ = reader.float64();
+    sketch.sum_squares_ = reader.float64();
+    uint64_t total = sketch.zero_count_;
+    for (Store *store : {&sketch.positive_, &sketch.negative_}) {
+        uint64_t zigzag = reader.varint();
+        if (zigzag > 0xffffffffu) Reader::fail();
+        auto offset = static_cast<uint32_t>(zigzag);
+        store->offset =
+            static_cast<int32_t>((offset >> 1) ^ (0u - (offset & 1)));
+        uint64_t size = reader.varint();
+        // every count takes at least a byte
+        if (size > max_buckets || size > data.size()) Reader::fail();
+        if (size > 0 && store->offset > std::numeric_limits<int32_t>::max() -
+                                            static_cast<int64_t>(size)) {
+            Reader::fail();
+        }
+        store->counts.resize(size);
+        for (auto &n : store->counts) {
+            n = reader.varint();
+            total += n;
+        }
+    }
+    if (!reader.done() || total != sketch.count_) Reader::fail();
+    return sketch;
+}
+
+void QuantileSketch::clear() {
+    positive_ = Store();
+    negative_ = Store();
+    zero_count_ = 0;
+    count_ = 0;
+    min_ = std::numeric_limits<double>::max();
+    max_ = std::numeric_limits<double>::lowest();
+    sum_ = 0.0;
+    sum_squares_ = 0.0;
+}
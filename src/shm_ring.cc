@@ -0,0 +1,224 @@
+#include "shm_ring.h"
+
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+namespace {
+
+const uint64_t kShmRingMagic = 0x31474e4952424c54;  // "TLBRING1"
+
+#if !defined(_WIN32)
+string error_message(const string &what, const string &name) {
+    return what + " " + name + ": " + strerror(errno);
+}
+#endif
+
+}  // namespace
+
+const size_t ShmRing::kHeaderSize;
+
+ShmRing::ShmRing(const string &name, void *mapping, size_t mapping_size)
+    : name_(name),
+      mapping_(mapping),
+      mapping_size_(mapping_size),
+      control_(static_cast<Control *>(mapping)),
+      records_(static_cast<char *>(mapping) + sizeof(Control)),
+      capacity_(static_cast<size_t>(control_->capacity)) {}
+
+#if defined(_WIN32)
+
+std::shared_ptr<ShmRing> ShmRing::create(const string &name, size_t) {
+    throw std::runtime_error("shared memory rings are not supported, " + name);
+}
+
+std::shared_ptr<ShmRing> ShmRing::open(const string &name) {
+    throw std::runtime_error("shared memory rings are not supported, " + name);
+}
+
+ShmRing::~ShmRing() {}
+
+void ShmRing::unlink() {}
+
+#else
+
+std::shared_ptr<ShmRing> ShmRing::create(const string &name,
+                                         size_t capacity) {
+    size_t rounded = 4096;
+    while (rounded < capacity) rounded *= 2;
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        throw std::runtime_error(
+            error_message("failed to create shared memory", name));
+    }
+    size_t mapping_size = sizeof(Control) + rounded;
+    void *mapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(mapping_size)) == 0) {
+        mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+    }
+    if (mapping == MAP_FAILED) {
+        auto message = error_message("failed to map shared memory", name);
+        ::close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error(message);
+    }
+    ::close(fd);
+
+    // a fresh shm object is zeroed, i.e. every slot is unpublished
+    auto *control = new (mapping) Control();
+    control->capacity = rounded;
+    // the magic comes last, open() checks it
+    __atomic_store_n(&control->magic, kShmRingMagic, __ATOMIC_RELEASE);
+    return std::shared_ptr<ShmRing>(new ShmRing(name, mapping, mapping_size));
+}
+
+std::shared_ptr<ShmRing> ShmRing::open(const string &name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw std::runtime_error(
+            error_message("failed to open shared memory", name));
+    }
+    struct stat st;
+    void *mapping = MAP_FAILED;
+    size_t mapping_size = 0;
+    if (fstat(fd, &st) == 0 &&
+        static_cast<size_t>(st.st_size) > sizeof(Control)) {
+        mapping_size = static_cast<size_t>(st.st_size);
+        mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error(
+            error_message("failed to map shared memory", name));
+    }
+    auto *control = static_cast<Control *>(mapping);
+    if (__atomic_load_n(&control->magic, __ATOMIC_ACQUIRE) != kShmRingMagic ||
+        control->capacity != mapping_size - sizeof(Control)) {
+        munmap(mapping, mapping_size);
+        throw std::runtime_error(name + " is not a ring of records");
+    }
+    return std::shared_ptr<ShmRing>(new ShmRing(name, mapping, mapping_size));
+}
+
+ShmRing::~ShmRing() { munmap(mapping_, mapping_size_); }
+
+void ShmRing::unlink() { shm_unlink(name_.c_str()); }
+
+#endif  // defined(_WIN32)
+
+bool ShmRing::try_push(const Sink::Buffer *buffers, size_t num) {
+    size_t size = 0;
+    for (size_t i = 0; i < num; ++i) size += buffers[i].size;
+    if (size > max_record_size()) {
+        throw std::invalid_argument("record of " + std::to_string(size) +
+                                    " bytes is too large for ring " + name_);
+    }
+    const uint64_t slot_size = padded(kHeaderSize + size);
+
+    // reserve the slot, plus padding up to the end of the ring if the
+    // record would wrap around it
+    uint64_t head = __atomic_load_n(&control_->head, __ATOMIC_RELAXED);
+    uint64_t padding;
+    for (;;) {
+        uint64_t offset = head & (capacity_ - 1);
+        padding = capacity_ - offset < slot_size ? capacity_ - offset : 0;
+        uint64_t tail = __atomic_load_n(&control_->tail, __ATOMIC_ACQUIRE);
+        if (head + padding + slot_size - tail > capacity_) return false;
+        if (__atomic_compare_exchange_n(&control_->head, &head,
+                                        head + padding + slot_size, true,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            break;
+        }
+    }
+
+    if (padding > 0) {
+        __atomic_store_n(
+            reinterpret_cast<uint64_t *>(records_ + (head & (capacity_ - 1))),
+            (padding << 8) | kPadding, __ATOMIC_RELEASE);
+        head += padding;
+    }
+    char *slot = records_ + (head & (capacity_ - 1));
+    char *p = slot + kHeaderSize;
+    for (size_t i = 0; i < num; ++i) {
+        memcpy(p, buffers[i].data, buffers[i].size);
+        p += buffers[i].size;
+    }
+    __atomic_store_n(reinterpret_cast<uint64_t *>(slot),
+                     (static_cast<uint64_t>(size) << 8) | kRecord,
+                     __ATOMIC_RELEASE);
+    return true;
+}
+
+void ShmRingSink::writev(const Buffer *buffers, size_t num) {
+    size_t size = 0;
+    for (size_t i = 0; i < num; ++i) size += buffers[i].size;
+    for (int attempt = 0; !ring_->try_push(buffers, num); ++attempt) {
+        if (!block_) {
+            ring_->add_dropped();
+            return;
+        }
+        // the collector drains the ring every few hundred microseconds
+        if (attempt < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    size_ += size;
+}
+
+SinkFactory shm_ring_sink(std::shared_ptr<ShmRing> ring, bool block) {
+    return [ring, block](const string &, bool) {
+        return std::unique_ptr<Sink>(new ShmRingSink(ring, block));
+    };
+}
+
+ShmRingCollector::ShmRingCollector(ShmRing &ring, TensorBoardLogger &logger,
+                                   size_t poll_interval_us)
+    : ring_(ring), logger_(logger), poll_interval_us_(poll_interval_us) {
+    thread_ = std::thread(&ShmRingCollector::run, this);
+}
+
+ShmRingCollector::~ShmRingCollector() { stop(); }
+
+void ShmRingCollector::stop() {
+    stop_ = true;
+    if (thread_.joinable()) thread_.join();
+}
+
+void ShmRingCollector::run() {
+    auto write = [this](const char *data, size_t size) {
+        logger_.write_records(data, size);
+    };
+    for (;;) {
+        bool stopping = stop_.load();
+        size_t num_records = 0;
+        try {
+            num_records = ring_.drain(write);
+        } catch (const std::exception &e) {
+            // e.g. the logger was closed under us
+            std::cerr << e.what() << std::endl;
+            return;
+        }
+        num_records_ += num_records;
+        if (stopping) return;
+        if (num_records == 0) {
+            std::this_thread::sleep_for(
+                std::chrono::microseconds(poll_interval_us_));
+        }
+    }
+}
@@ -0,0 +1,530 @@
+#include "sink.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define TBL_IO_URING 1
+#endif
+#endif
+
+using std::string;
+
+namespace {
+
+string error_message(const string &what, const string &filename) {
+    return what + " " + filename + ": " + strerror(errno);
+}
+
+class StreamSink : public Sink {
+   public:
+    StreamSink(const string &filename, bool append)
+        : filename_(filename),
+          ofs_(filename, std::ios::out |
+                             (append ? std::ios::app : std::ios::trunc) |
+                             std::ios::binary) {
+        if (!ofs_.is_open()) {
+            throw std::runtime_error("failed to open log_file " + filename);
+        }
+        ofs_.seekp(0, std::ios::end);
+        size_ = static_cast<uint64_t>(ofs_.tellp());
+    }
+
+    void write(const char *data, size_t size) override {
+        ofs_.write(data, size);
+        if (!ofs_) throw std::runtime_error("failed to write " + filename_);
+        size_ += size;
+    }
+    void flush() override {
+        ofs_.flush();
+        if (!ofs_) throw std::runtime_error("failed to flush " + filename_);
+    }
+    void close() override {
+        if (ofs_.is_open()) ofs_.close();
+    }
+    uint64_t size() const override { return size_; }
+
+   private:
+    string filename_;
+    std::ofstream ofs_;
+    uint64_t size_ = 0;
+};
+
+#if !defined(_WIN32)
+
+// Page aligned, so that the kernel copies whole pages out of it.
+struct AlignedBuffer {
+    explicit AlignedBuffer(size_t size) : size(size) {
+        if (size > 0 && posix_memalign(&data, 4096, size) != 0) {
+            throw std::bad_alloc();
+        }
+    }
+    ~AlignedBuffer() { free(data); }
+    AlignedBuffer(const AlignedBuffer &) = delete;
+    AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+
+    char *bytes() const { return static_cast<char *>(data); }
+
+    void *data = nullptr;
+    size_t size;
+};
+
+class FdSink : public Sink {
+   public:
+    FdSink(const string &filename, bool append, size_t buffer_bytes,
+           size_t preallocate_bytes)
+        : filename_(filename),
+          buffer_(buffer_bytes),
+          preallocate_bytes_(preallocate_bytes) {
+        fd_ = open(filename.c_str(),
+                   O_WRONLY | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC),
+                   0644);
+        if (fd_ < 0) {
+            throw std::runtime_error(
+                error_message("failed to open log_file", filename));
+        }
+        struct stat st;
+        if (fstat(fd_, &st) != 0 || lseek(fd_, 0, SEEK_END) < 0) {
+            ::close(fd_);
+            throw std::runtime_error(
+                error_message("failed to open log_file", filename));
+        }
+        size_ = written_ = reserved_ = static_cast<uint64_t>(st.st_size);
+    }
+    ~FdSink() override {
+        try {
+            FdSink::close();
+        } catch (const std::exception &) {
+            // nowhere to report it, close() is where errors are seen
+        }
+    }
+
+    void write(const char *data, size_t size) override {
+        Buffer buffer = {data, size};
+        writev(&buffer, 1);
+    }
+
+    void writev(const Buffer *buffers, size_t num) override {
+        size_t total = 0;
+        for (size_t i = 0; i < num; ++i) total += buffers[i].size;
+        if (total <= buffer_.size - used_) {
+            for (size_t i = 0; i < num; ++i) {
+                memcpy(buffer_.bytes() + used_, buffers[i].data,
+                       buffers[i].size);
+                used_ += buffers[i].size;
+            }
+            size_ += total;
+            return;
+        }
+        if (num > kMaxBuffers) {
+            for (size_t i = 0; i < num; i += kMaxBuffers) {
+                writev(buffers + i,
+                       num - i < kMaxBuffers ? num - i : kMaxBuffers);
+            }
+            return;
+        }
+
+        // what is buffered and the new buffers go out in one system call
+        struct iovec iov[kMaxBuffers + 1];
+        int iovcnt = 0;
+        if (used_ > 0) {
+            iov[iovcnt].iov_base = buffer_.bytes();
+            iov[iovcnt++].iov_len = used_;
+        }
+        for (size_t i = 0; i < num; ++i) {
+            iov[iovcnt].iov_base = const_cast<char *>(buffers[i].data);
+            iov[iovcnt++].iov_len = buffers[i].size;
+        }
+        write_fully(iov, iovcnt);
+        used_ = 0;
+        size_ += total;
+    }
+
+    void flush() override {
+        if (used_ == 0) return;
+        struct iovec iov = {buffer_.bytes(), used_};
+        write_fully(&iov, 1);
+        used_ = 0;
+    }
+
+    void close() override {
+        if (fd_ < 0) return;
+        int fd = fd_;
+        try {
+            flush();
+        } catch (const std::exception &) {
+            fd_ = -1;
+            ::close(fd);
+            throw;
+        }
+        fd_ = -1;
+        // give back the space reserved past the end
+        bool ok = reserved_ <= written_ ||
+                  ftruncate(fd, static_cast<off_t>(written_)) == 0;
+        ok = ::close(fd) == 0 && ok;
+        if (!ok) {
+            throw std::runtime_error(
+                error_message("failed to close", filename_));
+        }
+    }
+
+    uint64_t size() const override { return size_; }
+
+    bool sync() override {
+        if (fd_ < 0) return false;
+#if defined(__APPLE__)
+        bool ok = fsync(fd_) == 0;
+#else
+        bool ok = fdatasync(fd_) == 0;
+#endif
+        if (!ok) {
+            throw std::runtime_error(
+                error_message("failed to sync", filename_));
+        }
+        return true;
+    }
+
+   protected:
+    static const size_t kMaxBuffers = 8;
+
+    // Writes `iov` at the end of the file, all of it.
+    void write_fully(struct iovec *iov, int iovcnt) {
+        size_t total = 0;
+        for (int i = 0; i < iovcnt; ++i) total += iov[i].iov_len;
+        reserve(written_ + total);
+        while (iovcnt > 0) {
+            ssize_t n = ::writev(fd_, iov, iovcnt);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(
+                    error_message("failed to write", filename_));
+            }
+            written_ += static_cast<uint64_t>(n);
+            auto left = static_cast<size_t>(n);
+            while (iovcnt > 0 && left >= iov->iov_len) {
+                left -= iov->iov_len;
+                ++iov;
+                --iovcnt;
+            }
+            if (iovcnt > 0) {
+                iov->iov_base = static_cast<char *>(iov->iov_base) + left;
+                iov->iov_len -= left;
+            }
+        }
+    }
+
+    // Reserves disk space up to at least `end`, preallocate_bytes_ at a
+    // time. Best effort: file systems without fallocate() just grow the file.
+    void reserve(uint64_t end) {
+#if defined(__linux__)
+        if (preallocate_bytes_ == 0 || end <= reserved_) return;
+        uint64_t new_end =
+            (end + preallocate_bytes_ - 1) / preallocate_bytes_ *
+            preallocate_bytes_;
+        if (fallocate(fd_, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(reserved_),
+                      static_cast<off_t>(new_end - reserved_)) != 0) {
+            preallocate_bytes_ = 0;
+            return;
+        }
+        reserved_ = new_end;
+#else
+        (void)end;
+#endif
+    }
+
+    string filename_;
+    int fd_ = -1;
+    AlignedBuffer buffer_;
+    size_t used_ = 0;
+    uint64_t size_ = 0;     // including what is buffered
+    uint64_t written_ = 0;  // handed to the kernel
+    uint64_t reserved_ = 0;
+    size_t preallocate_bytes_;
+};
+
+const size_t FdSink::kMaxBuffers;
+
+#endif  // !defined(_WIN32)
+
+#ifdef TBL_IO_URING
+
+// Fills one buffer while the kernel writes the previous one. io_uring is
+// driven through the raw system calls, so that there is no liburing
+// dependency; IORING_OP_WRITEV only needs Linux 5.1.
+class IoUringSink : public FdSink {
+   public:
+    // Throws if the kernel does not let us set up a ring.
+    IoUringSink(const string &filename, bool append, size_t buffer_bytes,
+                size_t preallocate_bytes)
+        : FdSink(filename, append, 0, preallocate_bytes) {
+        for (auto &slot : slots_) {
+            slot.buffer.reset(new AlignedBuffer(buffer_bytes));
+        }
+
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        ring_fd_ = static_cast<int>(
+            syscall(__NR_io_uring_setup, kNumSlots, &params));
+        if (ring_fd_ < 0) {
+            throw std::runtime_error(
+                error_message("failed to set up io_uring for", filename));
+        }
+        sq_ring_size_ =
+            params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes +
+                        params.cq_entries * sizeof(struct io_uring_cqe);
+        bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ =
+                sq_ring_size_ > cq_ring_size_ ? sq_ring_size_ : cq_ring_size_;
+        }
+        sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+        sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ =
+            single_mmap ? sq_ring_ : map(cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_ = static_cast<struct io_uring_sqe *>(
+            map(sqes_size_, IORING_OFF_SQES));
+        if (sq_ring_ == nullptr || cq_ring_ == nullptr || sqes_ == nullptr) {
+            release_ring();
+            throw std::runtime_error(
+                error_message("failed to map io_uring for", filename));
+        }
+
+        auto sq = static_cast<char *>(sq_ring_);
+        sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        auto cq = static_cast<char *>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        cqes_ =
+            reinterpret_cast<struct io_uring_cqe *>(cq + params.cq_off.cqes);
+    }
+
+    ~IoUringSink() override {
+        try {
+            IoUringSink::close();
+        } catch (const std::exception &) {
+        }
+        release_ring();
+    }
+
+    void write(const char *data, size_t size) override {
+        Buffer buffer = {data, size};
+        writev(&buffer, 1);
+    }
+
+    void writev(const Buffer *buffers, size_t num) override {
+        for (size_t i = 0; i < num; ++i) {
+            const char *data = buffers[i].data;
+            size_t size = buffers[i].size;
+            size_ += size;
+            while (size > 0) {
+                Slot &slot = slots_[current_];
+                size_t n = slot.buffer->size - slot.used;
+                n = n < size ? n : size;
+                memcpy(slot.buffer->bytes() + slot.used, data, n);
+                slot.used += n;
+                data += n;
+                size -= n;
+                if (slot.used == slot.buffer->size) submit_current();
+            }
+        }
+    }
+
+    void flush() override {
+        if (slots_[current_].used > 0) submit_current();
+        for (size_t i = 0; i < kNumSlots; ++i) wait(i);
+    }
+
+    void close() override {
+        if (fd_ < 0) return;
+        try {
+            flush();
+        } catch (const std::exception &) {
+            FdSink::close();
+            throw;
+        }
+        FdSink::close();
+    }
+
+   private:
+    static const unsigned kNumSlots = 2;
+
+    struct Slot {
+        std::unique_ptr<AlignedBuffer> buffer;
+        size_t used = 0;
+        struct iovec iov;
+        uint64_t offset = 0;
+        bool in_flight = false;
+    };
+
+    void *map(size_t size, uint64_t offset) {
+        void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring_fd_,
+                       static_cast<off_t>(offset));
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    void release_ring() {
+        if (sqes_ != nullptr) munmap(sqes_, sqes_size_);
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+            munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != nullptr) munmap(sq_ring_, sq_ring_size_);
+        if (ring_fd_ >= 0) ::close(ring_fd_);
+        sqes_ = nullptr;
+        sq_ring_ = cq_ring_ = nullptr;
+        ring_fd_ = -1;
+    }
+
+    int enter(unsigned to_submit, unsigned min_complete, unsigned flags) {
+        for (;;) {
+            long ret = syscall(__NR_io_uring_enter, ring_fd_, to_submit,
+                               min_complete, flags, nullptr, 0);
+            if (ret >= 0 || errno != EINTR) return static_cast<int>(ret);
+        }
+    }
+
+    // Queues the write of the current slot and moves on to the next one,
+    // once the kernel is done with it.
+    void submit_current() {
+        Slot &slot = slots_[current_];
+        slot.iov.iov_base = slot.buffer->bytes();
+        slot.iov.iov_len = slot.used;
+        slot.offset = written_;
+        reserve(written_ + slot.used);
+        written_ += slot.used;
+
+        unsigned tail = *sq_tail_;
+        unsigned index = tail & sq_mask_;
+        struct io_uring_sqe *sqe = &sqes_[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_WRITEV;
+        sqe->fd = fd_;
+        sqe->addr = reinterpret_cast<uint64_t>(&slot.iov);
+        sqe->len = 1;
+        sqe->off = slot.offset;
+        sqe->user_data = current_;
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        if (enter(1, 0, 0) != 1) {
+            throw std::runtime_error(
+                error_message("failed to submit a write to", filename_));
+        }
+        slot.in_flight = true;
+
+        current_ = (current_ + 1) % kNumSlots;
+        wait(current_);
+    }
+
+    // Reaps completions until the write of slot `i` is done.
+    void wait(size_t i) {
+        while (slots_[i].in_flight) {
+            unsigned head = *cq_head_;
+            if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+                if (enter(0, 1, IORING_ENTER_GETEVENTS) < 0) {
+                    throw std::runtime_error(error_message(
+                        "failed to wait for a write to", filename_));
+                }
+                continue;
+            }
+            struct io_uring_cqe cqe = cqes_[head & cq_mask_];
+            __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+            complete(slots_[cqe.user_data], cqe.res);
+        }
+    }
+
+    void complete(Slot &slot, int res) {
+        slot.in_flight = false;
+        if (res < 0) {
+            errno = -res;
+            throw std::runtime_error(
+                error_message("failed to write", filename_));
+        }
+        // short writes are finished synchronously
+        auto done = static_cast<size_t>(res);
+        while (done < slot.used) {
+            ssize_t n = pwrite(fd_, slot.buffer->bytes() + done,
+                               slot.used - done,
+                               static_cast<off_t>(slot.offset + done));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                throw std::runtime_error(
+                    error_message("failed to write", filename_));
+            }
+            done += static_cast<size_t>(n);
+        }
+        slot.used = 0;
+    }
+
+    Slot slots_[kNumSlots];
+    size_t current_ = 0;
+
+    int ring_fd_ = -1;
+    void *sq_ring_ = nullptr;
+    void *cq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    struct io_uring_sqe *sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned *sq_tail_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned *sq_array_ = nullptr;
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    struct io_uring_cqe *cqes_ = nullptr;
+};
+
+const unsigned IoUringSink::kNumSlots;
+
+#endif  // TBL_IO_URING
+
+}  // namespace
+
+std::unique_ptr<Sink> open_file_sink(SinkType type, const string &filename,
+                                     bool append, size_t buffer_bytes,
+                                     size_t preallocate_bytes) {
+#if defined(_WIN32)
+    (void)type;
+    (void)buffer_bytes;
+    (void)preallocate_bytes;
+    return std::unique_ptr<Sink>(new StreamSink(filename, append));
+#else
+    switch (type) {
+        case SinkType::kStream:
+            return std::unique_ptr<Sink>(new StreamSink(filename, append));
+        case SinkType::kIoUring:
+#ifdef TBL_IO_URING
+            if (buffer_bytes > 0) {
+                try {
+                    return std::unique_ptr<Sink>(new IoUringSink(
+                        filename, append, buffer_bytes, preallocate_bytes));
+                } catch (const std::runtime_error &) {
+                    // e.g. an old kernel or a seccomp filter, use write(2)
+                }
+            }
+#endif
+            break;
+        case SinkType::kPosix:
+            break;
+    }
+    return std::unique_ptr<Sink>(
+        new FdSink(filename, append, buffer_bytes, preallocate_bytes));
+#endif
+}
@@ -2,19 +2,37 @@
 
 #include <google/protobuf/text_format.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "api.pb.h"
 #include "crc.h"
 #include "event.pb.h"
+#include "event_reader.h"
+#include "pr_curve.h"
+#include "pr_curve_plugin_data.pb.h"
 #include "projector_config.pb.h"
+#include "wav_encoder.h"
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using google::protobuf::TextFormat;
 using std::endl;
@@ -30,6 +48,572 @@ using tensorflow::Summary;
 using tensorflow::SummaryMetadata;
 using tensorflow::TensorProto;
 
+// The async writer concatenates queued records up to this size before
+// issuing a write.
+const size_t kAsyncBatchBytes = 4 << 20;
+
+namespace {
+
+// Events built by the add_* methods live on a per-thread arena whose first
+// block is owned by the thread, and the event itself is kept between writes:
+// clearing its summary keeps the cleared values and the capacity of their
+// strings for the next event, so logging scalars does not touch the heap
+// once warmed up. The arena is reset, which hands the first block back
+// without freeing it, once it outgrows that block or after a large event,
+// whose payload would otherwise stay alive until the next reset.
+const size_t kScratchBlockSize = 64 << 10;
+const size_t kMaxRetainedEventSize = 16 << 10;
+
+// Images and audio of at least this size are written by
+// write_payload_event() instead of being copied into the event.
+const size_t kStreamedPayloadBytes = 64 << 10;
+
+// Serialization buffers that grew past this size for a large event are
+// released after the write, instead of being kept for the thread's lifetime.
+const size_t kMaxRetainedBufferSize = 1 << 20;
+
+struct EventScratch {
+    EventScratch()
+        : block(new char[kScratchBlockSize]),
+          arena(block.get(), kScratchBlockSize) {}
+
+    std::unique_ptr<char[]> block;
+    google::protobuf::Arena arena;
+    Event *event = nullptr;  // on `arena`
+};
+
+EventScratch &event_scratch() {
+    static thread_local EventScratch scratch;
+    return scratch;
+}
+
+string &serialization_buffer() {
+    static thread_local string buffer;
+    return buffer;
+}
+
+uint64_t elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+}
+
+const size_t kRecordHeaderBytes = sizeof(uint64_t) + sizeof(uint32_t);
+
+// length, masked crc of the length
+void record_header(uint64_t data_len, char *header) {
+    uint32_t len_crc =
+        masked_crc32c((char *)&data_len, sizeof(data_len));  // NOLINT
+    memcpy(header, &data_len, sizeof(data_len));
+    memcpy(header + sizeof(data_len), &len_crc, sizeof(len_crc));
+}
+
+// masked crc of the data, given in parts
+uint32_t record_footer(const Sink::Buffer *parts, size_t num_parts) {
+    uint32_t crc = 0;
+    for (size_t i = 0; i < num_parts; ++i) {
+        crc = crc32c_extend(crc, parts[i].data, parts[i].size);
+    }
+    return mask_crc32c(crc);
+}
+
+// length, masked crc of the length, data, masked crc of the data
+string framed_record(const Sink::Buffer *parts, size_t num_parts) {
+    uint64_t data_len = 0;
+    for (size_t i = 0; i < num_parts; ++i) data_len += parts[i].size;
+    char header[kRecordHeaderBytes];
+    record_header(data_len, header);
+    uint32_t data_crc = record_footer(parts, num_parts);
+
+    string record;
+    record.reserve(sizeof(header) + data_len + sizeof(data_crc));
+    record.append(header, sizeof(header));
+    for (size_t i = 0; i < num_parts; ++i) {
+        record.append(parts[i].data, parts[i].size);
+    }
+    record.append((char *)&data_crc, sizeof(data_crc));  // NOLINT
+    return record;
+}
+
+string framed_record(const char *data, size_t size) {
+    const Sink::Buffer part = {data, size};
+    return framed_record(&part, 1);
+}
+
+// protobuf base 128 varints
+size_t varint_size(uint64_t value) {
+    size_t size = 1;
+    for (; value >= 0x80; value >>= 7) ++size;
+    return size;
+}
+
+void append_varint(string *s, uint64_t value) {
+    for (; value >= 0x80; value >>= 7) {
+        s->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    }
+    s->push_back(static_cast<char>(value));
+}
+
+// One label per line, written in one go rather than flushed line by line.
+void write_metadata(const string &filename, const vector<string> &metadata) {
+    size_t size = 0;
+    for (const auto &meta : metadata) size += meta.size() + 1;
+    string content;
+    content.reserve(size);
+    for (const auto &meta : metadata) content.append(meta).push_back('\n');
+    ofstream metadata_file(filename, std::ios::binary);
+    if (!metadata_file.is_open()) {
+        throw std::runtime_error("failed to open metadata file " + filename);
+    }
+    metadata_file.write(content.data(), content.size());
+    metadata_file.close();
+    if (!metadata_file) {
+        throw std::runtime_error("failed to write metadata file " + filename);
+    }
+}
+
+bool file_exists(const string &filename) {
+    return ifstream(filename).good();
+}
+
+bool sync_file(const string &filename) {
+#if defined(_WIN32)
+    int fd = _open(filename.c_str(), _O_WRONLY | _O_BINARY);
+    if (fd < 0) return false;
+    bool ok = _commit(fd) == 0;
+    _close(fd);
+#else
+    int fd = open(filename.c_str(), O_WRONLY);
+    if (fd < 0) return false;
+#if defined(__APPLE__)
+    bool ok = fsync(fd) == 0;
+#else
+    bool ok = fdatasync(fd) == 0;
+#endif
+    close(fd);
+#endif
+    return ok;
+}
+
+void truncate_file(const string &filename, uint64_t size) {
+#if defined(_WIN32)
+    int fd = _open(filename.c_str(), _O_RDWR | _O_BINARY);
+    bool ok = fd >= 0 && _chsize_s(fd, size) == 0;
+    if (fd >= 0) _close(fd);
+#else
+    bool ok = truncate(filename.c_str(), static_cast<off_t>(size)) == 0;
+#endif
+    if (!ok) throw std::runtime_error("failed to truncate " + filename);
+}
+
+// Cuts a record torn by a crash off the end of `filename`, and the events
+// past `restore_step` if it is not negative. Only the last `scan_bytes` of
+// the file are read, more only if they hold no complete record or if all of
+// their events are past `restore_step`: events are assumed to be logged in
+// step order.
+ResumeInfo repair_event_file(const string &filename, uint64_t scan_bytes,
+                             int64_t restore_step) {
+    ResumeInfo info;
+    if (!file_exists(filename)) return info;
+
+    struct Record {
+        uint64_t offset;
+        int64_t step;
+        vector<string> tags;
+    };
+    vector<Record> records;
+    uint64_t file_size, valid_end, cut;
+    string kept;  // events after the cut that are written back
+    {
+        TensorBoardEventReader reader(filename);
+        file_size = reader.file_size();
+        uint64_t window = scan_bytes > 0 ? scan_bytes : 1;
+        for (;;) {
+            uint64_t start = file_size > window ? file_size - window : 0;
+            records.clear();
+            valid_end = start;
+            if (reader.sync(start)) {
+                for (;;) {
+                    if (reader.next()) {
+                        records.push_back(
+                            {reader.offset(), reader.step(), reader.tags()});
+                        continue;
+                    }
+                    if (reader.ok()) {
+                        valid_end = file_size;
+                        break;
+                    }
+                    // only torn if nothing valid follows, otherwise the
+                    // damage is not ours to repair
+                    valid_end = reader.end_offset();
+                    if (!reader.sync(valid_end + 1)) break;
+                }
+            }
+            bool before_window =
+                records.empty() ||
+                (restore_step >= 0 && records.front().step > restore_step);
+            if (start == 0 || !before_window) break;
+            window *= 2;
+        }
+
+        size_t first_dropped = records.size();
+        for (size_t i = 0; i < records.size(); ++i) {
+            const auto &record = records[i];
+            if (restore_step >= 0 && record.step > restore_step) {
+                if (first_dropped == records.size()) first_dropped = i;
+                ++info.dropped_records;
+                continue;
+            }
+            if (first_dropped < records.size()) {
+                reader.seek(record.offset);
+                reader.next();
+                kept += framed_record(reader.data(), reader.size());
+            }
+            for (const auto &tag : record.tags) {
+                info.last_steps[tag] = record.step;
+            }
+        }
+        cut = first_dropped < records.size() ? records[first_dropped].offset
+                                              : valid_end;
+        info.torn_bytes = file_size - valid_end;
+    }
+
+    if (cut < file_size) {
+        truncate_file(filename, cut);
+        if (!kept.empty()) {
+            ofstream ofs(filename, std::ios::app | std::ios::binary);
+            ofs.write(kept.data(), kept.size());
+            if (!ofs) throw std::runtime_error("failed to rewrite " + filename);
+        }
+    }
+    return info;
+}
+
+void replace_all(string *s, const string &from, const string &to) {
+    for (auto pos = s->find(from); pos != string::npos;
+         pos = s->find(from, pos + to.size())) {
+        s->replace(pos, from.size(), to);
+    }
+}
+
+}  // namespace
+
+TensorBoardLogger::TensorBoardLogger(const std::string &log_file,
+                                     const TensorBoardLoggerOptions &options) {
+    this->options = options;
+    auto basename = get_basename(log_file);
+    if (basename.find("tfevents") == std::string::npos) {
+        throw std::runtime_error(
+            "A valid event file must contain substring \"tfevents\" in its "
+            "basename, got " +
+            basename);
+    }
+    log_file_ = log_file;
+    if (rotating()) {
+        if (options.file_name_template_.find("{index}") == string::npos) {
+            throw std::runtime_error(
+                "file_name_template must contain \"{index}\", got " +
+                options.file_name_template_);
+        }
+        basename = get_basename(event_file_name(1));
+        if (basename.find("tfevents") == std::string::npos) {
+            throw std::runtime_error(
+                "file_name_template must keep substring \"tfevents\" in the "
+                "basename, got " +
+                basename);
+        }
+        if (options.resume_) {
+            while (file_exists(event_file_name(file_index_ + 1))) {
+                ++file_index_;
+            }
+        } else {
+            // files left over by an earlier run would be read after ours
+            for (size_t i = 1; std::remove(event_file_name(i).c_str()) == 0;
+                 ++i) {
+            }
+        }
+    }
+    if (options.resume_) {
+        resume_info_ = repair_event_file(event_file_name(file_index_),
+                                         options.resume_scan_bytes_,
+                                         options.restore_step_);
+        // The events past restore_step may span rotated files: the earlier
+        // ones are repaired too, up to one keeping an event of an earlier
+        // step. The emptied files keep their file_version event, and the
+        // logger still appends to the last one.
+        bool emptied = resume_info_.last_steps.empty();
+        for (size_t i = file_index_;
+             options.restore_step_ >= 0 && i > 0 && emptied;) {
+            auto info = repair_event_file(event_file_name(--i),
+                                          options.resume_scan_bytes_,
+                                          options.restore_step_);
+            resume_info_.torn_bytes += info.torn_bytes;
+            resume_info_.dropped_records += info.dropped_records;
+            emptied = info.last_steps.empty();
+            // the steps found in later files take precedence
+            resume_info_.last_steps.insert(info.last_steps.begin(),
+                                           info.last_steps.end());
+        }
+    }
+    sink_ = open_event_file(file_index_, options.resume_, &file_bytes_)
+                .release();
+    file_opened_ = std::chrono::steady_clock::now();
+    if (rotating()) {
+        // the flusher opens the following ones
+        next_sink_ =
+            open_event_file(file_index_ + 1, false, &next_file_bytes_);
+    }
+    log_dir_ = get_parent_dir(log_file);
+
+    flushing_thread = std::thread(&TensorBoardLogger::flusher, this);
+    if (options.async_) {
+        async_queue_.reset(
+            new BoundedQueue<std::string>(options.async_queue_size_));
+        async_writer_thread_ =
+            std::thread(&TensorBoardLogger::async_writer, this);
+    }
+}
+
+TensorBoardLogger::~TensorBoardLogger() {
+    try {
+        close();
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+    }
+}
+
+void TensorBoardLogger::close() {
+    if (closed_.load()) return;
+    // images queued before close() are still logged
+    wait_for_image_tasks();
+    if (closed_.exchange(true)) return;
+
+    // the writer thread drains whatever is still queued before exiting
+    if (async_writer_thread_.joinable()) {
+        {
+            // producers blocked on a full queue give up, the others finish
+            // their push first so that the writer sees it
+            std::unique_lock<std::mutex> lock{async_mtx_};
+            async_space_cv_.notify_all();
+            async_producers_cv_.wait(
+                lock, [this] { return async_producers_.load() == 0; });
+        }
+        async_stop_ = true;
+        notify_async_writer();
+        async_writer_thread_.join();
+    }
+
+    // the flusher touches the sinks, stop it before closing them
+    {
+        std::lock_guard<std::mutex> lock{file_object_mtx};
+        stop = true;
+    }
+    flusher_cv_.notify_all();
+    if (flushing_thread.joinable()) {
+        flushing_thread.join();
+    }
+
+    std::unique_lock<std::mutex> lock{file_object_mtx};
+    syncs_done_cv_.wait(lock, [this] { return syncs_in_progress_ == 0; });
+    std::unique_ptr<Sink> sink(sink_);
+    sink_ = nullptr;
+    auto retired = std::move(retired_sinks_);
+    retired_sinks_.clear();
+    auto next = std::move(next_sink_);
+    // every sink is closed even if some fail, the first error is reported
+    string error;
+    auto close_sink = [&error](Sink *s) {
+        try {
+            s->close();
+        } catch (const std::exception &e) {
+            if (error.empty()) error = e.what();
+        }
+    };
+    close_sink(sink.get());
+    for (auto &s : retired) close_sink(s.get());
+    if (next) {
+        // opened ahead of time and never used, it only holds the header
+        close_sink(next.get());
+        if (next->on_disk()) {
+            std::remove(event_file_name(file_index_ + 1).c_str());
+        }
+    }
+    if (!error.empty()) throw std::runtime_error(error);
+    if (options.durability_ == Durability::kSync) sync_files(lock);
+    throw_background_error();
+}
+
+int TensorBoardLogger::flush() {
+    wait_for_image_tasks();
+    drain_async_writer();
+    auto start = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock{file_object_mtx};
+    if (sink_ != nullptr) {
+        sink_->flush();
+        queue_size = 0;
+    }
+    stats_.local().flush_latency.record(elapsed_ns(start));
+    throw_background_error();
+    return 0;
+}
+
+int TensorBoardLogger::sync_until(int64_t step) {
+    std::lock_guard<std::mutex> sync_lock{sync_mtx_};
+    if (step <= synced_step_) {
+        throw_background_error();
+        return 0;
+    }
+    drain_async_writer();
+    {
+        std::unique_lock<std::mutex> lock{file_object_mtx};
+        sync_files(lock);
+    }
+    throw_background_error();
+    synced_step_ = step;
+    return 0;
+}
+
+void TensorBoardLogger::set_background_error(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock{background_error_mtx_};
+    if (!background_error_) background_error_ = error;
+}
+
+void TensorBoardLogger::throw_background_error() {
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock{background_error_mtx_};
+        error.swap(background_error_);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+// Called with `lock` held on file_object_mtx, which is released while the
+// OS writes the files out.
+void TensorBoardLogger::sync_files(std::unique_lock<std::mutex> &lock) {
+    // timed however it returns
+    struct Timer {
+        LatencyHistogram &latency;
+        std::chrono::steady_clock::time_point start;
+        ~Timer() { latency.record(elapsed_ns(start)); }
+    } timer{stats_.local().sync_latency, std::chrono::steady_clock::now()};
+    bool on_disk = true;
+    if (sink_ != nullptr) {
+        sink_->flush();
+        on_disk = sink_->on_disk();
+    }
+    bytes_since_durable_ = 0;
+    durable_requested_ = false;
+    if (!on_disk) return;
+    Sink *current = sink_;  // nullptr once the logger is closed
+    // rotated files were flushed when they were retired and may be closed
+    // already, they are synced by name; so is the current file if its sink
+    // cannot sync itself, or once the logger is closed
+    size_t first = synced_file_index_, last = file_index_;
+    ++syncs_in_progress_;
+    lock.unlock();
+    string error;
+    for (size_t i = first; i <= last; ++i) {
+        bool ok;
+        try {
+            ok = i == last && current != nullptr && current->sync();
+        } catch (const std::exception &e) {
+            error = e.what();
+            continue;
+        }
+        if (!ok && !sync_file(event_file_name(i))) {
+            error = "failed to sync " + event_file_name(i);
+        }
+    }
+    lock.lock();
+    if (--syncs_in_progress_ == 0) {
+        syncs_done_cv_.notify_all();
+        flusher_cv_.notify_one();  // retired sinks can be closed now
+    }
+    if (last > synced_file_index_) synced_file_index_ = last;
+    if (!error.empty()) throw std::runtime_error(error);
+}
+
+string TensorBoardLogger::event_file_name(size_t index) const {
+    if (index == 0) return log_file_;
+    char padded_index[32];
+    snprintf(padded_index, sizeof(padded_index), "%06zu", index);
+    string name = options.file_name_template_;
+    replace_all(&name, "{base}", log_file_);
+    replace_all(&name, "{index}", padded_index);
+    return name;
+}
+
+std::unique_ptr<Sink> TensorBoardLogger::open_event_file(
+    size_t index, bool resume, size_t *file_bytes) const {
+    auto filename = event_file_name(index);
+    std::unique_ptr<Sink> sink;
+    if (options.sink_factory_) {
+        sink = options.sink_factory_(filename, resume);
+        if (!sink) {
+            throw std::runtime_error("sink_factory returned no sink for " +
+                                     filename);
+        }
+    } else {
+        sink = open_file_sink(options.sink_, filename, resume,
+                              options.sink_buffer_bytes_,
+                              options.preallocate_bytes_);
+    }
+    *file_bytes = static_cast<size_t>(sink->size());
+    if (*file_bytes == 0 && !sink->shared()) {
+        // every event file starts with its version, like the ones written by
+        // tensorflow's EventsWriter
+        Event event;
+        double wall_time = time(nullptr);
+        event.set_wall_time(wall_time);
+        event.set_file_version(kEventFileVersion);
+        string data = event.SerializeAsString();
+        auto record = framed_record(data.data(), data.size());
+        sink->write(record.data(), record.size());
+        *file_bytes = record.size();
+    }
+    return sink;
+}
+
+// Called with file_object_mtx held after writing to the current file.
+void TensorBoardLogger::after_write(size_t bytes_written) {
+    file_bytes_ += bytes_written;
+    if (options.durability_ != Durability::kBuffered &&
+        options.durability_bytes_ > 0) {
+        bytes_since_durable_ += bytes_written;
+        if (bytes_since_durable_ >= options.durability_bytes_ &&
+            !durable_requested_) {
+            durable_requested_ = true;
+            flusher_cv_.notify_one();
+        }
+    }
+
+    if (!rotating()) return;
+    bool full = options.max_file_bytes_ > 0 &&
+                file_bytes_ >= options.max_file_bytes_;
+    bool old = options.max_file_age_s_ > 0 &&
+               std::chrono::steady_clock::now() - file_opened_ >=
+                   std::chrono::seconds(options.max_file_age_s_);
+    if (!full && !old) return;
+    if (next_sink_ == nullptr) {
+        // still being opened, keep writing to the current file meanwhile
+        flusher_cv_.notify_one();
+        return;
+    }
+
+    // hand the data over to the OS now, sync_files() syncs retired files by
+    // name
+    sink_->flush();
+    retired_sinks_.emplace_back(sink_);
+    sink_ = next_sink_.release();
+    ++file_index_;
+    stats_.local().rotations.add(1);
+    file_bytes_ = next_file_bytes_;
+    file_opened_ = std::chrono::steady_clock::now();
+    queue_size = 0;
+    flusher_cv_.notify_one();
+}
+
 Summary *summary_pb(const string &tag, HParamsPluginData *hparams_plugin_data) {
     auto *summary = new Summary();
     auto *content = new HParamsPluginData();
@@ -47,32 +631,10 @@ Summary *summary_pb(const string &tag, HParamsPluginData *hparams_plugin_data) {
     return summary;
 }
 
-// https://github.com/dmlc/tensorboard/blob/master/python/tensorboard/summary.py#L115
-int TensorBoardLogger::generate_default_buckets() {
-    if (bucket_limits_ == nullptr) {
-        bucket_limits_ = new vector<double>;
-        vector<double> pos_buckets, neg_buckets;
-        double v = 1e-12;
-        while (v < 1e20) {
-            pos_buckets.push_back(v);
-            neg_buckets.push_back(-v);
-            v *= 1.1;
-        }
-        pos_buckets.push_back(std::numeric_limits<double>::max());
-        neg_buckets.push_back(std::numeric_limits<double>::lowest());
-
-        bucket_limits_->insert(bucket_limits_->end(), neg_buckets.rbegin(),
-                               neg_buckets.rend());
-        bucket_limits_->insert(bucket_limits_->end(), pos_buckets.begin(),
-                               pos_buckets.end());
-    }
-
-    return 0;
-}
-
 int TensorBoardLogger::add_hparams(const map<string, Value> &hparams,
                                    const string &group_name,
                                    double start_time_secs) {
+    StatsScope scope(stats_, EventKind::kHparams);
     auto *session_start_info = new SessionStartInfo();
     session_start_info->set_group_name(group_name);
     session_start_info->set_start_time_secs(start_time_secs);
@@ -93,14 +655,102 @@ int TensorBoardLogger::add_session_start_info(
 }
 
 int TensorBoardLogger::add_scalar(const string &tag, int step, double value) {
-    auto *summary = new Summary();
-    auto *v = summary->add_value();
-    v->set_tag(tag);
-    v->set_simple_value(value);
-    return add_event(step, summary);
+    StatsScope scope(stats_, EventKind::kScalar);
+    auto admission = admit_scalar(tag, step);
+    if (admission == ScalarAdmission::kDrop) return 0;
+    return add_admitted_scalar(tag, step, admission, value);
+}
+
+void TensorBoardLogger::set_scalar_policy(const string &tag,
+                                          const ScalarPolicy &policy) {
+    std::lock_guard<std::mutex> lock{scalar_policies_mtx_};
+    ScalarPolicyState state;
+    state.policy = policy;
+    scalar_policies_[tag] = state;
+    has_scalar_policies_ = true;
+}
+
+bool TensorBoardLogger::scalar_due(const ScalarPolicyState &state,
+                                   int64_t step) {
+    if (!state.logged) return true;
+    // a step going backwards starts over, e.g. a new epoch
+    auto every_n_steps = static_cast<int64_t>(state.policy.every_n_steps_);
+    if (step >= state.last_step && step - state.last_step < every_n_steps) {
+        return false;
+    }
+    return state.policy.min_interval_ms_ == 0 ||
+           std::chrono::steady_clock::now() - state.last_time >=
+               std::chrono::milliseconds(state.policy.min_interval_ms_);
+}
+
+TensorBoardLogger::ScalarAdmission TensorBoardLogger::admit_scalar(
+    const string &tag, int step) {
+    if (!has_scalar_policies_.load(std::memory_order_relaxed)) {
+        return ScalarAdmission::kWrite;
+    }
+    std::lock_guard<std::mutex> lock{scalar_policies_mtx_};
+    auto it = scalar_policies_.find(tag);
+    if (it == scalar_policies_.end()) return ScalarAdmission::kWrite;
+    auto &state = it->second;
+    if (state.policy.aggregate_) return ScalarAdmission::kAggregate;
+    if (!scalar_due(state, step)) return ScalarAdmission::kDrop;
+    state.logged = true;
+    state.last_step = step;
+    state.last_time = std::chrono::steady_clock::now();
+    return ScalarAdmission::kWrite;
+}
+
+int TensorBoardLogger::add_admitted_scalar(const string &tag, int step,
+                                           ScalarAdmission admission,
+                                           double value) {
+    StatsScope scope(stats_, EventKind::kScalar);
+    if (admission == ScalarAdmission::kWrite) {
+        auto *event = scratch_event(step);
+        fill_scalar(event->mutable_summary()->add_value(), tag, value);
+        return write_scratch_event(event);
+    }
+
+    size_t count;
+    double sum, min, max;
+    {
+        std::lock_guard<std::mutex> lock{scalar_policies_mtx_};
+        auto &state = scalar_policies_[tag];
+        if (!state.policy.aggregate_) {
+            // the policy was replaced since admit_scalar()
+            return add_admitted_scalar(tag, step, ScalarAdmission::kWrite,
+                                       value);
+        }
+        if (state.count == 0) {
+            state.min = state.max = value;
+        } else {
+            state.min = value < state.min ? value : state.min;
+            state.max = value > state.max ? value : state.max;
+        }
+        state.sum += value;
+        ++state.count;
+        if (!scalar_due(state, step)) return 0;
+
+        count = state.count;
+        sum = state.sum;
+        min = state.min;
+        max = state.max;
+        state.logged = true;
+        state.last_step = step;
+        state.last_time = std::chrono::steady_clock::now();
+        state.count = 0;
+        state.sum = 0.0;
+    }
+
+    auto *event = scratch_event(step);
+    auto *summary = event->mutable_summary();
+    fill_scalar(summary->add_value(), tag + "/mean", sum / count);
+    fill_scalar(summary->add_value(), tag + "/min", min);
+    fill_scalar(summary->add_value(), tag + "/max", max);
+    return write_scratch_event(event);
 }
 
 int TensorBoardLogger::add_scalar(const string &tag, int step, float value) {
+    StatsScope scope(stats_, EventKind::kScalar);
     return add_scalar(tag, step, static_cast<double>(value));
 }
 
@@ -109,111 +759,578 @@ int TensorBoardLogger::add_image(const string &tag, int step,
                                  int width, int channel,
                                  const string &display_name,
                                  const string &description) {
-    auto *meta = new SummaryMetadata();
+    StatsScope scope(stats_, EventKind::kImage);
+    return add_image(tag, step, BytesView(encoded_image), height, width,
+                     channel, display_name, description);
+}
+
+int TensorBoardLogger::add_image(const string &tag, int step,
+                                 BytesView encoded_image, int height,
+                                 int width, int channel,
+                                 const string &display_name,
+                                 const string &description) {
+    StatsScope scope(stats_, EventKind::kImage);
+    if (encoded_image.size >= kStreamedPayloadBytes) {
+        Summary::Value value;
+        fill_image(&value, tag, string(), height, width, channel,
+                   display_name, description);
+        std::unique_ptr<Summary::Image> image(value.release_image());
+        return write_payload_event(
+            step, value, Summary::Value::kImageFieldNumber, *image,
+            Summary::Image::kEncodedImageStringFieldNumber, &encoded_image, 1);
+    }
+    auto *event = scratch_event(step);
+    auto *v = event->mutable_summary()->add_value();
+    fill_image(v, tag, string(), height, width, channel, display_name,
+               description);
+    v->mutable_image()->set_encoded_image_string(encoded_image.data,
+                                                 encoded_image.size);
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_images(
+    const std::string &tag, int step,
+    const std::vector<std::string> &encoded_images, int height, int width,
+    const std::string &display_name, const std::string &description) {
+    StatsScope scope(stats_, EventKind::kImage);
+    vector<BytesView> views(encoded_images.begin(), encoded_images.end());
+    return add_images(tag, step, views.data(), views.size(), height, width,
+                      display_name, description);
+}
+
+int TensorBoardLogger::add_images(const string &tag, int step,
+                                  const BytesView *encoded_images,
+                                  size_t num_images, int height, int width,
+                                  const string &display_name,
+                                  const string &description) {
+    StatsScope scope(stats_, EventKind::kImage);
+    size_t total = 0;
+    for (size_t i = 0; i < num_images; ++i) total += encoded_images[i].size;
+    if (total >= kStreamedPayloadBytes) {
+        Summary::Value value;
+        fill_images(&value, tag, {}, height, width, display_name,
+                    description);
+        std::unique_ptr<TensorProto> tensor(value.release_tensor());
+        return write_payload_event(step, value,
+                                   Summary::Value::kTensorFieldNumber, *tensor,
+                                   TensorProto::kStringValFieldNumber,
+                                   encoded_images, num_images);
+    }
+    auto *event = scratch_event(step);
+    auto *v = event->mutable_summary()->add_value();
+    fill_images(v, tag, {}, height, width, display_name, description);
+    for (size_t i = 0; i < num_images; ++i) {
+        v->mutable_tensor()->add_string_val(encoded_images[i].data,
+                                            encoded_images[i].size);
+    }
+    return write_scratch_event(event);
+}
+
+namespace {
+
+size_t raw_image_bytes(int height, int width, int channel) {
+    if (height <= 0 || width <= 0 || channel < 1 || channel > 4) {
+        throw std::invalid_argument("raw image must be height x width x "
+                                    "channel with 1 to 4 channels");
+    }
+    return static_cast<size_t>(height) * width * channel;
+}
+
+}  // namespace
+
+std::future<int> TensorBoardLogger::add_image_raw(
+    const string &tag, int step, const uint8_t *hwc, int height, int width,
+    int channel, const string &display_name, const string &description) {
+    size_t bytes = raw_image_bytes(height, width, channel);
+    auto pixels = std::make_shared<vector<uint8_t>>(hwc, hwc + bytes);
+    return submit_image_task([=]() {
+        string png =
+            encode_png(pixels->data(), height, width, channel, options.png_);
+        return add_image(tag, step, png, height, width, channel, display_name,
+                         description);
+    });
+}
+
+std::future<int> TensorBoardLogger::add_images_raw(
+    const string &tag, int step, const uint8_t *nhwc, size_t num_images,
+    int height, int width, int channel, const string &display_name,
+    const string &description) {
+    size_t bytes = raw_image_bytes(height, width, channel);
+    auto pixels =
+        std::make_shared<vector<uint8_t>>(nhwc, nhwc + num_images * bytes);
+    return submit_image_task([=]() {
+        vector<string> pngs(num_images);
+        thread_pool().parallel_for(num_images, [&](size_t i) {
+            pngs[i] = encode_png(pixels->data() + i * bytes, height, width,
+                                 channel, options.png_);
+        });
+        return add_images(tag, step, pngs, height, width, display_name,
+                          description);
+    });
+}
+
+std::future<int> TensorBoardLogger::submit_image_task(
+    std::function<int()> task) {
+    if (closed_.load(std::memory_order_relaxed)) {
+        throw std::runtime_error("logging to a closed logger");
+    }
+    {
+        std::lock_guard<std::mutex> lock{image_tasks_mtx_};
+        ++pending_image_tasks_;
+    }
+    // counted down even if the task throws, its error goes to the future
+    struct Done {
+        TensorBoardLogger *logger;
+        ~Done() {
+            std::lock_guard<std::mutex> lock{logger->image_tasks_mtx_};
+            --logger->pending_image_tasks_;
+            logger->image_tasks_cv_.notify_all();
+        }
+    };
+    return thread_pool().submit([this, task]() {
+        Done done{this};
+        return task();
+    });
+}
+
+void TensorBoardLogger::wait_for_image_tasks() {
+    std::unique_lock<std::mutex> lock{image_tasks_mtx_};
+    image_tasks_cv_.wait(lock, [this] { return pending_image_tasks_ == 0; });
+}
+
+int TensorBoardLogger::add_audio(const string &tag, int step,
+                                 const string &encoded_audio, float sample_rate,
+                                 int num_channels, int length_frame,
+                                 const string &content_type,
+                                 const string &display_name,
+                                 const string &description) {
+    StatsScope scope(stats_, EventKind::kAudio);
+    return add_audio(tag, step, BytesView(encoded_audio), sample_rate,
+                     num_channels, length_frame, content_type, display_name,
+                     description);
+}
+
+int TensorBoardLogger::add_audio(const string &tag, int step,
+                                 BytesView encoded_audio, float sample_rate,
+                                 int num_channels, int length_frame,
+                                 const string &content_type,
+                                 const string &display_name,
+                                 const string &description) {
+    StatsScope scope(stats_, EventKind::kAudio);
+    if (encoded_audio.size >= kStreamedPayloadBytes) {
+        Summary::Value value;
+        fill_audio(&value, tag, string(), sample_rate, num_channels,
+                   length_frame, content_type, display_name, description);
+        std::unique_ptr<Summary::Audio> audio(value.release_audio());
+        return write_payload_event(
+            step, value, Summary::Value::kAudioFieldNumber, *audio,
+            Summary::Audio::kEncodedAudioStringFieldNumber, &encoded_audio, 1);
+    }
+    auto *event = scratch_event(step);
+    auto *v = event->mutable_summary()->add_value();
+    fill_audio(v, tag, string(), sample_rate, num_channels, length_frame,
+               content_type, display_name, description);
+    v->mutable_audio()->set_encoded_audio_string(encoded_audio.data,
+                                                 encoded_audio.size);
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_audio_pcm(const string &tag, int step,
+                                     const float *samples, size_t frames,
+                                     int channels, float sample_rate,
+                                     const string &display_name,
+                                     const string &description) {
+    StatsScope scope(stats_, EventKind::kAudio);
+    auto *event = scratch_event(step);
+    fill_audio_pcm(event->mutable_summary()->add_value(), tag, samples,
+                   frames, channels, sample_rate, display_name, description);
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_audios_pcm(const string &tag, int step,
+                                      const float *clips, size_t num_clips,
+                                      size_t frames, int channels,
+                                      float sample_rate,
+                                      const string &display_name,
+                                      const string &description) {
+    StatsScope scope(stats_, EventKind::kAudio);
+    auto *event = scratch_event(step);
+    auto *summary = event->mutable_summary();
+    vector<Summary::Value *> values(num_clips);
+    for (auto &v : values) v = summary->add_value();
+    size_t clip_samples = frames * static_cast<size_t>(channels);
+    auto fill = [&](size_t i) {
+        string clip_tag = tag + "/audio/" + to_string(i);
+        fill_audio_pcm(values[i], clip_tag, clips + i * clip_samples, frames,
+                       channels, sample_rate, display_name, description);
+    };
+    // below kParallelSamples, handing clips to the pool costs more than
+    // converting them
+    const size_t kParallelSamples = 1 << 16;
+    if (num_clips > 1 && clip_samples >= kParallelSamples) {
+        thread_pool().parallel_for(num_clips, fill);
+    } else {
+        for (size_t i = 0; i < num_clips; ++i) fill(i);
+    }
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_text(const string &tag, int step, const char *text) {
+    StatsScope scope(stats_, EventKind::kText);
+    auto *event = scratch_event(step);
+    fill_text(event->mutable_summary()->add_value(), tag, text);
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_histogram(const string &tag, int step,
+                                     const QuantileSketch &sketch) {
+    StatsScope scope(stats_, EventKind::kHistogram);
+    auto *event = scratch_event(step);
+    fill_histogram(event->mutable_summary()->add_value(), tag, sketch);
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_pr_curve(const string &tag, int step,
+                                    const float *predictions,
+                                    const uint8_t *labels, size_t num,
+                                    uint32_t num_thresholds,
+                                    const float *weights,
+                                    const string &display_name,
+                                    const string &description) {
+    StatsScope scope(stats_, EventKind::kPrCurve);
+    // already far more than a plot can show, and the event holds six rows
+    // of them
+    if (num_thresholds < 2 || num_thresholds > kMaxPrCurveThresholds) {
+        throw std::invalid_argument("pr curve needs 2 to " +
+                                    std::to_string(kMaxPrCurveThresholds) +
+                                    " thresholds");
+    }
+    // The chunks are striped over one set of counts per thread, each binned
+    // in chunk order, then the sets are added up in order.
+    const size_t kChunkSize = 1 << 20;
+    const size_t num_counts = 2 * static_cast<size_t>(num_thresholds);
+    size_t num_chunks = (num + kChunkSize - 1) / kChunkSize;
+    size_t num_stripes = 1;
+    if (num_chunks > 1) {
+        num_stripes = std::min(num_chunks, thread_pool().size() + 1);
+    }
+    vector<double> counts(num_counts * num_stripes);
+    auto bin = [&](size_t stripe) {
+        for (size_t chunk = stripe; chunk < num_chunks;
+             chunk += num_stripes) {
+            size_t begin = chunk * kChunkSize;
+            size_t n = num - begin < kChunkSize ? num - begin : kChunkSize;
+            bin_pr_predictions(predictions + begin, labels + begin,
+                               weights == nullptr ? nullptr : weights + begin,
+                               n, num_thresholds, &counts[stripe * num_counts]);
+        }
+    };
+    if (num_stripes > 1) {
+        thread_pool().parallel_for(num_stripes, bin);
+        for (size_t stripe = 1; stripe < num_stripes; ++stripe) {
+            const double *partial = &counts[stripe * num_counts];
+            for (size_t i = 0; i < num_counts; ++i) counts[i] += partial[i];
+        }
+    } else {
+        bin(0);
+    }
+
+    auto *event = scratch_event(step);
+    auto *v = event->mutable_summary()->add_value();
+    v->set_tag(tag);
+    auto *meta = v->mutable_metadata();
+    meta->set_display_name(display_name.empty() ? tag : display_name);
+    meta->set_summary_description(description);
+    auto *plugin_data = meta->mutable_plugin_data();
+    plugin_data->set_plugin_name("pr_curves");
+    tensorboard::PrCurvePluginData content;
+    content.set_version(0);
+    content.set_num_thresholds(num_thresholds);
+    plugin_data->set_content(content.SerializeAsString());
+
+    auto *tensor = v->mutable_tensor();
+    tensor->set_dtype(tensorflow::DataType::DT_FLOAT);
+    tensor->mutable_tensor_shape()->add_dim()->set_size(kPrCurveRows);
+    tensor->mutable_tensor_shape()->add_dim()->set_size(num_thresholds);
+    auto *rows = tensor->mutable_float_val();
+    rows->Resize(static_cast<int>(kPrCurveRows * num_thresholds), 0.0f);
+    pr_curve_rows(counts.data(), num_thresholds, rows->mutable_data());
+    return write_scratch_event(event);
+}
+
+int TensorBoardLogger::add_histogram(const string &tag, int step,
+                                     const HistogramAccumulator &accumulator) {
+    StatsScope scope(stats_, EventKind::kHistogram);
+    auto *event = scratch_event(step);
+    fill_histogram(event->mutable_summary()->add_value(), tag,
+                   accumulator.snapshot());
+    return write_scratch_event(event);
+}
+
+void TensorBoardLogger::fill_histogram(Summary::Value *v, const string &tag,
+                                       const Histogram &histogram) {
+    v->set_tag(tag);
+    histogram.to_proto(v->mutable_histo());
+}
+
+void TensorBoardLogger::fill_histogram(Summary::Value *v, const string &tag,
+                                       const QuantileSketch &sketch) {
+    v->set_tag(tag);
+    sketch.to_proto(v->mutable_histo());
+}
+
+void TensorBoardLogger::fill_scalar(Summary::Value *v, const string &tag,
+                                    double value) {
+    v->set_tag(tag);
+    v->set_simple_value(value);
+}
+
+void TensorBoardLogger::fill_image(Summary::Value *v, const string &tag,
+                                   const string &encoded_image, int height,
+                                   int width, int channel,
+                                   const string &display_name,
+                                   const string &description) {
+    v->set_tag(tag);
+
+    auto *meta = v->mutable_metadata();
     meta->set_display_name(display_name.empty() ? tag : display_name);
     meta->set_summary_description(description);
 
-    auto *image = new Summary::Image();
+    auto *image = v->mutable_image();
     image->set_height(height);
     image->set_width(width);
     image->set_colorspace(channel);
     image->set_encoded_image_string(encoded_image);
-
-    auto *summary = new Summary();
-    auto *v = summary->add_value();
-    v->set_tag(tag);
-    v->set_allocated_image(image);
-    v->set_allocated_metadata(meta);
-    return add_event(step, summary);
 }
 
-int TensorBoardLogger::add_images(
-    const std::string &tag, int step,
+void TensorBoardLogger::fill_images(
+    Summary::Value *v, const std::string &tag,
     const std::vector<std::string> &encoded_images, int height, int width,
     const std::string &display_name, const std::string &description) {
-    auto *plugin_data = new SummaryMetadata::PluginData();
-    plugin_data->set_plugin_name("images");
-    auto *meta = new SummaryMetadata();
+    v->set_tag(tag);
+
+    auto *meta = v->mutable_metadata();
     meta->set_display_name(display_name.empty() ? tag : display_name);
     meta->set_summary_description(description);
-    meta->set_allocated_plugin_data(plugin_data);
+    meta->mutable_plugin_data()->set_plugin_name("images");
 
-    auto *tensor = new TensorProto();
+    auto *tensor = v->mutable_tensor();
     tensor->set_dtype(tensorflow::DataType::DT_STRING);
     tensor->add_string_val(to_string(width));
     tensor->add_string_val(to_string(height));
     for (const auto &image : encoded_images) tensor->add_string_val(image);
-
-    auto *summary = new Summary();
-    auto *v = summary->add_value();
-    v->set_tag(tag);
-    v->set_allocated_tensor(tensor);
-    v->set_allocated_metadata(meta);
-
-    return add_event(step, summary);
 }
 
+// Sleeps until the next thing to do: opening or closing files for rotation,
+// the periodic flush, or making events durable. Writers and close() wake it
+// up through flusher_cv_.
 void TensorBoardLogger::flusher() {
-    auto period = std::chrono::seconds(options.flush_period_s_);
-    auto next_flush_time = std::chrono::high_resolution_clock::now() + period;
+    typedef std::chrono::steady_clock clock;
+    const auto never = clock::time_point::max();
+    const auto flush_period = std::chrono::seconds(options.flush_period_s_);
+    const auto durability_period =
+        std::chrono::milliseconds(options.durability_period_ms_);
+    const bool durable = options.durability_ != Durability::kBuffered;
 
+    auto next_flush_time = clock::now() + flush_period;
+    auto next_durable_time = durable && options.durability_period_ms_ > 0
+                                 ? clock::now() + durability_period
+                                 : never;
+    auto retry_open_time = clock::now();
+    const auto stats_period = std::chrono::seconds(options.stats_period_s_);
+    auto next_stats_time =
+        options.stats_period_s_ > 0 ? clock::now() + stats_period : never;
+    ThreadStats &stats = stats_.local();
+
+    std::unique_lock<std::mutex> lock{file_object_mtx};
     while (!stop) {
-        if (std::chrono::high_resolution_clock::now() < next_flush_time) {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+        stats.flusher_wakeups.add(1);
+        // also switches the file of an idle logger once it is too old
+        after_write(0);
+
+        auto now = clock::now();
+        // retired sinks stay open while a sync may be using one of them
+        bool close_retired =
+            !retired_sinks_.empty() && syncs_in_progress_ == 0;
+        if (close_retired ||
+            (rotating() && next_sink_ == nullptr && now >= retry_open_time)) {
+            // opening and closing files may block, leave the lock to writers
+            std::vector<std::unique_ptr<Sink>> retired;
+            if (close_retired) retired.swap(retired_sinks_);
+            bool open_next = rotating() && next_sink_ == nullptr;
+            size_t next_index = file_index_ + 1, next_bytes = 0;
+            lock.unlock();
+
+            for (auto &sink : retired) {
+                try {
+                    sink->close();
+                } catch (...) {
+                    set_background_error(std::current_exception());
+                }
+            }
+            std::unique_ptr<Sink> next;
+            if (open_next) {
+                try {
+                    next = open_event_file(next_index, false, &next_bytes);
+                } catch (...) {
+                    // retried in a second, meanwhile writers stay on the
+                    // current file
+                    set_background_error(std::current_exception());
+                    retry_open_time = clock::now() + std::chrono::seconds(1);
+                }
+            }
+
+            lock.lock();
+            if (next) {
+                next_sink_ = std::move(next);
+                next_file_bytes_ = next_bytes;
+                continue;
+            }
+            if (!retired.empty()) continue;
+        }
+
+        if (durable && (durable_requested_ || now >= next_durable_time)) {
+            try {
+                if (options.durability_ == Durability::kSync) {
+                    sync_files(lock);
+                } else {
+                    auto start = clock::now();
+                    sink_->flush();
+                    stats.flush_latency.record(elapsed_ns(start));
+                    bytes_since_durable_ = 0;
+                    durable_requested_ = false;
+                }
+            } catch (...) {
+                set_background_error(std::current_exception());
+            }
+            now = clock::now();
+            if (next_durable_time != never) {
+                next_durable_time = now + durability_period;
+            }
+            next_flush_time = now + flush_period;
+            continue;
+        }
+        if (now >= next_flush_time) {
+            try {
+                sink_->flush();
+            } catch (...) {
+                set_background_error(std::current_exception());
+            }
+            stats.flush_latency.record(elapsed_ns(now));
+            next_flush_time = now + flush_period;
+        }
+        if (now >= next_stats_time && !closed_.load()) {
+            // written like any other event, which takes the lock
+            lock.unlock();
+            try {
+                log_stats();
+            } catch (...) {
+                set_background_error(std::current_exception());
+            }
+            lock.lock();
+            next_stats_time = clock::now() + stats_period;
             continue;
         }
 
-        std::lock_guard<std::mutex> lock{file_object_mtx};
-        ofs_->flush();
-        next_flush_time = std::chrono::high_resolution_clock::now() + period;
+        auto deadline = std::min(
+            {next_flush_time, next_durable_time, next_stats_time});
+        if (rotating() && next_sink_ == nullptr) {
+            deadline = std::min(deadline, retry_open_time);
+        }
+        if (options.max_file_age_s_ > 0) {
+            deadline = std::min(
+                deadline,
+                file_opened_ + std::chrono::seconds(options.max_file_age_s_));
+        }
+        if (deadline == never) {
+            flusher_cv_.wait(lock);
+        } else {
+            flusher_cv_.wait_until(lock, deadline);
+        }
     }
 }
 
-int TensorBoardLogger::add_audio(const string &tag, int step,
-                                 const string &encoded_audio, float sample_rate,
-                                 int num_channels, int length_frame,
-                                 const string &content_type,
-                                 const string &display_name,
-                                 const string &description) {
-    auto *meta = new SummaryMetadata();
+void TensorBoardLogger::log_stats() {
+    auto stats = stats_.snapshot();
+    auto *summary = new Summary();
+    auto scalar = [summary](const string &tag, double value) {
+        fill_scalar(summary->add_value(), "_logger/" + tag, value);
+    };
+    for (size_t k = 0; k < kNumEventKinds; ++k) {
+        const auto &kind = stats.kinds[k];
+        if (kind.calls == 0) continue;
+        string name = event_kind_name(static_cast<EventKind>(k));
+        scalar(name + "/calls", kind.calls);
+        scalar(name + "/bytes", kind.bytes);
+        scalar(name + "/p50_us", kind.latency.p50_ns / 1e3);
+        scalar(name + "/p99_us", kind.latency.p99_ns / 1e3);
+    }
+    scalar("records", stats.records);
+    scalar("bytes", stats.bytes);
+    scalar("lock_contended", stats.lock_contended);
+    scalar("lock_wait_ms", stats.lock_wait_ns / 1e6);
+    scalar("serialize_ms", stats.serialize_ns / 1e6);
+    scalar("crc_ms", stats.crc_ns / 1e6);
+    scalar("flush_p99_us", stats.flush_latency.p99_ns / 1e3);
+    if (stats.sync_latency.count > 0) {
+        scalar("sync_p99_us", stats.sync_latency.p99_ns / 1e3);
+    }
+    scalar("rotations", stats.rotations);
+    add_event(last_step_.load(std::memory_order_relaxed), summary);
+}
+
+void TensorBoardLogger::fill_audio(Summary::Value *v, const string &tag,
+                                   const string &encoded_audio,
+                                   float sample_rate, int num_channels,
+                                   int length_frame, const string &content_type,
+                                   const string &display_name,
+                                   const string &description) {
+    v->set_tag(tag);
+
+    auto *meta = v->mutable_metadata();
     meta->set_display_name(display_name.empty() ? tag : display_name);
     meta->set_summary_description(description);
 
-    auto *audio = new Summary::Audio();
+    auto *audio = v->mutable_audio();
     audio->set_sample_rate(sample_rate);
     audio->set_num_channels(num_channels);
     audio->set_length_frames(length_frame);
     audio->set_encoded_audio_string(encoded_audio);
     audio->set_content_type(content_type);
-
-    auto *summary = new Summary();
-    auto *v = summary->add_value();
-    v->set_tag(tag);
-    v->set_allocated_audio(audio);
-    v->set_allocated_metadata(meta);
-    return add_event(step, summary);
 }
 
-int TensorBoardLogger::add_text(const string &tag, int step, const char *text) {
-    auto *plugin_data = new SummaryMetadata::PluginData();
-    plugin_data->set_plugin_name(kTextPluginName);
-
-    auto *meta = new SummaryMetadata();
-    meta->set_allocated_plugin_data(plugin_data);
+void TensorBoardLogger::fill_audio_pcm(Summary::Value *v, const string &tag,
+                                       const float *samples, size_t frames,
+                                       int channels, float sample_rate,
+                                       const string &display_name,
+                                       const string &description) {
+    v->set_tag(tag);
 
-    auto *tensor = new TensorProto();
-    tensor->set_dtype(tensorflow::DataType::DT_STRING);
+    auto *meta = v->mutable_metadata();
+    meta->set_display_name(display_name.empty() ? tag : display_name);
+    meta->set_summary_description(description);
 
-    auto *str_val = tensor->add_string_val();
-    *str_val = text;
+    auto *audio = v->mutable_audio();
+    audio->set_sample_rate(sample_rate);
+    audio->set_num_channels(channels);
+    audio->set_length_frames(static_cast<int64_t>(frames));
+    audio->set_content_type("audio/wav");
+    // encoded in place, the string keeps its capacity in the scratch event
+    string *wav = audio->mutable_encoded_audio_string();
+    wav->resize(wav_size(frames, channels));
+    encode_wav(samples, frames, channels,
+               static_cast<uint32_t>(std::lround(sample_rate)), &(*wav)[0]);
+}
 
-    auto *summary = new Summary();
-    auto *v = summary->add_value();
+void TensorBoardLogger::fill_text(Summary::Value *v, const string &tag,
+                                  const char *text) {
     v->set_tag(tag);
-    v->set_allocated_tensor(tensor);
-    v->set_allocated_metadata(meta);
+    v->mutable_metadata()->mutable_plugin_data()->set_plugin_name(
+        kTextPluginName);
 
-    return add_event(step, summary);
+    auto *tensor = v->mutable_tensor();
+    tensor->set_dtype(tensorflow::DataType::DT_STRING);
+    tensor->add_string_val(text);
 }
 
 int TensorBoardLogger::add_embedding(const std::string &tensor_name,
@@ -221,48 +1338,41 @@ int TensorBoardLogger::add_embedding(const std::string &tensor_name,
                                      const std::string &metadata_path,
                                      const std::vector<uint32_t> &tensor_shape,
                                      int step) {
-    auto *plugin_data = new SummaryMetadata::PluginData();
-    plugin_data->set_plugin_name(kProjectorPluginName);
-    auto *meta = new SummaryMetadata();
-    meta->set_allocated_plugin_data(plugin_data);
-
-    const auto &filename = log_dir_ + kProjectorConfigFile;
-    auto *conf = new ProjectorConfig();
-
-    // parse possibly existing config file
-    ifstream fin(filename);
-    if (fin.is_open()) {
-        ostringstream ss;
-        ss << fin.rdbuf();
-        TextFormat::ParseFromString(ss.str(), conf);
-        fin.close();
-    }
+    StatsScope scope(stats_, EventKind::kEmbedding);
+    {
+        std::lock_guard<std::mutex> lock{projector_mtx_};
+        if (!projector_config_) {
+            // parse possibly existing config file
+            projector_config_.reset(new ProjectorConfig());
+            ifstream fin(log_dir_ + kProjectorConfigFile);
+            if (fin.is_open()) {
+                ostringstream ss;
+                ss << fin.rdbuf();
+                TextFormat::ParseFromString(ss.str(), projector_config_.get());
+            }
+        }
 
-    auto *embedding = conf->add_embeddings();
-    embedding->set_tensor_name(tensor_name);
-    embedding->set_tensor_path(tensordata_path);
-    if (metadata_path != "") {
-        embedding->set_metadata_path(metadata_path);
-    }
-    if (tensor_shape.size() > 0) {
-        for (auto shape : tensor_shape) embedding->add_tensor_shape(shape);
+        auto *embedding = projector_config_->add_embeddings();
+        embedding->set_tensor_name(tensor_name);
+        embedding->set_tensor_path(tensordata_path);
+        if (metadata_path != "") {
+            embedding->set_metadata_path(metadata_path);
+        }
+        if (tensor_shape.size() > 0) {
+            for (auto shape : tensor_shape) embedding->add_tensor_shape(shape);
+        }
+        projector_dirty_ = true;
+        if (projector_batches_ == 0) write_projector_config();
     }
 
-    // `conf` and `embedding` will be deleted by ProjectorConfig destructor
-
-    ofstream fout(filename);
-    string content;
-    TextFormat::PrintToString(*conf, &content);
-    fout << content;
-    fout.close();
-
     // Following line is just to add plugin and does not hold any meaning
-    auto *summary = new Summary();
-    auto *v = summary->add_value();
+    auto *event = scratch_event(step);
+    auto *v = event->mutable_summary()->add_value();
     v->set_tag("embedding");
-    v->set_allocated_metadata(meta);
+    v->mutable_metadata()->mutable_plugin_data()->set_plugin_name(
+        kProjectorPluginName);
 
-    return add_event(step, summary);
+    return write_scratch_event(event);
 }
 
 int TensorBoardLogger::add_embedding(
@@ -271,6 +1381,7 @@ int TensorBoardLogger::add_embedding(
     const std::string &tensordata_filename,
     const std::vector<std::string> &metadata,
     const std::string &metadata_filename, int step) {
+    StatsScope scope(stats_, EventKind::kEmbedding);
     ofstream binary_tensor_file(log_dir_ + tensordata_filename,
                                 std::ios::binary);
     if (!binary_tensor_file.is_open()) {
@@ -287,13 +1398,7 @@ int TensorBoardLogger::add_embedding(
         if (metadata.size() != tensor.size()) {
             throw std::runtime_error("tensor size != metadata size");
         }
-        ofstream metadata_file(log_dir_ + metadata_filename);
-        if (!metadata_file.is_open()) {
-            throw std::runtime_error("failed to open metadata file " +
-                                     log_dir_ + metadata_filename);
-        }
-        for (const auto &meta : metadata) metadata_file << meta << endl;
-        metadata_file.close();
+        write_metadata(log_dir_ + metadata_filename, metadata);
     }
     vector<uint32_t> tensor_shape;
     tensor_shape.push_back(tensor.size());
@@ -309,6 +1414,7 @@ int TensorBoardLogger::add_embedding(const std::string &tensor_name,
                                      const std::vector<std::string> &metadata,
                                      const std::string &metadata_filename,
                                      int step) {
+    StatsScope scope(stats_, EventKind::kEmbedding);
     ofstream binary_tensor_file(log_dir_ + tensordata_filename,
                                 std::ios::binary);
     if (!binary_tensor_file.is_open()) {
@@ -325,50 +1431,626 @@ int TensorBoardLogger::add_embedding(const std::string &tensor_name,
         if (metadata.size() != tensor_shape[0]) {
             throw std::runtime_error("tensor size != metadata size");
         }
-        ofstream metadata_file(log_dir_ + metadata_filename);
-        if (!metadata_file.is_open()) {
-            throw std::runtime_error("failed to open metadata file " +
-                                     log_dir_ + metadata_filename);
-        }
-        for (const auto &meta : metadata) metadata_file << meta << endl;
-        metadata_file.close();
+        write_metadata(log_dir_ + metadata_filename, metadata);
     }
     return add_embedding(tensor_name, tensordata_filename, metadata_filename,
                          tensor_shape, step);
 }
 
+// Called with projector_mtx_ held.
+void TensorBoardLogger::write_projector_config() {
+    string content;
+    TextFormat::PrintToString(*projector_config_, &content);
+    // readers see either the old or the new config, never a partial one
+    const auto filename = log_dir_ + kProjectorConfigFile;
+    const auto temp_filename = filename + ".tmp";
+    ofstream fout(temp_filename, std::ios::binary);
+    fout.write(content.data(), content.size());
+    fout.close();
+    if (!fout) throw std::runtime_error("failed to write " + temp_filename);
+#if defined(_WIN32)
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+        throw std::runtime_error("failed to replace " + filename);
+    }
+    projector_dirty_ = false;
+}
+
+ProjectorConfigBatch TensorBoardLogger::batch_projector_config() {
+    std::lock_guard<std::mutex> lock{projector_mtx_};
+    ++projector_batches_;
+    return ProjectorConfigBatch(this);
+}
+
+void TensorBoardLogger::end_projector_batch() {
+    std::lock_guard<std::mutex> lock{projector_mtx_};
+    if (--projector_batches_ == 0 && projector_dirty_) {
+        write_projector_config();
+    }
+}
+
+ProjectorConfigBatch::ProjectorConfigBatch(ProjectorConfigBatch &&other)
+    : logger_(other.logger_) {
+    other.logger_ = nullptr;
+}
+
+ProjectorConfigBatch::~ProjectorConfigBatch() {
+    if (logger_ == nullptr) return;
+    try {
+        logger_->end_projector_batch();
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+    }
+}
+
 int TensorBoardLogger::add_event(int64_t step, Summary *summary) {
     Event event;
     double wall_time = time(nullptr);
     event.set_wall_time(wall_time);
     event.set_step(step);
     event.set_allocated_summary(summary);
+    last_step_.store(step, std::memory_order_relaxed);
     return write(event);
 }
 
+Event *TensorBoardLogger::scratch_event(int64_t step) {
+    auto &scratch = event_scratch();
+    if (scratch.event == nullptr) {
+        scratch.event =
+            google::protobuf::Arena::CreateMessage<Event>(&scratch.arena);
+    }
+    Event *event = scratch.event;
+    // Event::Clear() would drop the summary, and the values it keeps
+    event->mutable_summary()->Clear();
+    double wall_time = time(nullptr);
+    event->set_wall_time(wall_time);
+    event->set_step(step);
+    return event;
+}
+
+int TensorBoardLogger::write_scratch_event(Event *event) {
+    last_step_.store(event->step(), std::memory_order_relaxed);
+    int ret = write(*event);
+    auto &scratch = event_scratch();
+    if (scratch.arena.SpaceAllocated() > kScratchBlockSize ||
+        static_cast<size_t>(event->GetCachedSize()) > kMaxRetainedEventSize) {
+        scratch.event = nullptr;
+        scratch.arena.Reset();
+    }
+    return ret;
+}
+
 int TensorBoardLogger::write(Event &event) {
-    string buf;
-    event.SerializeToString(&buf);
-    auto buf_len = static_cast<uint64_t>(buf.size());
-    uint32_t len_crc =
-        masked_crc32c((char *)&buf_len, sizeof(buf_len));  // NOLINT
-    uint32_t data_crc = masked_crc32c(buf.c_str(), buf.size());
+    // SerializeToString() reuses the capacity of the buffer
+    string &buf = serialization_buffer();
+    StatsScope *scope = StatsScope::current(stats_);
+    if (scope != nullptr && scope->sampled()) {
+        auto start = std::chrono::steady_clock::now();
+        event.SerializeToString(&buf);
+        scope->thread_stats().serialize_ns.add(
+            elapsed_ns(start) * kStatsLatencySampling);
+    } else {
+        event.SerializeToString(&buf);
+    }
+    struct BufferReleaser {
+        string &buf;
+        ~BufferReleaser() {
+            if (buf.capacity() > kMaxRetainedBufferSize) string().swap(buf);
+        }
+    } releaser{buf};
+    return write_record(buf.data(), buf.size());
+}
 
-    std::lock_guard<std::mutex> lock{file_object_mtx};
+int TensorBoardLogger::write_payload_event(
+    int64_t step, const Summary::Value &value, int value_field,
+    const google::protobuf::MessageLite &message, int payload_field,
+    const BytesView *payloads, size_t num_payloads) {
+    // Event {wall_time, step, summary {value {...,
+    //     value_field {message..., payload_field: payloads...}}}},
+    // with the payloads last so that everything before them is serialized
+    // into one small buffer; the lengths of the enclosing messages are known
+    // up front. Fields may come in any order on the wire.
+    auto length_delimited = [](int field) {
+        return (static_cast<uint64_t>(field) << 3) | 2;
+    };
+    const uint64_t payload_tag = length_delimited(payload_field);
+    size_t tags_size = 0, payloads_size = 0;
+    for (size_t i = 0; i < num_payloads; ++i) {
+        size_t n = varint_size(payload_tag) + varint_size(payloads[i].size);
+        tags_size += n;
+        payloads_size += n + payloads[i].size;
+    }
+    size_t message_size = message.ByteSizeLong() + payloads_size;
+    size_t value_size = value.ByteSizeLong() +
+                        varint_size(length_delimited(value_field)) +
+                        varint_size(message_size) + message_size;
+    size_t summary_size = varint_size(length_delimited(1)) +
+                          varint_size(value_size) + value_size;
+
+    Event prefix;
+    double wall_time = time(nullptr);
+    prefix.set_wall_time(wall_time);
+    prefix.set_step(step);
+    last_step_.store(step, std::memory_order_relaxed);
+    string &head = serialization_buffer();
+    head.clear();
+    prefix.AppendToString(&head);
+    append_varint(&head, length_delimited(Event::kSummaryFieldNumber));
+    append_varint(&head, summary_size);
+    append_varint(&head, length_delimited(1));  // Summary.value
+    append_varint(&head, value_size);
+    value.AppendToString(&head);
+    append_varint(&head, length_delimited(value_field));
+    append_varint(&head, message_size);
+    message.AppendToString(&head);
+
+    // sized up front, the parts point into it
+    string tags;
+    tags.reserve(tags_size);
+    vector<Sink::Buffer> parts;
+    parts.reserve(1 + 2 * num_payloads);
+    parts.push_back({head.data(), head.size()});
+    for (size_t i = 0; i < num_payloads; ++i) {
+        size_t start = tags.size();
+        append_varint(&tags, payload_tag);
+        append_varint(&tags, payloads[i].size);
+        parts.push_back({tags.data() + start, tags.size() - start});
+        parts.push_back({payloads[i].data, payloads[i].size});
+    }
+    return write_record(parts.data(), parts.size());
+}
+
+int TensorBoardLogger::write_record(const char *data, size_t size) {
+    const Sink::Buffer part = {data, size};
+    return write_record(&part, 1);
+}
+
+int TensorBoardLogger::write_record(const Sink::Buffer *parts,
+                                    size_t num_parts) {
+    if (closed_.load(std::memory_order_relaxed)) {
+        throw std::runtime_error("logging to a closed logger");
+    }
+    uint64_t size = 0;
+    for (size_t i = 0; i < num_parts; ++i) size += parts[i].size;
+    StatsScope *scope = StatsScope::current(stats_);
+    ThreadStats &stats =
+        scope != nullptr ? scope->thread_stats() : stats_.local();
+    count_record(stats, scope, kRecordHeaderBytes + size + sizeof(uint32_t));
+    if (async_queue_) return enqueue(framed_record(parts, num_parts));
+
+    char header[kRecordHeaderBytes];
+    record_header(size, header);
+    // computed before taking the lock, over the caller's buffers
+    uint32_t data_crc;
+    if (scope != nullptr && scope->sampled()) {
+        auto start = std::chrono::steady_clock::now();
+        data_crc = record_footer(parts, num_parts);
+        stats.crc_ns.add(elapsed_ns(start) * kStatsLatencySampling);
+    } else {
+        data_crc = record_footer(parts, num_parts);
+    }
+
+    // header, data parts, footer
+    Sink::Buffer stack_buffers[8];
+    vector<Sink::Buffer> heap_buffers;
+    Sink::Buffer *buffers = stack_buffers;
+    if (num_parts + 2 > 8) {
+        heap_buffers.resize(num_parts + 2);
+        buffers = heap_buffers.data();
+    }
+    buffers[0] = {header, sizeof(header)};
+    std::copy(parts, parts + num_parts, buffers + 1);
+    buffers[num_parts + 1] = {(char *)&data_crc,  // NOLINT
+                              sizeof(data_crc)};
+
+    auto lock = lock_file(stats);
+    if (sink_ == nullptr) {
+        throw std::runtime_error("logging to a closed logger");
+    }
+    sink_->writev(buffers, num_parts + 2);
+
+    if (queue_size++ > options.max_queue_size_) {
+        sink_->flush();
+        queue_size = 0;
+    }
+    after_write(sizeof(header) + size + sizeof(data_crc));
+
+    return 0;
+}
 
-    ofs_->write((char *)&buf_len, sizeof(buf_len));  // NOLINT
-    ofs_->write((char *)&len_crc, sizeof(len_crc));  // NOLINT
-    ofs_->write(buf.c_str(), buf.size());
-    ofs_->write((char *)&data_crc, sizeof(data_crc));  // NOLINT
+int TensorBoardLogger::write_records(const char *data, size_t size) {
+    if (closed_.load(std::memory_order_relaxed)) {
+        throw std::runtime_error("logging to a closed logger");
+    }
+    StatsScope scope(stats_, EventKind::kRecords);
+    ThreadStats &stats = scope.thread_stats();
+    count_record(stats, &scope, size);
+    if (async_queue_) return enqueue(string(data, size));
 
+    auto lock = lock_file(stats);
+    if (sink_ == nullptr) {
+        throw std::runtime_error("logging to a closed logger");
+    }
+    sink_->write(data, size);
     if (queue_size++ > options.max_queue_size_) {
-        ofs_->flush();
+        sink_->flush();
         queue_size = 0;
     }
+    after_write(size);
+    return 0;
+}
+
+void TensorBoardLogger::count_record(ThreadStats &stats, StatsScope *scope,
+                                     uint64_t bytes) {
+    stats.all_records.add(1);
+    stats.all_bytes.add(bytes);
+    if (scope == nullptr) return;
+    size_t kind = static_cast<size_t>(scope->kind());
+    stats.records[kind].add(1);
+    stats.bytes[kind].add(bytes);
+}
+
+// Only a contended acquisition is timed, an uncontended one costs no more
+// than before.
+std::unique_lock<std::mutex> TensorBoardLogger::lock_file(ThreadStats &stats) {
+    std::unique_lock<std::mutex> lock{file_object_mtx, std::try_to_lock};
+    stats.lock_acquisitions.add(1);
+    if (!lock.owns_lock()) {
+        auto start = std::chrono::steady_clock::now();
+        lock.lock();
+        stats.lock_contended.add(1);
+        stats.lock_wait_ns.add(elapsed_ns(start));
+    }
+    return lock;
+}
 
+int TensorBoardLogger::enqueue(std::string &&record) {
+    // Pairs with close(): either close() waits for this push, or the closed_
+    // check below sees that the logger is closed.
+    async_producers_.fetch_add(1);
+    struct Leave {
+        TensorBoardLogger *logger;
+        ~Leave() {
+            if (logger->async_producers_.fetch_sub(1) == 1 &&
+                logger->closed_.load()) {
+                std::lock_guard<std::mutex> lock{logger->async_mtx_};
+                logger->async_producers_cv_.notify_all();
+            }
+        }
+    } leave{this};
+    if (closed_.load()) throw std::runtime_error("logging to a closed logger");
+
+    if (!async_queue_->try_push(std::move(record))) {
+        switch (options.overflow_policy_) {
+            case OverflowPolicy::kDropNewest:
+                async_dropped_.fetch_add(1, std::memory_order_relaxed);
+                return 0;
+            case OverflowPolicy::kDropOldest: {
+                string oldest;
+                do {
+                    if (async_queue_->try_pop(oldest)) {
+                        async_dropped_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } while (!async_queue_->try_push(std::move(record)));
+                break;
+            }
+            case OverflowPolicy::kBlock: {
+                async_blocked_.fetch_add(1, std::memory_order_relaxed);
+                std::unique_lock<std::mutex> lock{async_mtx_};
+                async_space_waiters_.fetch_add(1);
+                // pairs with the fence in async_writer(): either the writer
+                // sees this waiter after popping, or the push below succeeds
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                for (;;) {
+                    // checked first: once closed, room may never come
+                    if (closed_.load()) {
+                        async_space_waiters_.fetch_sub(1);
+                        throw std::runtime_error("logging to a closed logger");
+                    }
+                    if (async_queue_->try_push(std::move(record))) break;
+                    async_cv_.notify_one();
+                    async_space_cv_.wait(lock);
+                }
+                async_space_waiters_.fetch_sub(1);
+                break;
+            }
+        }
+    }
+    async_enqueued_.fetch_add(1, std::memory_order_relaxed);
+
+    // pairs with the fence in async_writer(): either the writer sees the new
+    // record before going to sleep, or we see that it is asleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (async_writer_idle_.load(std::memory_order_relaxed)) {
+        notify_async_writer();
+    }
     return 0;
 }
 
+void TensorBoardLogger::notify_async_writer() {
+    std::lock_guard<std::mutex> lock{async_mtx_};
+    async_cv_.notify_one();
+}
+
+void TensorBoardLogger::drain_async_writer() {
+    if (!async_queue_) return;
+    uint64_t request = async_flush_requests_.fetch_add(1) + 1;
+    notify_async_writer();
+    std::unique_lock<std::mutex> lock{async_mtx_};
+    async_flushed_cv_.wait(lock, [&] { return async_flushed_ >= request; });
+}
+
+void TensorBoardLogger::async_writer() {
+    string batch, record;
+    vector<size_t> ends;  // of the records in `batch`
+    for (;;) {
+        bool stopping = async_stop_.load();
+        // everything enqueued before this request is popped below
+        uint64_t flush_request = async_flush_requests_.load();
+        batch.clear();
+        ends.clear();
+        while (batch.size() < kAsyncBatchBytes &&
+               async_queue_->try_pop(record)) {
+            batch.append(record);
+            ends.push_back(batch.size());
+        }
+        const size_t num_records = ends.size();
+
+        if (num_records > 0) {
+            auto lock = lock_file(stats_.local());
+            size_t num_written = 0, bytes_written = 0;
+            try {
+                if (sink_->whole_records()) {
+                    for (size_t end : ends) {
+                        sink_->write(batch.data() + bytes_written,
+                                     end - bytes_written);
+                        bytes_written = end;
+                        ++num_written;
+                    }
+                } else {
+                    sink_->write(batch.data(), batch.size());
+                    bytes_written = batch.size();
+                    num_written = num_records;
+                }
+                queue_size += num_records;
+                if (queue_size > options.max_queue_size_) {
+                    sink_->flush();
+                    queue_size = 0;
+                }
+            } catch (...) {
+                // nobody to throw to on this thread
+                set_background_error(std::current_exception());
+            }
+            if (bytes_written > 0) after_write(bytes_written);
+            async_written_.fetch_add(num_written, std::memory_order_relaxed);
+            async_dropped_.fetch_add(num_records - num_written,
+                                     std::memory_order_relaxed);
+            async_batches_.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (async_space_waiters_.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock{async_mtx_};
+                async_space_cv_.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{async_mtx_};
+        if (flush_request > async_flushed_) {
+            async_flushed_ = flush_request;
+            async_flushed_cv_.notify_all();
+        }
+        if (stopping) break;
+
+        async_writer_idle_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (async_queue_->size_approx() == 0 && !async_stop_ &&
+            async_flush_requests_.load() == flush_request) {
+            async_cv_.wait(lock);
+        }
+        async_writer_idle_.store(false, std::memory_order_relaxed);
+    }
+
+    // nothing is written anymore, release anyone still waiting in flush()
+    std::lock_guard<std::mutex> lock{async_mtx_};
+    async_flushed_ = std::numeric_limits<uint64_t>::max();
+    async_flushed_cv_.notify_all();
+}
+
+AsyncWriterCounters TensorBoardLogger::async_counters() const {
+    AsyncWriterCounters counters;
+    counters.enqueued = async_enqueued_.load(std::memory_order_relaxed);
+    counters.written = async_written_.load(std::memory_order_relaxed);
+    counters.dropped = async_dropped_.load(std::memory_order_relaxed);
+    counters.blocked = async_blocked_.load(std::memory_order_relaxed);
+    counters.batches = async_batches_.load(std::memory_order_relaxed);
+    return counters;
+}
+
+int TensorBoardLogger::add_histograms(int step,
+                                      const vector<HistogramInput> &inputs) {
+    StatsScope scope(stats_, EventKind::kHistogram);
+    // one task per (input, chunk), each reduced into its own histogram
+    vector<size_t> first_task(inputs.size() + 1, 0);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        first_task[i + 1] = first_task[i] + Histogram::num_chunks(inputs[i].num);
+    }
+    vector<Histogram> partials(first_task.back());
+    auto reduce = [&](size_t task) {
+        size_t input = std::upper_bound(first_task.begin(), first_task.end(),
+                                        task) -
+                       first_task.begin() - 1;
+        const auto &in = inputs[input];
+        in.add_chunk(&partials[task], in, task - first_task[input]);
+    };
+    if (partials.size() > 1) {
+        thread_pool().parallel_for(partials.size(), reduce);
+    } else if (partials.size() == 1) {
+        reduce(0);
+    }
+
+    auto *event = scratch_event(step);
+    Histogram histogram;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        histogram.clear();
+        for (size_t task = first_task[i]; task < first_task[i + 1]; ++task) {
+            histogram.merge(partials[task]);
+        }
+        fill_histogram(event->mutable_summary()->add_value(), inputs[i].tag,
+                       histogram);
+    }
+    return write_scratch_event(event);
+}
+
+ThreadPool &TensorBoardLogger::thread_pool() {
+    std::call_once(thread_pool_once_, [this] {
+        thread_pool_.reset(new ThreadPool(options.num_threads_));
+    });
+    return *thread_pool_;
+}
+
+ScalarHandle TensorBoardLogger::scalar_handle(const string &tag) {
+    return ScalarHandle(this, tag);
+}
+
+ScalarHandle::ScalarHandle(TensorBoardLogger *logger, const string &tag)
+    : logger_(logger), tag_(tag) {
+    // Summary { Value { tag = 1; simple_value = 2 } value = 1 } summary = 5,
+    // without the tag if it is empty like the protobuf serializer
+    const size_t tag_size =
+        tag.empty() ? 0 : 1 + varint_size(tag.size()) + tag.size();
+    const size_t value_size = tag_size + 1 + sizeof(float);
+    const size_t summary_size = 1 + varint_size(value_size) + value_size;
+    summary_prefix_.push_back('\x2a');
+    append_varint(&summary_prefix_, summary_size);
+    summary_prefix_.push_back('\x0a');
+    append_varint(&summary_prefix_, value_size);
+    if (!tag.empty()) {
+        summary_prefix_.push_back('\x0a');
+        append_varint(&summary_prefix_, tag.size());
+        summary_prefix_.append(tag);
+    }
+    summary_prefix_.push_back('\x15');
+}
+
+int ScalarHandle::log(int step, double value) {
+    StatsScope scope(logger_->stats_, EventKind::kScalar);
+    auto admission = logger_->admit_scalar(tag_, step);
+    if (admission != TensorBoardLogger::ScalarAdmission::kWrite) {
+        if (admission == TensorBoardLogger::ScalarAdmission::kDrop) return 0;
+        return logger_->add_admitted_scalar(tag_, step, admission, value);
+    }
+
+    // Event { wall_time = 1; step = 2; summary = 5 }, in field order like the
+    // protobuf serializer, which leaves out a zero step
+    string &buf = serialization_buffer();
+    buf.clear();
+    double wall_time = time(nullptr);
+    buf.push_back('\x09');
+    buf.append(reinterpret_cast<const char *>(&wall_time), sizeof(wall_time));
+    if (step != 0) {
+        buf.push_back('\x10');
+        append_varint(&buf, static_cast<uint64_t>(static_cast<int64_t>(step)));
+    }
+    buf.append(summary_prefix_);
+    auto simple_value = static_cast<float>(value);
+    buf.append(reinterpret_cast<const char *>(&simple_value),
+               sizeof(simple_value));
+    logger_->last_step_.store(step, std::memory_order_relaxed);
+    return logger_->write_record(buf.data(), buf.size());
+}
+
+StepBatch TensorBoardLogger::begin_step(int step) {
+    return StepBatch(this, step);
+}
+
+StepBatch::StepBatch(TensorBoardLogger *logger, int64_t step)
+    : logger_(logger), step_(step), summary_(new Summary()) {}
+
+StepBatch::StepBatch(StepBatch &&other)
+    : logger_(other.logger_), step_(other.step_), summary_(other.summary_) {
+    other.summary_ = nullptr;
+}
+
+StepBatch::~StepBatch() {
+    if (summary_ == nullptr) return;
+    // e.g. the logger was closed before the batch went out of scope
+    try {
+        commit();
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+    }
+    delete summary_;
+}
+
+Summary::Value *StepBatch::add_value() {
+    if (summary_ == nullptr) {
+        throw std::logic_error("using a moved-from step batch");
+    }
+    return summary_->add_value();
+}
+
+StepBatch &StepBatch::scalar(const string &tag, double value) {
+    TensorBoardLogger::fill_scalar(add_value(), tag, value);
+    return *this;
+}
+
+StepBatch &StepBatch::histogram(const string &tag,
+                                const HistogramAccumulator &accumulator) {
+    TensorBoardLogger::fill_histogram(add_value(), tag,
+                                      accumulator.snapshot());
+    return *this;
+}
+
+StepBatch &StepBatch::histogram(const string &tag,
+                                const QuantileSketch &sketch) {
+    TensorBoardLogger::fill_histogram(add_value(), tag, sketch);
+    return *this;
+}
+
+StepBatch &StepBatch::image(const string &tag, const string &encoded_image,
+                            int height, int width, int channel,
+                            const string &display_name,
+                            const string &description) {
+    TensorBoardLogger::fill_image(add_value(), tag, encoded_image,
+                                  height, width, channel, display_name,
+                                  description);
+    return *this;
+}
+
+StepBatch &StepBatch::images(const string &tag,
+                             const vector<string> &encoded_images, int height,
+                             int width, const string &display_name,
+                             const string &description) {
+    TensorBoardLogger::fill_images(add_value(), tag, encoded_images,
+                                   height, width, display_name, description);
+    return *this;
+}
+
+StepBatch &StepBatch::audio(const string &tag, const string &encoded_audio,
+                            float sample_rate, int num_channels,
+                            int length_frame, const string &content_type,
+                            const string &display_name,
+                            const string &description) {
+    TensorBoardLogger::fill_audio(add_value(), tag, encoded_audio,
+                                  sample_rate, num_channels, length_frame,
+                                  content_type, display_name, description);
+    return *this;
+}
+
+StepBatch &StepBatch::text(const string &tag, const char *text) {
+    TensorBoardLogger::fill_text(add_value(), tag, text);
+    return *this;
+}
+
+int StepBatch::commit() {
+    if (summary_ == nullptr || summary_->value_size() == 0) return 0;
+    StatsScope scope(logger_->stats_, EventKind::kBatch);
+    auto *summary = summary_;
+    summary_ = new Summary();
+    return logger_->add_event(step_, summary);
+}
+
 string get_parent_dir(const string &path) {
     auto last_slash_pos = path.find_last_of("/\\");
     if (last_slash_pos == string::npos) {
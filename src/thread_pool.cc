@@ -0,0 +1,97 @@
+#include "thread_pool.h"
+
+#include <atomic>
+#include <exception>
+
+ThreadPool::ThreadPool(size_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0) num_threads = 1;
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&ThreadPool::worker, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) worker.join();
+}
+
+void ThreadPool::push(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void ThreadPool::worker() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock{mtx_};
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) return;  // stopping, and nothing left to run
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallel_for(size_t n,
+                              const std::function<void(size_t)> &fn) {
+    if (n == 0) return;
+    if (n == 1 || workers_.empty()) {
+        for (size_t i = 0; i < n; ++i) fn(i);
+        return;
+    }
+
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;  // the first exception thrown by fn
+        std::mutex mtx;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+    const size_t n_total = n;
+    auto run = [state, n_total, &fn]() {
+        size_t i, completed = 0;
+        while ((i = state->next.fetch_add(1)) < n_total) {
+            // once an index failed, the others are only counted
+            if (!state->failed.load(std::memory_order_relaxed)) {
+                try {
+                    fn(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{state->mtx};
+                    if (!state->error) state->error = std::current_exception();
+                    state->failed = true;
+                }
+            }
+            ++completed;
+        }
+        if (completed > 0 &&
+            state->done.fetch_add(completed) + completed == n_total) {
+            std::lock_guard<std::mutex> lock{state->mtx};
+            state->cv.notify_all();
+        }
+    };
+
+    size_t helpers = workers_.size() < n - 1 ? workers_.size() : n - 1;
+    for (size_t h = 0; h < helpers; ++h) push(run);
+    run();
+
+    // Helpers that start after all indices are taken return right away
+    // without touching `fn`, so it is safe to return once all indices are
+    // done even if some helper tasks are still queued.
+    std::unique_lock<std::mutex> lock{state->mtx};
+    state->cv.wait(lock, [&] { return state->done.load() == n_total; });
+    if (state->error) std::rethrow_exception(state->error);
+}
@@ -0,0 +1,140 @@
+#include "wav_encoder.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TBL_PCM16_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const size_t kWavHeaderBytes = 44;
+
+void put_le16(char *out, uint16_t v) {
+    out[0] = static_cast<char>(v);
+    out[1] = static_cast<char>(v >> 8);
+}
+
+void put_le32(char *out, uint32_t v) {
+    put_le16(out, static_cast<uint16_t>(v));
+    put_le16(out + 2, static_cast<uint16_t>(v >> 16));
+}
+
+inline int16_t to_pcm16(float x) {
+    if (!(x == x)) return 0;
+    x = x < -1.0f ? -1.0f : (x > 1.0f ? 1.0f : x);
+    // nearest, ties to even as cvtps2dq does in the default rounding mode
+    return static_cast<int16_t>(std::lrint(x * 32767.0f));
+}
+
+void pcm16_portable(const float *samples, size_t num, char *out) {
+    for (size_t i = 0; i < num; ++i) {
+        put_le16(out + 2 * i, static_cast<uint16_t>(to_pcm16(samples[i])));
+    }
+}
+
+#ifdef TBL_PCM16_X86
+
+// SSE2 is part of x86-64, no need to check for it.
+void pcm16_sse2(const float *samples, size_t num, char *out) {
+    const __m128 lo = _mm_set1_ps(-1.0f), hi = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m128 a = _mm_loadu_ps(samples + i);
+        __m128 b = _mm_loadu_ps(samples + i + 4);
+        // NaN lanes are zeroed by the ordered compare mask
+        a = _mm_and_ps(a, _mm_cmpord_ps(a, a));
+        b = _mm_and_ps(b, _mm_cmpord_ps(b, b));
+        a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(a, lo), hi), scale);
+        b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(b, lo), hi), scale);
+        __m128i packed =
+            _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i), packed);
+    }
+    pcm16_portable(samples + i, num - i, out + 2 * i);
+}
+
+__attribute__((target("avx2"))) void pcm16_avx2(const float *samples,
+                                                size_t num, char *out) {
+    const __m256 lo = _mm256_set1_ps(-1.0f), hi = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(32767.0f);
+    size_t i = 0;
+    for (; i + 16 <= num; i += 16) {
+        __m256 a = _mm256_loadu_ps(samples + i);
+        __m256 b = _mm256_loadu_ps(samples + i + 8);
+        a = _mm256_and_ps(a, _mm256_cmp_ps(a, a, _CMP_ORD_Q));
+        b = _mm256_and_ps(b, _mm256_cmp_ps(b, b, _CMP_ORD_Q));
+        a = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(a, lo), hi), scale);
+        b = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(b, lo), hi), scale);
+        // packs works on 128-bit lanes, put the quarters back in order
+        __m256i packed =
+            _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+        packed = _mm256_permute4x64_epi64(packed, 0xd8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * i), packed);
+    }
+    pcm16_sse2(samples + i, num - i, out + 2 * i);
+}
+
+#endif  // TBL_PCM16_X86
+
+struct Pcm16Impl {
+    const char *name;
+    void (*fn)(const float *, size_t, char *);
+};
+
+const Pcm16Impl &best_pcm16_impl() {
+    static const Pcm16Impl impl = [] {
+#ifdef TBL_PCM16_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return Pcm16Impl{"avx2", pcm16_avx2};
+        }
+        return Pcm16Impl{"sse2", pcm16_sse2};
+#else
+        return Pcm16Impl{"portable", pcm16_portable};
+#endif
+    }();
+    return impl;
+}
+
+}  // namespace
+
+size_t wav_size(size_t frames, int channels) {
+    return kWavHeaderBytes + frames * static_cast<size_t>(channels) * 2;
+}
+
+void encode_wav(const float *samples, size_t frames, int channels,
+                uint32_t sample_rate, char *out) {
+    if (channels < 1 || channels > 0xffff) {
+        throw std::invalid_argument("wav audio needs 1 to 65535 channels");
+    }
+    size_t data_bytes = wav_size(frames, channels) - kWavHeaderBytes;
+    if (data_bytes > 0xffffffffu - 36 ||
+        static_cast<uint64_t>(sample_rate) * channels * 2 > 0xffffffffu) {
+        throw std::invalid_argument("audio too large for a wav file");
+    }
+
+    memcpy(out, "RIFF", 4);
+    put_le32(out + 4, static_cast<uint32_t>(36 + data_bytes));
+    memcpy(out + 8, "WAVEfmt ", 8);
+    put_le32(out + 16, 16);  // size of the fmt chunk
+    put_le16(out + 20, 1);   // integer PCM
+    put_le16(out + 22, static_cast<uint16_t>(channels));
+    put_le32(out + 24, sample_rate);
+    put_le32(out + 28, sample_rate * channels * 2);  // bytes per second
+    put_le16(out + 32, static_cast<uint16_t>(channels * 2));  // frame bytes
+    put_le16(out + 34, 16);                                   // sample bits
+    memcpy(out + 36, "data", 4);
+    put_le32(out + 40, static_cast<uint32_t>(data_bytes));
+    float_to_pcm16(samples, frames * channels, out + kWavHeaderBytes);
+}
+
+void float_to_pcm16(const float *samples, size_t num, char *out) {
+    best_pcm16_impl().fn(samples, num, out);
+}
+
+const char *pcm16_implementation() { return best_pcm16_impl().name; }
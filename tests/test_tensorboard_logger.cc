@@ -1,13 +1,60 @@
+// The checks are assert()s, which must run in release builds as well.
+#undef NDEBUG
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <new>
 #include <random>
 #include <sstream>
+#include <thread>
 #include <vector>
 
+#include <google/protobuf/text_format.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "crc.h"
+#include "embedding_writer.h"
+#include "event_compactor.h"
+#include "event_reader.h"
+#include "png_encoder.h"
+#include "pr_curve.h"
+#include "pr_curve_plugin_data.pb.h"
+#include "quantile_sketch.h"
+#include "shm_ring.h"
 #include "tensorboard_logger.h"
+#include "thread_pool.h"
+#include "wav_encoder.h"
 
 using namespace std;
 
+// Heap allocations made by the current thread, for allocation tests.
+static thread_local size_t num_allocations = 0;
+
+// Not inlined, so that the compiler does not pair malloc() and free() with
+// new and delete.
+__attribute__((noinline)) void* operator new(size_t size) {
+    ++num_allocations;
+    void* p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr) throw bad_alloc();
+    return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
 string read_binary_file(const string& filename) {
     ostringstream ss;
     ifstream fin(filename, ios::binary);
@@ -151,6 +198,2035 @@ int test_log_embedding(TensorBoardLogger& logger) {
     return 0;
 }
 
+// bit-at-a-time reference, independent of the table driven implementations
+uint32_t reference_crc32c(const char* buf, size_t len) {
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= static_cast<unsigned char>(buf[i]);
+        for (int k = 0; k < 8; ++k)
+            crc = (crc & 1) ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+    }
+    return ~crc;
+}
+
+int test_thread_pool() {
+    cout << "test thread pool" << endl;
+    ThreadPool pool(4);
+    for (size_t failing : {size_t(0), size_t(500), size_t(999)}) {
+        atomic<size_t> calls{0};
+        bool threw = false;
+        try {
+            pool.parallel_for(1000, [&](size_t i) {
+                ++calls;
+                if (i == failing) throw runtime_error("index failed");
+            });
+        } catch (const runtime_error& e) {
+            threw = string(e.what()) == "index failed";
+        }
+        assert(threw && calls >= 1 && calls <= 1000);
+    }
+    // still usable, and every index runs once
+    vector<atomic<int>> runs(1000);
+    pool.parallel_for(runs.size(), [&runs](size_t i) { ++runs[i]; });
+    for (const auto& r : runs) assert(r == 1);
+
+    return 0;
+}
+
+int test_crc32c() {
+    cout << "test crc32c (" << crc32c_implementation() << ")" << endl;
+    assert(crc32buf("123456789", 9) == 0xe3069283);
+
+    default_random_engine generator;
+    uniform_int_distribution<int> byte(0, 255);
+    vector<char> buf(300000);
+    for (auto& c : buf) c = static_cast<char>(byte(generator));
+
+    const char* impls[] = {"portable", "sse4.2", "sse4.2+pclmul"};
+    for (size_t len : {0, 1, 7, 8, 255, 768, 769, 24576, 24583, 98304, 299990}) {
+        for (size_t offset = 0; offset < 8; ++offset) {
+            const char* p = buf.data() + offset;
+            uint32_t expected = reference_crc32c(p, len);
+            assert(crc32buf(p, len) == expected);
+            for (auto name : impls) {
+                crc32c_fn fn = crc32c_lookup(name);
+                if (fn == nullptr) continue;
+                assert(fn(0, p, len) == expected);
+                assert(fn(fn(0, p, len / 3), p + len / 3, len - len / 3) ==
+                       expected);
+            }
+        }
+    }
+
+    return 0;
+}
+
+// number of well-formed records in an event file
+size_t count_records(const string& filename) {
+    string content = read_binary_file(filename);
+    size_t pos = 0, num_records = 0;
+    while (pos + 12 <= content.size()) {
+        uint64_t len;
+        memcpy(&len, content.data() + pos, sizeof(len));
+        pos += 12 + len + 4;
+        if (pos > content.size()) break;
+        num_records++;
+    }
+    return num_records;
+}
+
+// summary events of a file, after checking that it starts with its version
+vector<tensorflow::Event> read_events(const string& filename) {
+    string content = read_binary_file(filename);
+    vector<tensorflow::Event> events;
+    size_t pos = 0;
+    while (pos + 12 <= content.size()) {
+        uint64_t len;
+        memcpy(&len, content.data() + pos, sizeof(len));
+        if (pos + 12 + len + 4 > content.size()) break;
+        events.emplace_back();
+        events.back().ParseFromArray(content.data() + pos + 12, len);
+        pos += 12 + len + 4;
+    }
+    assert(!events.empty() && events[0].file_version() == "brain.Event:2");
+    events.erase(events.begin());
+    return events;
+}
+
+int test_async_log(const char* log_file) {
+    cout << "test async log" << endl;
+    const int kThreads = 4, kScalars = 2000;
+    {
+        TensorBoardLogger logger(
+            log_file, TensorBoardLoggerOptions().async(true).async_queue_size(
+                          256));
+        vector<thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&logger, t]() {
+                for (int i = 0; i < kScalars; ++i)
+                    logger.add_scalar("async/" + to_string(t), i, i * 0.5);
+            });
+        }
+        for (auto& t : threads) t.join();
+        assert(logger.async_counters().enqueued == kThreads * kScalars);
+        assert(logger.async_counters().dropped == 0);
+    }
+    assert(count_records(log_file) == 1 + kThreads * kScalars);
+
+    // with a tiny queue and no blocking, every record is either written or
+    // accounted for as dropped
+    AsyncWriterCounters counters;
+    {
+        TensorBoardLogger logger(log_file, TensorBoardLoggerOptions()
+                                               .async(true)
+                                               .async_queue_size(2)
+                                               .overflow_policy(
+                                                   OverflowPolicy::kDropOldest));
+        for (int i = 0; i < kScalars; ++i) logger.add_scalar("drop", i, 1.0);
+        counters = logger.async_counters();
+    }
+    assert(counters.enqueued == kScalars);
+    assert(count_records(log_file) == 1 + kScalars - counters.dropped);
+
+    // producers blocked on a full queue behind a slow sink give up when the
+    // logger is closed
+    {
+        TensorBoardLogger logger(
+            log_file,
+            TensorBoardLoggerOptions()
+                .async(true)
+                .async_queue_size(2)
+                .sink_factory([](const string&, bool) {
+                    return unique_ptr<Sink>(
+                        new CallbackSink([](const char*, size_t) {
+                            this_thread::sleep_for(chrono::milliseconds(20));
+                        }));
+                }));
+        atomic<int> gave_up{0};
+        vector<thread> threads;
+        for (int t = 0; t < 2; ++t) {
+            threads.emplace_back([&logger, &gave_up]() {
+                try {
+                    for (int i = 0; i < kScalars; ++i)
+                        logger.add_scalar("blocked", i, 1.0);
+                } catch (const runtime_error&) {
+                    ++gave_up;
+                }
+            });
+        }
+        this_thread::sleep_for(chrono::milliseconds(100));
+        assert(logger.async_counters().blocked > 0);
+        logger.close();
+        for (auto& t : threads) t.join();
+        assert(gave_up == 2);
+    }
+
+    // records pushed while racing close() are still written
+    {
+        TensorBoardLogger logger(log_file,
+                                 TensorBoardLoggerOptions().async(true));
+        vector<thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&logger]() {
+                try {
+                    for (int i = 0;; ++i) logger.add_scalar("racing", i, 1.0);
+                } catch (const runtime_error&) {
+                }
+            });
+        }
+        this_thread::sleep_for(chrono::milliseconds(10));
+        logger.close();
+        for (auto& t : threads) t.join();
+        counters = logger.async_counters();
+    }
+    assert(counters.written == counters.enqueued);
+    assert(count_records(log_file) == 1 + counters.written);
+
+    // a failed write is counted as dropped and thrown by the next flush()
+    {
+        atomic<bool> fail{false};
+        TensorBoardLogger logger(
+            log_file,
+            TensorBoardLoggerOptions().async(true).sink_factory(
+                [&fail](const string&, bool) {
+                    return unique_ptr<Sink>(
+                        new CallbackSink([&fail](const char*, size_t) {
+                            if (fail) throw runtime_error("disk full");
+                        }));
+                }));
+        fail = true;
+        for (int i = 0; i < 10; ++i) logger.add_scalar("lost", i, 1.0);
+        bool thrown = false;
+        try {
+            logger.flush();
+        } catch (const runtime_error& e) {
+            thrown = string(e.what()) == "disk full";
+        }
+        assert(thrown);
+        counters = logger.async_counters();
+        assert(counters.dropped == 10 && counters.written == 0);
+        // reported once
+        logger.flush();
+        fail = false;
+        logger.add_scalar("kept", 0, 1.0);
+        logger.close();
+        assert(logger.async_counters().written == 1);
+    }
+
+    return 0;
+}
+
+int test_step_batch(const char* log_file) {
+    cout << "test step batch" << endl;
+    {
+        TensorBoardLogger logger(log_file);
+        for (int step = 0; step < 3; ++step) {
+            auto batch = logger.begin_step(step);
+            for (int i = 0; i < 400; ++i)
+                batch.scalar("batch/scalar" + to_string(i), step * i);
+            batch.histogram("batch/histogram", vector<float>{1, 2, 3});
+            batch.text("batch/text", "hello");
+            assert(batch.size() == 402);
+            batch.commit();
+            assert(batch.size() == 0);
+        }
+        // uncommitted summaries are written when the batch goes away
+        logger.begin_step(3).scalar("batch/scalar0", 0);
+    }
+    auto events = read_events(log_file);
+    assert(events.size() == 4);
+    assert(events[1].step() == 1);
+    assert(events[1].summary().value_size() == 402);
+    assert(events[1].summary().value(399).simple_value() == 399);
+    assert(events[3].summary().value_size() == 1);
+
+    {
+        TensorBoardLogger logger(log_file);
+        auto batch = logger.begin_step(4);
+        batch.scalar("batch/scalar0", 4);
+        auto moved = std::move(batch);
+        assert(batch.size() == 0 && batch.commit() == 0);
+        bool threw = false;
+        try {
+            batch.scalar("batch/scalar1", 4);
+        } catch (const logic_error&) {
+            threw = true;
+        }
+        assert(threw);
+        // the destructor reports the closed logger rather than throwing
+        logger.close();
+    }
+    events = read_events(log_file);
+    assert(events.empty());
+
+    return 0;
+}
+
+int test_scalar_allocations(const char* log_file) {
+    cout << "test scalar allocations" << endl;
+    const int kWarmup = 100, kScalars = 10000;
+    {
+        TensorBoardLogger logger(log_file);
+        const string tag = "allocations/a_long_scalar_tag_name";
+        for (int i = 0; i < kWarmup; ++i) logger.add_scalar(tag, i, i * 0.5);
+        size_t before = num_allocations;
+        for (int i = kWarmup; i < kScalars; ++i)
+            logger.add_scalar(tag, i, i * 0.5);
+        assert(num_allocations == before);
+
+        // a large event spills out of the arena block, and does not break
+        // the reuse of it afterwards
+        logger.add_text("allocations/text", kScalars,
+                        string(1 << 20, 'x').c_str());
+        logger.add_scalar(tag, kScalars + 1, 1.0);
+        before = num_allocations;
+        logger.add_scalar(tag, kScalars + 2, 2.0);
+        assert(num_allocations == before);
+    }
+    auto events = read_events(log_file);
+    assert(events.size() == kScalars + 3);
+    assert(events[kScalars - 1].step() == kScalars - 1);
+    assert(events[kScalars - 1].summary().value(0).simple_value() ==
+           (kScalars - 1) * 0.5f);
+    assert(events[kScalars].summary().value(0).tensor().string_val(0).size() ==
+           1 << 20);
+
+    return 0;
+}
+
+int test_rotation(const string& log_file) {
+    cout << "test rotation" << endl;
+    const int kScalars = 1000;
+    auto options = TensorBoardLoggerOptions().max_file_bytes(4096);
+    {
+        TensorBoardLogger logger(log_file, options);
+        for (int i = 0; i < kScalars; ++i) {
+            logger.add_scalar("rotation", i, i * 1.0);
+            // give the flusher a chance to open the next file, writers keep
+            // going with the current one until it is ready
+            if (i % 20 == 0) this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+    // every file starts with a file_version event, and steps carry on from
+    // one file to the next
+    vector<string> files = {log_file};
+    for (int i = 1;; ++i) {
+        char name[32];
+        snprintf(name, sizeof(name), ".%06d", i);
+        if (!ifstream(log_file + name)) break;
+        files.push_back(log_file + name);
+    }
+    assert(files.size() > 10);
+    int step = 0;
+    for (const auto& file : files) {
+        if (file != files.back()) assert(read_binary_file(file).size() >= 4096);
+        for (const auto& event : read_events(file)) {
+            assert(event.step() == step++);
+        }
+    }
+    assert(step == kScalars);
+
+    // resuming appends to the last file
+    {
+        TensorBoardLogger logger(log_file, options.resume(true));
+        logger.add_scalar("rotation", kScalars, 1.0);
+    }
+    auto events = read_events(files.back());
+    assert(events.back().step() == kScalars);
+
+    // restoring from a step a few files back empties the files after it
+    const int kRestoreStep = kScalars / 2;
+    {
+        TensorBoardLogger logger(
+            log_file, options.restore_step(kRestoreStep));
+        const auto& info = logger.resume_info();
+        assert(info.dropped_records == kScalars - kRestoreStep);
+        assert(info.last_steps.at("rotation") == kRestoreStep);
+        logger.add_scalar("rotation", kRestoreStep + 1, 1.0);
+    }
+    step = 0;
+    for (const auto& file : files) {
+        for (const auto& event : read_events(file)) {
+            assert(event.step() == step++);
+        }
+    }
+    assert(step == kRestoreStep + 2);
+    assert(read_events(files.back()).back().step() == kRestoreStep + 1);
+    options.restore_step(-1);
+
+    bool thrown = false;
+    try {
+        TensorBoardLogger logger(
+            log_file, options.resume(false).file_name_template("{base}.old"));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    return 0;
+}
+
+int test_event_reader(const string& log_file) {
+    cout << "test event reader" << endl;
+    const int kSteps = 500;
+    {
+        TensorBoardLogger logger(log_file);
+        for (int i = 0; i < kSteps; ++i) {
+            logger.add_scalar("reader/loss", i, i * 0.5);
+            logger.add_scalar("reader/accuracy", i, 1.0);
+            if (i % 100 == 0)
+                logger.add_histogram("reader/w", i, vector<float>{1, 2, 3});
+        }
+    }
+
+    {
+        TensorBoardEventReader reader(log_file);
+        int num_records = 0;
+        while (reader.next()) ++num_records;
+        assert(reader.ok());
+        assert(num_records == 1 + 2 * kSteps + kSteps / 100);
+        assert(reader.end_offset() == reader.file_size());
+
+        reader.seek();
+        assert(reader.next());
+        assert(reader.has_file_version());
+        assert(reader.event().file_version() == "brain.Event:2");
+        // the raw accessors agree with the parsed events
+        while (reader.next()) {
+            const auto& event = reader.event();
+            assert(!reader.has_file_version());
+            assert(reader.wall_time() == event.wall_time());
+            auto values = reader.values();
+            assert(static_cast<int>(values.size()) ==
+                   event.summary().value_size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                const auto& value = event.summary().value(i);
+                assert(string(values[i].tag, values[i].tag_size) ==
+                       value.tag());
+                assert(values[i].kind ==
+                       static_cast<uint32_t>(value.value_case()));
+                assert(values[i].has_metadata == value.has_metadata());
+            }
+        }
+
+        // filtering looks at the raw records, events are parsed on demand
+        reader.seek();
+        reader.filter_tags({"reader/loss", "reader/w"}).filter_steps(100, 199);
+        int num_loss = 0, num_histograms = 0;
+        while (reader.next()) {
+            assert(reader.step() >= 100 && reader.step() <= 199);
+            const auto& value = reader.event().summary().value(0);
+            if (value.tag() == "reader/loss") {
+                assert(value.simple_value() == reader.step() * 0.5f);
+                ++num_loss;
+            } else {
+                assert(value.tag() == "reader/w" && value.histo().num() == 3);
+                ++num_histograms;
+            }
+        }
+        assert(reader.ok());
+        assert(num_loss == 100 && num_histograms == 1);
+    }
+
+    // a flipped bit and a torn tail are reported, with the offset of the
+    // first bad record
+    string content = read_binary_file(log_file);
+    size_t bad_offset;
+    {
+        TensorBoardEventReader reader(log_file);
+        for (int i = 0; i < 300; ++i) reader.next();
+        bad_offset = reader.offset();
+    }
+    string corrupted = content;
+    corrupted[bad_offset + 12 + 3] ^= 0x10;
+    string torn = content.substr(0, content.size() - 5);
+    const string corrupted_file = log_file + ".corrupted";
+    for (const auto& bad : {corrupted, torn}) {
+        ofstream(corrupted_file, ios::binary | ios::trunc) << bad;
+        TensorBoardEventReader reader(corrupted_file);
+        while (reader.next()) {
+        }
+        assert(!reader.ok());
+        if (bad.size() == content.size()) {
+            assert(reader.end_offset() == bad_offset);
+        } else {
+            assert(reader.error().find("truncated") != string::npos);
+        }
+    }
+    remove(corrupted_file.c_str());
+
+    return 0;
+}
+
+int test_resume_repair(const string& log_file) {
+    cout << "test resume repair" << endl;
+    {
+        TensorBoardLogger logger(log_file);
+        for (int i = 0; i < 100; ++i) {
+            logger.add_scalar("resume/a", i, 1.0);
+            logger.add_scalar("resume/b", i, 2.0);
+        }
+        // logged late for an earlier step
+        logger.add_scalar("resume/late", 10, 3.0);
+    }
+    // a crash in the middle of writing a record
+    string content = read_binary_file(log_file);
+    ofstream(log_file, ios::binary | ios::app) << content.substr(200, 20);
+
+    auto options = TensorBoardLoggerOptions().resume(true);
+    {
+        TensorBoardLogger logger(log_file, options);
+        const auto& info = logger.resume_info();
+        assert(info.torn_bytes == 20);
+        assert(info.dropped_records == 0);
+        assert(info.last_steps.at("resume/a") == 99);
+        assert(info.last_steps.at("resume/late") == 10);
+        logger.add_scalar("resume/a", 100, 1.0);
+    }
+    auto events = read_events(log_file);
+    assert(events.size() == 202);
+    assert(events.back().step() == 100);
+
+    // restoring from step 49 drops what came after it, even beyond the
+    // scanned tail, but keeps late events of earlier steps
+    {
+        TensorBoardLogger logger(
+            log_file, options.restore_step(49).resume_scan_bytes(256));
+        const auto& info = logger.resume_info();
+        assert(info.torn_bytes == 0);
+        assert(info.dropped_records == 2 * 50 + 1);
+        assert(info.last_steps.at("resume/b") == 49);
+        logger.add_scalar("resume/a", 50, 1.0);
+    }
+    events = read_events(log_file);
+    assert(events.size() == 2 * 50 + 2);
+    assert(events[100].summary().value(0).tag() == "resume/late");
+    assert(events[101].step() == 50);
+
+    return 0;
+}
+
+int test_scalar_policies(const string& log_file) {
+    cout << "test scalar policies" << endl;
+    int num_evaluated = 0;
+    {
+        TensorBoardLogger logger(log_file);
+        logger.set_scalar_policy("policy/every",
+                                 ScalarPolicy().every_n_steps(10));
+        logger.set_scalar_policy("policy/interval",
+                                 ScalarPolicy().min_interval_ms(60000));
+        logger.set_scalar_policy(
+            "policy/window", ScalarPolicy().every_n_steps(25).aggregate(true));
+        logger.set_scalar_policy("policy/lazy",
+                                 ScalarPolicy().every_n_steps(50));
+        for (int i = 0; i < 100; ++i) {
+            logger.add_scalar("policy/every", i, 1.0);
+            logger.add_scalar("policy/interval", i, 1.0);
+            logger.add_scalar("policy/window", i, i * 1.0);
+            logger.add_scalar("policy/lazy", i, [&num_evaluated]() {
+                ++num_evaluated;
+                return 42.0f;
+            });
+            logger.add_scalar("policy/none", i, 1.0);
+        }
+    }
+    assert(num_evaluated == 2);
+
+    map<string, vector<tensorflow::Event>> events;
+    for (const auto& event : read_events(log_file))
+        events[event.summary().value(0).tag()].push_back(event);
+    assert(events["policy/every"].size() == 10);
+    assert(events["policy/every"][3].step() == 30);
+    assert(events["policy/interval"].size() == 1);
+    assert(events["policy/lazy"].size() == 2);
+    assert(events["policy/lazy"][1].summary().value(0).simple_value() == 42);
+    assert(events["policy/none"].size() == 100);
+
+    // windows end at the logged steps: 0, 25..1, 50..26, 75..51
+    const auto& windows = events["policy/window/mean"];
+    assert(windows.size() == 4);
+    const auto& window = windows[2].summary();
+    assert(windows[2].step() == 50);
+    assert(window.value_size() == 3);
+    assert(window.value(0).simple_value() == 38);
+    assert(window.value(1).tag() == "policy/window/min");
+    assert(window.value(1).simple_value() == 26);
+    assert(window.value(2).simple_value() == 50);
+
+    return 0;
+}
+
+int test_scalar_handle(const string& handle_file, const string& scalar_file) {
+    cout << "test scalar handle" << endl;
+    const string long_tag(300, 't');
+    const vector<int> steps = {0, 1, 127, 128, 300000, -1, 1 << 30};
+    const vector<double> values = {0.0, -1.5, 3e38, 1e-40, 42.0};
+    for (int pass = 0; pass < 2; ++pass) {
+        TensorBoardLogger logger(pass == 0 ? handle_file : scalar_file);
+        auto loss = logger.scalar_handle("train/loss");
+        auto other = logger.scalar_handle(long_tag);
+        auto untagged = logger.scalar_handle("");
+        for (int step : steps) {
+            for (double value : values) {
+                if (pass == 0) {
+                    loss.log(step, value);
+                    other.log(step, value);
+                    untagged.log(step, value);
+                } else {
+                    logger.add_scalar("train/loss", step, value);
+                    logger.add_scalar(long_tag, step, value);
+                    logger.add_scalar("", step, value);
+                }
+            }
+        }
+    }
+
+    // apart from the wall time, the records are the same
+    auto with_handle = read_events(handle_file);
+    auto with_add_scalar = read_events(scalar_file);
+    assert(with_handle.size() == 3 * steps.size() * values.size());
+    assert(with_handle.size() == with_add_scalar.size());
+    for (size_t i = 0; i < with_handle.size(); ++i) {
+        with_handle[i].set_wall_time(0);
+        with_add_scalar[i].set_wall_time(0);
+        assert(with_handle[i].SerializeAsString() ==
+               with_add_scalar[i].SerializeAsString());
+    }
+    TensorBoardEventReader reader(handle_file);
+    while (reader.next()) {
+        assert(string(reader.data(), reader.size()) ==
+               reader.event().SerializeAsString());
+    }
+
+    return 0;
+}
+
+int test_flush_and_close(const string& log_file) {
+    cout << "test flush and close" << endl;
+    for (int async = 0; async < 2; ++async) {
+        TensorBoardLogger logger(
+            log_file, TensorBoardLoggerOptions().async(async == 1));
+        for (int i = 0; i < 10; ++i) logger.add_scalar("flush", i, i * 1.0);
+        // visible without destroying the logger
+        assert(logger.flush() == 0);
+        assert(count_records(log_file) == 1 + 10);
+
+        assert(logger.sync_until(9) == 0);
+        assert(logger.sync_until(5) == 0);  // already synced
+        logger.add_scalar("flush", 10, 10.0);
+        logger.close();
+        logger.close();
+        assert(count_records(log_file) == 1 + 11);
+        bool thrown = false;
+        try {
+            logger.add_scalar("flush", 11, 11.0);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(logger.flush() == 0);
+    }
+
+    // the flusher syncs in the background, and stopping it does not wait
+    // for its next timer
+    auto start = chrono::steady_clock::now();
+    {
+        TensorBoardLogger logger(log_file, TensorBoardLoggerOptions()
+                                               .durability(Durability::kSync)
+                                               .durability_bytes(1024)
+                                               .durability_period_ms(50));
+        for (int i = 0; i < 1000; ++i) logger.add_scalar("sync", i, 1.0);
+    }
+    assert(chrono::steady_clock::now() - start < chrono::seconds(1));
+    assert(count_records(log_file) == 1 + 1000);
+
+    // the current file is synced through its sink, not reopened by name
+    struct SyncCountingSink : CallbackSink {
+        explicit SyncCountingSink(int* syncs)
+            : CallbackSink([](const char*, size_t) {}), syncs(syncs) {}
+        bool on_disk() const override { return true; }
+        bool sync() override {
+            ++*syncs;
+            return true;
+        }
+        int* syncs;
+    };
+    int syncs = 0;
+    {
+        // no file of that name: syncing it by name would throw
+        TensorBoardLogger logger(
+            log_file + ".nowhere",
+            TensorBoardLoggerOptions().sink_factory(
+                [&syncs](const string&, bool) {
+                    return unique_ptr<Sink>(new SyncCountingSink(&syncs));
+                }));
+        logger.add_scalar("sync", 0, 1.0);
+        assert(logger.sync_until(0) == 0);
+        assert(syncs == 1);
+    }
+    auto posix = open_file_sink(SinkType::kPosix, log_file, false, 4096, 0);
+    posix->write("x", 1);
+    posix->flush();
+    assert(posix->sync());
+    posix->close();
+    assert(!posix->sync());
+
+    // a failed background flush is thrown by the next flush()
+    {
+        atomic<bool> fail{false};
+        TensorBoardLogger logger(
+            log_file + ".nowhere",
+            TensorBoardLoggerOptions()
+                .durability(Durability::kFlush)
+                .durability_period_ms(1)
+                .sink_factory([&fail](const string&, bool) {
+                    return unique_ptr<Sink>(new CallbackSink(
+                        [](const char*, size_t) {},
+                        [&fail]() {
+                            if (fail) throw runtime_error("flush failed");
+                        }));
+                }));
+        fail = true;
+        this_thread::sleep_for(chrono::milliseconds(50));
+        fail = false;
+        bool thrown = false;
+        try {
+            logger.flush();
+        } catch (const runtime_error& e) {
+            thrown = string(e.what()) == "flush failed";
+        }
+        assert(thrown);
+        assert(logger.flush() == 0);  // reported once
+    }
+
+    return 0;
+}
+
+int test_sinks(const string& log_file) {
+    cout << "test sinks" << endl;
+    vector<float> values(10000);
+    for (size_t i = 0; i < values.size(); ++i) values[i] = i * 0.25f;
+    auto log = [&values](TensorBoardLogger& logger) {
+        for (int i = 0; i < 3000; ++i) {
+            logger.add_scalar("sink", i, i * 1.0);
+            // larger than the buffers below
+            if (i % 1000 == 0) {
+                logger.add_histogram("sink/histogram", i, values);
+            }
+        }
+    };
+
+    vector<vector<tensorflow::Event>> outputs;
+    for (auto type :
+         {SinkType::kStream, SinkType::kPosix, SinkType::kIoUring}) {
+        for (int resume = 0; resume < 2; ++resume) {
+            TensorBoardLogger logger(log_file, TensorBoardLoggerOptions()
+                                                   .sink(type)
+                                                   .sink_buffer_bytes(4096)
+                                                   .preallocate_bytes(1 << 20)
+                                                   .resume(resume == 1));
+            log(logger);
+        }
+        outputs.push_back(read_events(log_file));
+    }
+
+    string captured;
+    size_t flushes = 0;
+    {
+        TensorBoardLogger logger(
+            log_file,
+            TensorBoardLoggerOptions().sink_factory([&](const string& filename,
+                                                        bool append) {
+                assert(filename == log_file && !append);
+                return unique_ptr<Sink>(new CallbackSink(
+                    [&](const char* data, size_t size) {
+                        captured.append(data, size);
+                    },
+                    [&] { ++flushes; }));
+            }));
+        log(logger);
+        log(logger);
+        logger.flush();
+        assert(flushes == 1);
+    }
+    ofstream(log_file, ios::binary) << captured;
+    outputs.push_back(read_events(log_file));
+
+    // apart from the wall time, every sink writes the same records
+    assert(outputs[0].size() == 2 * 3003);
+    for (auto& events : outputs) {
+        assert(events.size() == outputs[0].size());
+        for (size_t i = 0; i < events.size(); ++i) {
+            auto& event = events[i];
+            event.set_wall_time(0);
+            outputs[0][i].set_wall_time(0);
+            assert(event.SerializeAsString() ==
+                   outputs[0][i].SerializeAsString());
+        }
+    }
+
+    return 0;
+}
+
+int test_shm_ring(const string& log_file) {
+    cout << "test shm ring" << endl;
+    const int kWorkers = 4, kScalars = 2000;
+    const string name = "/tbl_test_" + to_string(getpid());
+    {
+        // small enough for the workers to wait for the collector at times
+        auto ring = ShmRing::create(name, 64 << 10);
+        TensorBoardLogger logger(log_file);
+        ShmRingCollector collector(*ring, logger);
+
+        vector<pid_t> workers;
+        for (int w = 0; w < kWorkers; ++w) {
+            pid_t pid = fork();
+            assert(pid >= 0);
+            if (pid == 0) {
+                {
+                    auto worker_ring = ShmRing::open(name);
+                    TensorBoardLogger worker_logger(
+                        "./demo/unused.tfevents.pb",
+                        TensorBoardLoggerOptions().sink_factory(
+                            shm_ring_sink(worker_ring)));
+                    for (int i = 0; i < kScalars; ++i) {
+                        worker_logger.add_scalar("worker/" + to_string(w), i,
+                                                 i * 1.0);
+                    }
+                }
+                _exit(0);
+            }
+            workers.push_back(pid);
+        }
+        for (pid_t pid : workers) {
+            int status;
+            assert(waitpid(pid, &status, 0) == pid);
+            assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        }
+        collector.stop();
+        assert(collector.num_records() == kWorkers * kScalars);
+        assert(ring->dropped() == 0);
+        ring->unlink();
+    }
+
+    // one file with a single version record, and each worker's steps in
+    // order
+    auto events = read_events(log_file);
+    assert(events.size() == kWorkers * kScalars);
+    vector<int> next_step(kWorkers, 0);
+    for (const auto& event : events) {
+        assert(event.file_version().empty());
+        int w = stoi(event.summary().value(0).tag().substr(7));
+        assert(event.step() == next_step[w]++);
+    }
+    assert(!ifstream("./demo/unused.tfevents.pb").good());
+
+    // without blocking, a full ring drops records and counts them
+    auto ring = ShmRing::create(name, 4096);
+    {
+        auto options =
+            TensorBoardLoggerOptions().sink_factory(shm_ring_sink(ring, false));
+        TensorBoardLogger logger(log_file, options);
+        for (int i = 0; i < 1000; ++i) logger.add_scalar("drop", i, 1.0);
+    }
+    size_t drained = ring->drain([](const char*, size_t) {});
+    assert(drained > 0 && drained + ring->dropped() == 1000);
+    ring->unlink();
+
+    // the async writer's batches, far larger than a ring entry, are pushed
+    // a record at a time
+    {
+        ring = ShmRing::create(name, 16 << 10);
+        TensorBoardLogger logger(log_file);
+        ShmRingCollector collector(*ring, logger);
+        {
+            TensorBoardLogger async_logger(
+                "./demo/unused.tfevents.pb",
+                TensorBoardLoggerOptions().async(true).sink_factory(
+                    shm_ring_sink(ring)));
+            for (int i = 0; i < kScalars; ++i) {
+                async_logger.add_scalar("async", i, i * 1.0);
+            }
+            async_logger.close();
+            assert(async_logger.async_counters().written == kScalars);
+        }
+        collector.stop();
+        assert(collector.num_records() == kScalars);
+        ring->unlink();
+    }
+    assert(read_events(log_file).size() == kScalars);
+
+    return 0;
+}
+
+int test_embedding_writer(const string& log_file) {
+    cout << "test embedding writer" << endl;
+    const size_t kRows = 1000, kDim = 7;
+    vector<float> rows(kRows * kDim);
+    vector<string> labels(kRows);
+    for (size_t i = 0; i < rows.size(); ++i) rows[i] = i * 0.5f;
+    for (size_t i = 0; i < kRows; ++i) labels[i] = "row " + to_string(i);
+    string expected_labels;
+    for (const auto& label : labels) expected_labels += label + "\n";
+
+    const string dir = get_parent_dir(log_file);
+    mkdir(dir.c_str(), 0755);
+    remove((dir + kProjectorConfigFile).c_str());
+    TensorBoardLogger logger(log_file);
+    {
+        auto batch = logger.batch_projector_config();
+        for (int mode = 0; mode < 3; ++mode) {
+            // buffers smaller than a row and not a multiple of it
+            auto options = EmbeddingWriterOptions()
+                               .mmap(mode == 1)
+                               .background(mode == 2)
+                               .buffer_bytes(20);
+            string name = "streamed " + to_string(mode);
+            EmbeddingWriter writer(logger, name, kDim, name + ".bin",
+                                   name + ".tsv", options);
+            // blocks of growing sizes, then single rows
+            size_t row = 0;
+            for (size_t block = 1; row + block <= kRows - 10; ++block) {
+                writer.append_rows(rows.data() + row * kDim, block,
+                                   labels.data() + row);
+                row += block;
+            }
+            for (; row < kRows; ++row) {
+                vector<float> single(rows.begin() + row * kDim,
+                                     rows.begin() + (row + 1) * kDim);
+                writer.append_row(single, &labels[row]);
+            }
+            writer.close();
+            assert(writer.num_rows() == kRows);
+
+            string tensor = read_binary_file(dir + name + ".bin");
+            assert(tensor.size() == rows.size() * sizeof(float));
+            assert(memcmp(tensor.data(), rows.data(), tensor.size()) == 0);
+            assert(read_binary_file(dir + name + ".tsv") == expected_labels);
+        }
+        // the config is only written once the batch is over
+        assert(!ifstream(dir + kProjectorConfigFile).good());
+    }
+
+    tensorflow::ProjectorConfig config;
+    string content = read_binary_file(dir + kProjectorConfigFile);
+    assert(google::protobuf::TextFormat::ParseFromString(content, &config));
+    assert(config.embeddings_size() == 3);
+    for (const auto& embedding : config.embeddings()) {
+        assert(embedding.tensor_shape_size() == 2);
+        assert(embedding.tensor_shape(0) == kRows);
+        assert(embedding.tensor_shape(1) == kDim);
+    }
+
+    // without a batch, every embedding updates the config right away
+    logger.add_embedding("file", "streamed 0.bin", "streamed 0.tsv",
+                         {kRows, kDim});
+    content = read_binary_file(dir + kProjectorConfigFile);
+    assert(google::protobuf::TextFormat::ParseFromString(content, &config));
+    assert(config.embeddings_size() == 4);
+
+    return 0;
+}
+
+static uint32_t read_u32(const string& data, size_t pos) {
+    const unsigned char* p =
+        reinterpret_cast<const unsigned char*>(data.data()) + pos;
+    return (uint32_t(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// Decodes the 8-bit PNGs written by encode_png(), checking the chunk CRCs.
+vector<uint8_t> decode_png(const string& png, int* height, int* width,
+                           int* channels) {
+    assert(png.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0);
+    static const int kChannels[] = {1, 0, 3, 0, 2, 0, 4};
+    string idat;
+    size_t pos = 8;
+    while (pos + 12 <= png.size()) {
+        uint32_t length = read_u32(png, pos);
+        string type = png.substr(pos + 4, 4);
+        uLong crc = crc32(0L, Z_NULL, 0);
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(&png[pos + 4]),
+                    length + 4);
+        assert(read_u32(png, pos + 8 + length) == crc);
+        if (type == "IHDR") {
+            *width = read_u32(png, pos + 8);
+            *height = read_u32(png, pos + 12);
+            assert(png[pos + 16] == 8);
+            *channels = kChannels[static_cast<int>(png[pos + 17])];
+        } else if (type == "IDAT") {
+            idat += png.substr(pos + 8, length);
+        }
+        pos += 12 + length;
+    }
+    assert(pos == png.size());
+
+    size_t bpp = *channels, row_bytes = *width * bpp;
+    vector<uint8_t> filtered((row_bytes + 1) * *height);
+    uLongf size = filtered.size();
+    assert(uncompress(filtered.data(), &size,
+                      reinterpret_cast<const Bytef*>(idat.data()),
+                      idat.size()) == Z_OK);
+    assert(size == filtered.size());
+
+    vector<uint8_t> pixels(row_bytes * *height);
+    for (int y = 0; y < *height; ++y) {
+        const uint8_t* in = &filtered[y * (row_bytes + 1)];
+        uint8_t* row = &pixels[y * row_bytes];
+        for (size_t i = 0; i < row_bytes; ++i) {
+            int a = i >= bpp ? row[i - bpp] : 0;
+            int b = y > 0 ? row[i - row_bytes] : 0;
+            int c = i >= bpp && y > 0 ? row[i - bpp - row_bytes] : 0;
+            int p = a + b - c, pa = abs(p - a), pb = abs(p - b),
+                pc = abs(p - c);
+            int predictors[] = {0, a, b, (a + b) / 2,
+                                pa <= pb && pa <= pc ? a : pb <= pc ? b : c};
+            row[i] = in[i + 1] + predictors[in[0]];
+        }
+    }
+    return pixels;
+}
+
+int test_png_images(const string& log_file) {
+    cout << "test png images" << endl;
+    const int kHeight = 17, kWidth = 23;
+    mt19937 generator(7);
+    vector<uint8_t> pixels(kHeight * kWidth * 4);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        // gradients with some noise, so that every filter gets picked
+        pixels[i] = static_cast<uint8_t>(i / 3 + generator() % 8);
+    }
+
+    for (int channels = 1; channels <= 4; ++channels) {
+        for (auto filter : {PngFilter::kNone, PngFilter::kSub, PngFilter::kUp,
+                            PngFilter::kAverage, PngFilter::kPaeth,
+                            PngFilter::kAdaptive}) {
+            string png =
+                encode_png(pixels.data(), kHeight, kWidth, channels,
+                           PngOptions().filter(filter).compression_level(9));
+            int height, width, decoded_channels;
+            auto decoded = decode_png(png, &height, &width, &decoded_channels);
+            assert(height == kHeight && width == kWidth);
+            assert(decoded_channels == channels);
+            assert(equal(decoded.begin(), decoded.end(), pixels.begin()));
+        }
+    }
+    try {
+        encode_png(pixels.data(), kHeight, kWidth, 5);
+        assert(false);
+    } catch (const invalid_argument&) {
+    }
+
+    // a batch of 64 images, its futures and the ones still pending at close
+    const size_t kImages = 64;
+    vector<uint8_t> batch(kImages * kHeight * kWidth * 3);
+    for (size_t i = 0; i < batch.size(); ++i) batch[i] = i * 7 % 251;
+    {
+        TensorBoardLogger logger(log_file,
+                                 TensorBoardLoggerOptions().num_threads(4));
+        auto single = logger.add_image_raw("raw", 1, pixels.data(), kHeight,
+                                           kWidth, 4, "raw image");
+        auto many = logger.add_images_raw("raw batch", 1, batch.data(),
+                                          kImages, kHeight, kWidth, 3);
+        // the pixels were copied, the buffers can be reused right away
+        fill(batch.begin(), batch.end(), 0);
+        assert(single.get() == 0);
+        assert(many.get() == 0);
+        logger.add_image_raw("raw", 2, pixels.data(), kHeight, kWidth, 1);
+        try {
+            logger.add_image_raw("raw", 3, pixels.data(), kHeight, kWidth, 0);
+            assert(false);
+        } catch (const invalid_argument&) {
+        }
+        logger.close();
+    }
+
+    auto events = read_events(log_file);
+    assert(events.size() == 3);
+    int height, width, channels;
+    for (const auto& event : events) {
+        const auto& value = event.summary().value(0);
+        if (value.tag() == "raw") {
+            auto decoded = decode_png(value.image().encoded_image_string(),
+                                      &height, &width, &channels);
+            assert(channels == (event.step() == 1 ? 4 : 1));
+            assert(equal(decoded.begin(), decoded.end(), pixels.begin()));
+        } else {
+            assert(value.tag() == "raw batch");
+            const auto& images = value.tensor().string_val();
+            assert(images.size() == 2 + static_cast<int>(kImages));
+            for (size_t i = 0; i < kImages; ++i) {
+                auto decoded =
+                    decode_png(images.Get(2 + i), &height, &width, &channels);
+                assert(channels == 3);
+                for (size_t j = 0; j < decoded.size(); ++j) {
+                    size_t k = i * decoded.size() + j;
+                    assert(decoded[j] == k * 7 % 251);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+int test_audio_pcm(const string& log_file) {
+    cout << "test audio pcm (" << pcm16_implementation() << ")" << endl;
+    vector<float> samples = {0.0f, 1.0f, -1.0f, 2.0f, -2.0f,
+                             NAN, INFINITY, -INFINITY, 0.5f / 32767,
+                             1.5f / 32767, -0.5f / 32767, 0.25f};
+    mt19937 generator(3);
+    uniform_real_distribution<float> uniform(-1.2f, 1.2f);
+    while (samples.size() < 200) samples.push_back(uniform(generator));
+    auto expected = [](float x) -> int16_t {
+        if (std::isnan(x)) return 0;
+        x = max(-1.0f, min(1.0f, x));
+        return static_cast<int16_t>(nearbyint(x * 32767.0f));
+    };
+    // every tail length and misaligned starts
+    for (size_t offset = 0; offset < 3; ++offset) {
+        for (size_t num = 0; offset + num <= 40; ++num) {
+            vector<char> out(2 * num + 1, 'x');
+            float_to_pcm16(samples.data() + offset, num, out.data() + 1);
+            for (size_t i = 0; i < num; ++i) {
+                int16_t v = static_cast<int16_t>(
+                    static_cast<uint8_t>(out[1 + 2 * i]) |
+                    static_cast<uint8_t>(out[2 + 2 * i]) << 8);
+                assert(v == expected(samples[offset + i]));
+            }
+        }
+    }
+    assert(expected(0.5f / 32767) == 0 && expected(1.5f / 32767) == 2);
+
+    const size_t kFrames = 100;
+    string wav(wav_size(kFrames, 2), '\0');
+    encode_wav(samples.data(), kFrames, 2, 16000, &wav[0]);
+    assert(wav.size() == 44 + kFrames * 4);
+    assert(wav.compare(0, 4, "RIFF") == 0);
+    assert(wav.compare(8, 8, "WAVEfmt ") == 0);
+    assert(wav.compare(36, 4, "data") == 0);
+    uint32_t rate, data_bytes;
+    memcpy(&rate, &wav[24], 4);
+    memcpy(&data_bytes, &wav[40], 4);
+    assert(rate == 16000 && data_bytes == kFrames * 4);
+    try {
+        encode_wav(samples.data(), kFrames, 0, 16000, &wav[0]);
+        assert(false);
+    } catch (const invalid_argument&) {
+    }
+
+    // clips long enough to be encoded on the pool
+    const size_t kClips = 3, kClipFrames = 70000;
+    vector<float> clips(kClips * kClipFrames);
+    for (auto& x : clips) x = uniform(generator);
+    {
+        TensorBoardLogger logger(log_file,
+                                 TensorBoardLoggerOptions().num_threads(2));
+        logger.add_audio_pcm("pcm", 1, samples.data(), kFrames, 2, 16000,
+                             "speech");
+        logger.add_audios_pcm("pcm batch", 2, clips.data(), kClips,
+                              kClipFrames, 1, 22050);
+        try {
+            logger.add_audios_pcm("pcm batch", 3, clips.data(), kClips,
+                                  kClipFrames, 0, 22050);
+            assert(false);
+        } catch (const invalid_argument&) {
+        }
+    }
+
+    auto events = read_events(log_file);
+    assert(events.size() == 2);
+    const auto& single = events[0].summary().value(0);
+    assert(single.tag() == "pcm");
+    assert(single.metadata().display_name() == "speech");
+    assert(single.audio().encoded_audio_string() == wav);
+    assert(single.audio().content_type() == "audio/wav");
+    assert(single.audio().length_frames() == kFrames);
+    assert(single.audio().num_channels() == 2);
+    const auto& batch = events[1].summary();
+    assert(batch.value_size() == static_cast<int>(kClips));
+    for (size_t i = 0; i < kClips; ++i) {
+        const auto& value = batch.value(i);
+        assert(value.tag() == "pcm batch/audio/" + to_string(i));
+        string clip(wav_size(kClipFrames, 1), '\0');
+        encode_wav(clips.data() + i * kClipFrames, kClipFrames, 1, 22050,
+                   &clip[0]);
+        assert(value.audio().encoded_audio_string() == clip);
+        assert(value.audio().sample_rate() == 22050);
+    }
+
+    return 0;
+}
+
+int test_streamed_payloads(const string& log_file) {
+    cout << "test streamed payloads" << endl;
+    mt19937 generator(11);
+    auto random_bytes = [&generator](size_t size) {
+        string bytes(size, '\0');
+        for (auto& c : bytes) c = static_cast<char>(generator());
+        return bytes;
+    };
+    // around the size from which payloads are streamed, and far above it
+    const string small = random_bytes(1000), edge = random_bytes(64 << 10),
+                 large = random_bytes(3 << 20);
+    const vector<string> images = {large, small, edge};
+    const vector<BytesView> views(images.begin(), images.end());
+
+    for (bool async : {false, true}) {
+        {
+            TensorBoardLogger logger(log_file,
+                                     TensorBoardLoggerOptions().async(async));
+            logger.add_image("image", 1, small, 2, 3, 4);
+            logger.add_image("image", 2, edge, 2, 3, 4, "edge");
+            logger.add_image("image", 3, BytesView(large.data(), large.size()),
+                             2, 3, 4, "", "large");
+            logger.add_images("images", 4, images, 5, 6);
+            logger.add_images("images", 5, views.data(), 1, 5, 6);
+            logger.add_audio("audio", 6, large, 8000, 1, 1000, "audio/wav");
+            logger.add_scalar("scalar", 7, 1.5);
+        }
+
+        TensorBoardEventReader reader(log_file);
+        vector<tensorflow::Event> events;
+        while (reader.next()) events.push_back(reader.event());
+        assert(reader.ok() && reader.end_offset() == reader.file_size());
+        assert(events.size() == 8);
+        for (int i = 0; i < 3; ++i) {
+            const auto& value = events[1 + i].summary().value(0);
+            assert(events[1 + i].step() == i + 1);
+            assert(value.tag() == "image");
+            const auto& image = value.image();
+            assert(image.height() == 2 && image.width() == 3);
+            assert(image.colorspace() == 4);
+            assert(image.encoded_image_string() == (i == 0   ? small
+                                                    : i == 1 ? edge
+                                                             : large));
+        }
+        assert(events[2].summary().value(0).metadata().display_name() ==
+               "edge");
+        assert(events[3].summary().value(0).metadata().summary_description() ==
+               "large");
+        for (int i = 0; i < 2; ++i) {
+            const auto& value = events[4 + i].summary().value(0);
+            assert(value.metadata().plugin_data().plugin_name() == "images");
+            const auto& strings = value.tensor().string_val();
+            assert(strings.size() == (i == 0 ? 5 : 3));
+            assert(strings.Get(0) == "6" && strings.Get(1) == "5");
+            for (int j = 2; j < strings.size(); ++j) {
+                assert(strings.Get(j) == images[j - 2]);
+            }
+        }
+        const auto& audio = events[6].summary().value(0).audio();
+        assert(audio.encoded_audio_string() == large);
+        assert(audio.content_type() == "audio/wav");
+        assert(audio.length_frames() == 1000);
+        assert(events[7].summary().value(0).simple_value() == 1.5f);
+    }
+
+    return 0;
+}
+
+// TP, FP, TN, FN, precision and recall rows of a PR curve, one threshold
+// at a time
+vector<double> reference_pr_curve(const vector<float>& predictions,
+                                  const vector<uint8_t>& labels,
+                                  const float* weights, int num_thresholds) {
+    vector<double> rows(kPrCurveRows * num_thresholds);
+    double* tp = &rows[0];
+    double* fp = &rows[num_thresholds];
+    double* tn = &rows[2 * num_thresholds];
+    double* fn = &rows[3 * num_thresholds];
+    for (size_t j = 0; j < predictions.size(); ++j) {
+        float p = predictions[j];
+        int bucket = 0;
+        if (p > 0) {
+            float scaled = p * static_cast<float>(num_thresholds - 1);
+            bucket = min(static_cast<int>(floor(scaled)), num_thresholds - 1);
+        }
+        double w = weights == nullptr ? 1.0 : weights[j];
+        for (int i = 0; i < num_thresholds; ++i) {
+            bool above = bucket >= i;
+            if (labels[j] != 0) {
+                (above ? tp : fn)[i] += w;
+            } else {
+                (above ? fp : tn)[i] += w;
+            }
+        }
+    }
+    for (int i = 0; i < num_thresholds; ++i) {
+        rows[4 * num_thresholds + i] = tp[i] / max(1e-7, tp[i] + fp[i]);
+        rows[5 * num_thresholds + i] = tp[i] / max(1e-7, tp[i] + fn[i]);
+    }
+    return rows;
+}
+
+int test_pr_curve(const string& log_file) {
+    cout << "test pr curve (" << pr_curve_implementation() << ")" << endl;
+    mt19937 generator(5);
+    uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    // the thresholds themselves, out of range values and NaN
+    vector<float> predictions = {0.0f, 0.5f, 1.0f, 0.25f, 0.75f, -1.0f,
+                                 2.0f, nanf(""), -0.0f, 0.125f, 1e-9f};
+    for (int i = 0; i < 1000; ++i) predictions.push_back(uniform(generator));
+    vector<uint8_t> labels(predictions.size());
+    vector<float> weights(predictions.size());
+    for (size_t i = 0; i < labels.size(); ++i) {
+        labels[i] = generator() % 3 == 0 ? 0 : static_cast<uint8_t>(i + 1);
+        weights[i] = uniform(generator) * 4;
+    }
+
+    // every length, to go through the vector loops and their tails
+    for (size_t num : {size_t(0), size_t(3), size_t(11), predictions.size()}) {
+        for (int num_thresholds : {2, 5, 201}) {
+            vector<float> head(predictions.begin(), predictions.begin() + num);
+            vector<uint8_t> head_labels(labels.begin(), labels.begin() + num);
+            for (const float* w :
+                 vector<const float*>{nullptr, weights.data()}) {
+                vector<double> counts(2 * num_thresholds);
+                bin_pr_predictions(head.data(), head_labels.data(), w, num,
+                                   num_thresholds, counts.data());
+                vector<float> rows(kPrCurveRows * num_thresholds);
+                pr_curve_rows(counts.data(), num_thresholds, rows.data());
+                auto expected =
+                    reference_pr_curve(head, head_labels, w, num_thresholds);
+                for (size_t i = 0; i < rows.size(); ++i) {
+                    assert(fabs(rows[i] - expected[i]) <=
+                           1e-5 * max(1.0, fabs(expected[i])));
+                }
+            }
+        }
+    }
+
+    // several chunks binned on the pool, unweighted so that the counts are
+    // exact whatever the order they are added up in
+    const size_t num = (5 << 20) / 2;
+    vector<float> many(num);
+    vector<uint8_t> many_labels(num);
+    for (size_t i = 0; i < num; ++i) {
+        many[i] = uniform(generator);
+        many_labels[i] = many[i] + uniform(generator) > 1.0f;
+    }
+    {
+        // two sets of counts for the three chunks
+        TensorBoardLogger logger(log_file,
+                                 TensorBoardLoggerOptions().num_threads(1));
+        logger.add_pr_curve("pr", 3, many.data(), many_labels.data(), num,
+                            11);
+        logger.add_pr_curve("weighted", 4, predictions.data(), labels.data(),
+                            predictions.size(), 201, weights.data(), "w",
+                            "weighted");
+        bool thrown = false;
+        try {
+            logger.add_pr_curve("pr", 5, many.data(), many_labels.data(), num,
+                                1);
+        } catch (const invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            logger.add_pr_curve("pr", 5, many.data(), many_labels.data(), num,
+                                kMaxPrCurveThresholds + 1);
+        } catch (const invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    auto expected = reference_pr_curve(many, many_labels, nullptr, 11);
+    TensorBoardEventReader reader(log_file);
+    reader.filter_tags({"pr"});
+    assert(reader.next());
+    const auto& value = reader.event().summary().value(0);
+    assert(reader.event().step() == 3);
+    const auto& plugin_data = value.metadata().plugin_data();
+    assert(plugin_data.plugin_name() == "pr_curves");
+    tensorboard::PrCurvePluginData content;
+    assert(content.ParseFromString(plugin_data.content()));
+    assert(content.num_thresholds() == 11);
+    const auto& tensor = value.tensor();
+    assert(tensor.dtype() == tensorflow::DataType::DT_FLOAT);
+    assert(tensor.tensor_shape().dim_size() == 2);
+    assert(tensor.tensor_shape().dim(0).size() == 6);
+    assert(tensor.tensor_shape().dim(1).size() == 11);
+    assert(tensor.float_val_size() == 66);
+    for (int i = 0; i < 66; ++i) {
+        // counts are exact, precision and recall rounded to float once
+        assert(tensor.float_val(i) == static_cast<float>(expected[i]));
+    }
+    assert(tensor.float_val(0) + tensor.float_val(11 * 3) ==
+           count(many_labels.begin(), many_labels.end(), 1));
+
+    return 0;
+}
+
+int test_quantile_sketch(const string& log_file) {
+    cout << "test quantile sketch" << endl;
+    mt19937 generator(17);
+    for (double accuracy : {0.01, 0.001}) {
+        // enough buckets for the whole range, nothing is folded
+        const size_t kBuckets = 1 << 15;
+        QuantileSketch sketch(accuracy, kBuckets);
+        // every bucket spans at most the promised ratio, and holds its keys
+        const double max_ratio = (1 + accuracy) / (1 - accuracy) * (1 + 1e-9);
+        uniform_real_distribution<double> log10(-300, 300);
+        for (int i = 0; i < 10000; ++i) {
+            double v = pow(10.0, log10(generator));
+            int32_t key = sketch.key(v);
+            double lower = sketch.lower_bound(key);
+            double upper = sketch.lower_bound(key + 1);
+            assert(upper / lower <= max_ratio);
+            assert(lower <= v * (1 + 1e-12) && v <= upper * (1 + 1e-12));
+        }
+
+        // lognormal magnitudes of both signs, zeros and NaNs
+        lognormal_distribution<double> lognormal(0, 4);
+        vector<double> values;
+        for (int i = 0; i < 200000; ++i) {
+            double v = lognormal(generator);
+            values.push_back(i % 3 == 0 ? -v : v);
+        }
+        values.insert(values.end(), 1000, 0.0);
+        values.push_back(nan(""));
+        vector<QuantileSketch> shards(4, QuantileSketch(accuracy, kBuckets));
+        for (size_t i = 0; i < values.size(); ++i) {
+            shards[i % shards.size()].add(values[i]);
+        }
+        sketch.add(values);
+        values.pop_back();  // NaN is skipped
+        sort(values.begin(), values.end());
+        assert(sketch.count() == values.size());
+        assert(sketch.min() == values.front());
+        assert(sketch.max() == values.back());
+
+        QuantileSketch merged(accuracy, kBuckets);
+        for (const auto& shard : shards) {
+            // across processes, through the serialized form
+            merged.merge(QuantileSketch::deserialize(shard.serialize()));
+        }
+        assert(merged.count() == sketch.count());
+        for (double q : {0.0, 0.001, 0.01, 0.1, 0.3, 0.33, 0.34, 0.5, 0.75,
+                         0.9, 0.99, 0.999, 1.0}) {
+            double exact = values[static_cast<size_t>(q * (values.size() - 1))];
+            double estimate = sketch.quantile(q);
+            assert(fabs(estimate - exact) <= accuracy * fabs(exact) * 1.000001);
+            assert(merged.quantile(q) == estimate);
+        }
+    }
+
+    // memory is capped by folding the smallest magnitudes, large quantiles
+    // keep their accuracy
+    QuantileSketch capped(0.01, 64);
+    vector<double> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.push_back(pow(10.0, -9 + 18.0 * i / 100000));
+    }
+    shuffle(values.begin(), values.end(), generator);
+    capped.add(values);
+    sort(values.begin(), values.end());
+    assert(capped.num_buckets() <= 64);
+    assert(capped.count() == values.size());
+    // 64 buckets span a factor of 3.6, the top 3% of this range
+    for (double q : {0.98, 0.99, 1.0}) {
+        double exact = values[static_cast<size_t>(q * (values.size() - 1))];
+        assert(fabs(capped.quantile(q) - exact) <= 0.01 * exact * 1.000001);
+    }
+    assert(capped.quantile(0.0) >= values.front());
+
+    QuantileSketch empty;
+    assert(std::isnan(empty.quantile(0.5)));
+    assert(QuantileSketch::deserialize(empty.serialize()).count() == 0);
+    auto expect_invalid = [](const function<void()>& f) {
+        bool thrown = false;
+        try {
+            f();
+        } catch (const invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    };
+    string data = capped.serialize();
+    expect_invalid([&] { QuantileSketch::deserialize(data.substr(1)); });
+    expect_invalid([&] {
+        QuantileSketch::deserialize(data.substr(0, data.size() - 1));
+    });
+    expect_invalid([&] { capped.merge(QuantileSketch(0.02)); });
+    expect_invalid([] { QuantileSketch(0.0); });
+
+    QuantileSketch sketch;
+    for (int i = -500; i <= 1000; ++i) sketch.add(i / 10.0);
+    {
+        TensorBoardLogger logger(log_file);
+        logger.add_histogram("sketch", 1, sketch);
+        logger.begin_step(2).histogram("batch", sketch);
+    }
+    TensorBoardEventReader reader(log_file);
+    reader.filter_tags({"sketch", "batch"});
+    for (int step = 1; step <= 2; ++step) {
+        assert(reader.next());
+        assert(reader.event().step() == step);
+        const auto& histo = reader.event().summary().value(0).histo();
+        assert(histo.num() == 1501);
+        assert(histo.min() == -50.0 && histo.max() == 100.0);
+        double total = 0;
+        for (int i = 0; i < histo.bucket_size(); ++i) {
+            total += histo.bucket(i);
+            assert(i == 0 ||
+                   histo.bucket_limit(i) > histo.bucket_limit(i - 1));
+        }
+        assert(total == 1501);
+        assert(histo.bucket_limit(0) > -50.0);
+        assert(histo.bucket_limit(histo.bucket_size() - 1) >= 100.0);
+    }
+
+    return 0;
+}
+
+int test_logger_stats(const string& log_file) {
+    cout << "test logger stats" << endl;
+    {
+        TensorBoardLogger logger(log_file);
+        vector<thread> threads;
+        for (int t = 0; t < 2; ++t) {
+            threads.emplace_back([&logger, t] {
+                for (int i = 0; i < 100; ++i) {
+                    logger.add_scalar("scalar/" + to_string(t), i, 0.5 * i);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        const float values[] = {1, 2, 3, 4};
+        logger.add_histogram("histogram", 1, values, 4);
+        logger.add_image("image", 1, string(100, 'x'), 1, 1, 3);
+        const uint8_t pixels[2 * 3] = {};
+        logger.add_images_raw("images", 1, pixels, 2, 1, 1, 3).get();
+        logger.add_text("text", 1, "text");
+        logger.begin_step(2).scalar("a", 1).scalar("b", 2).commit();
+        logger.flush();
+
+        auto stats = logger.stats();
+        const auto& scalar = stats.kind(EventKind::kScalar);
+        assert(scalar.calls == 200 && scalar.records == 200);
+        // the first call of each thread, then one in kStatsLatencySampling
+        const size_t timed = (100 + kStatsLatencySampling - 1) /
+                             kStatsLatencySampling;
+        assert(scalar.latency.count == 2 * timed);
+        assert(scalar.latency.p50_ns > 0);
+        assert(scalar.latency.p50_ns <= scalar.latency.p99_ns);
+        assert(scalar.latency.p99_ns <= scalar.latency.max_ns);
+        assert(stats.kind(EventKind::kHistogram).calls == 1);
+        // add_images() called by add_images_raw() counts as one call
+        assert(stats.kind(EventKind::kImage).calls == 2);
+        assert(stats.kind(EventKind::kImage).records == 2);
+        assert(stats.kind(EventKind::kText).calls == 1);
+        assert(stats.kind(EventKind::kBatch).records == 1);
+        assert(stats.kind(EventKind::kAudio).calls == 0);
+        assert(stats.records == 205);
+        assert(stats.lock_acquisitions == stats.records);
+        assert(stats.lock_contended <= stats.lock_acquisitions);
+        assert(stats.flush_latency.count >= 1);
+        // the main thread, the two writers and the pool thread
+        assert(stats.threads >= 4);
+        // the counters of the writers were folded and freed as they exited
+        assert(stats.live_threads <= stats.threads - 2);
+        assert(string(event_kind_name(EventKind::kHistogram)) == "histogram");
+
+        uint64_t kind_bytes = 0;
+        for (const auto& kind : stats.kinds) kind_bytes += kind.bytes;
+        assert(kind_bytes == stats.bytes);
+        logger.close();
+        // everything but the file version event
+        TensorBoardEventReader reader(log_file);
+        assert(reader.next());
+        assert(reader.file_size() - reader.end_offset() == stats.bytes);
+    }
+
+    {
+        TensorBoardLogger logger(log_file,
+                                 TensorBoardLoggerOptions().stats_period_s(1));
+        logger.add_scalar("scalar", 7, 1.0);
+        this_thread::sleep_for(chrono::milliseconds(1200));
+    }
+    TensorBoardEventReader reader(log_file);
+    reader.filter_tags({"_logger/scalar/calls", "_logger/records"});
+    assert(reader.next());
+    const auto& event = reader.event();
+    assert(event.step() == 7);
+    int found = 0;
+    for (const auto& value : event.summary().value()) {
+        if (value.tag() == "_logger/scalar/calls" ||
+            value.tag() == "_logger/records") {
+            assert(value.simple_value() == 1.0f);
+            ++found;
+        }
+    }
+    assert(found == 2);
+
+    return 0;
+}
+
+int test_histogram_buckets() {
+    cout << "test histogram buckets" << endl;
+    const auto& buckets = DefaultHistogramBuckets::get();
+    const auto& limits = buckets.limits();
+    auto lower_bound_index = [&limits](double x) {
+        size_t i = lower_bound(limits.begin(), limits.end(), x) - limits.begin();
+        return min(i, limits.size() - 1);
+    };
+
+    vector<double> probes = {0.0,
+                             -0.0,
+                             1e-300,
+                             -1e-300,
+                             numeric_limits<double>::denorm_min(),
+                             numeric_limits<double>::infinity(),
+                             -numeric_limits<double>::infinity()};
+    for (double limit : limits) {
+        probes.push_back(limit);
+        probes.push_back(nextafter(limit, numeric_limits<double>::infinity()));
+        probes.push_back(nextafter(limit, -numeric_limits<double>::infinity()));
+    }
+    default_random_engine generator;
+    uniform_real_distribution<double> exponent(-320, 310);
+    for (int i = 0; i < 100000; ++i) {
+        double x = pow(10.0, exponent(generator));
+        probes.push_back(x);
+        probes.push_back(-x);
+    }
+    for (double x : probes) assert(buckets.index(x) == lower_bound_index(x));
+    assert(buckets.index(nan("")) == 0);
+
+    // moments, including the first element being the maximum
+    Histogram histogram;
+    vector<int> values = {70000, 3, -2, 5, 0};
+    histogram.add(values.data(), values.size());
+    assert(histogram.num() == 5);
+    assert(histogram.min() == -2);
+    assert(histogram.max() == 70000);
+    assert(histogram.sum() == 70006);
+    assert(histogram.sum_squares() == 70000.0 * 70000 + 9 + 4 + 25);
+    for (int v : values) assert(histogram.counts()[buckets.index(v)] == 1);
+
+    return 0;
+}
+
+int test_bulk_histograms(const char* serial_file, const char* bulk_file) {
+    cout << "test bulk histograms" << endl;
+    default_random_engine generator;
+    normal_distribution<double> distribution(0, 1e-2);
+    vector<float> large(3 * Histogram::kChunkSize + 12345);
+    for (auto& v : large) v = distribution(generator);
+    vector<double> small(1000);
+    for (auto& v : small) v = distribution(generator);
+    vector<int> ints = {1, -5, 1 << 20, 7};
+
+    {
+        TensorBoardLogger logger(serial_file);
+        logger.add_histogram("large", 1, large);
+        logger.add_histogram("small", 1, small);
+        logger.add_histogram("ints", 1, ints);
+    }
+    {
+        TensorBoardLogger logger(bulk_file,
+                                 TensorBoardLoggerOptions().num_threads(4));
+        logger.add_histograms(1, {{"large", large.data(), large.size()},
+                                  {"small", small},
+                                  {"ints", ints}});
+    }
+
+    auto serial = read_events(serial_file);
+    auto bulk = read_events(bulk_file);
+    assert(serial.size() == 3);
+    assert(bulk.size() == 1);
+    assert(bulk[0].summary().value_size() == 3);
+    for (int i = 0; i < 3; ++i) {
+        const auto& expected = serial[i].summary().value(0);
+        const auto& actual = bulk[0].summary().value(i);
+        assert(expected.tag() == actual.tag());
+        assert(expected.histo().SerializeAsString() ==
+               actual.histo().SerializeAsString());
+    }
+
+    return 0;
+}
+
+int test_histogram_accumulator(const char* log_file) {
+    cout << "test histogram accumulator" << endl;
+    // integers, so that sums don't depend on the order of accumulation
+    vector<int> values(100000);
+    default_random_engine generator;
+    uniform_int_distribution<int> distribution(-10000, 10000);
+    for (auto& v : values) v = distribution(generator);
+
+    HistogramAccumulator accumulator, other;
+    const int kThreads = 4;
+    const size_t kBatch = 1000;
+    vector<thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            // micro-batches interleaved between threads
+            for (size_t b = t; b * kBatch < values.size() / 2; b += kThreads)
+                accumulator.update(values.data() + b * kBatch, kBatch);
+        });
+    }
+    for (auto& t : threads) t.join();
+    other.update(values.data() + values.size() / 2, values.size() / 2);
+    accumulator.merge(other);
+
+    {
+        TensorBoardLogger logger(log_file);
+        logger.add_histogram("accumulated", 1, accumulator);
+        logger.add_histogram("direct", 1, values);
+    }
+    auto events = read_events(log_file);
+    assert(events.size() == 2);
+    assert(events[0].summary().value(0).histo().SerializeAsString() ==
+           events[1].summary().value(0).histo().SerializeAsString());
+
+    accumulator.reset();
+    assert(accumulator.snapshot().num() == 0);
+
+    return 0;
+}
+
+// Reference half precision decoding, by value rather than by bits.
+float reference_half(uint16_t bits) {
+    int exponent = (bits >> 10) & 0x1f;
+    int mantissa = bits & 0x3ff;
+    double magnitude;
+    if (exponent == 0x1f) {
+        magnitude = mantissa == 0 ? numeric_limits<double>::infinity()
+                                  : numeric_limits<double>::quiet_NaN();
+    } else if (exponent == 0) {
+        magnitude = ldexp(mantissa, -24);
+    } else {
+        magnitude = ldexp(1024 + mantissa, exponent - 25);
+    }
+    return static_cast<float>((bits & 0x8000) ? -magnitude : magnitude);
+}
+
+bool same_histogram(const Histogram& a, const Histogram& b) {
+    return a.counts() == b.counts() && a.num() == b.num() &&
+           a.min() == b.min() && a.max() == b.max() && a.sum() == b.sum() &&
+           a.sum_squares() == b.sum_squares();
+}
+
+int test_typed_histograms(const string& log_file) {
+    cout << "test typed histograms" << endl;
+    const char* impl = float16_implementation();
+    assert(strcmp(impl, "f16c") == 0 || strcmp(impl, "portable") == 0);
+
+    // every half precision value, infinities and NaNs on their own
+    vector<Float16> halves, specials;
+    vector<float> expected;
+    for (uint32_t bits = 0; bits <= 0xffff; ++bits) {
+        Float16 h{static_cast<uint16_t>(bits)};
+        float f = reference_half(h.bits);
+        if (isnan(f)) {
+            assert(isnan(to_float(h)));
+        } else {
+            assert(to_float(h) == f && signbit(to_float(h)) == signbit(f));
+        }
+        if (!isfinite(f)) {
+            specials.push_back(h);
+            continue;
+        }
+        halves.push_back(h);
+        expected.push_back(f);
+    }
+    vector<float> converted(halves.size());
+    to_float(halves.data(), halves.size(), converted.data());
+    assert(converted == expected);
+    Histogram from_halves, from_floats;
+    from_halves.add(halves.data(), halves.size());
+    from_floats.add(expected.data(), expected.size());
+    assert(same_histogram(from_halves, from_floats));
+    Histogram from_specials;
+    from_specials.add(specials.data(), specials.size());
+    assert(from_specials.num() == specials.size());
+    assert(from_specials.min() == -numeric_limits<double>::infinity());
+    assert(from_specials.max() == numeric_limits<double>::infinity());
+
+    // bfloat16 is the top half of a float
+    default_random_engine generator;
+    normal_distribution<float> normal(0, 3);
+    vector<BFloat16> bhalves(10001);
+    vector<float> bfloats(bhalves.size());
+    for (size_t i = 0; i < bhalves.size(); ++i) {
+        float f = normal(generator);
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        bhalves[i].bits = static_cast<uint16_t>(bits >> 16);
+        bits &= 0xffff0000u;
+        memcpy(&bfloats[i], &bits, sizeof(bits));
+    }
+    vector<float> bconverted(bhalves.size());
+    to_float(bhalves.data(), bhalves.size(), bconverted.data());
+    assert(bconverted == bfloats);
+    Histogram from_bhalves, from_bfloats;
+    from_bhalves.add(bhalves.data(), bhalves.size());
+    from_bfloats.add(bfloats.data(), bfloats.size());
+    assert(same_histogram(from_bhalves, from_bfloats));
+
+    // bytes are counted in a table, the generic path is the reference
+    uniform_int_distribution<int> byte(0, 255);
+    vector<int8_t> signed_bytes(100003);
+    vector<uint8_t> unsigned_bytes(signed_bytes.size());
+    for (size_t i = 0; i < signed_bytes.size(); ++i) {
+        unsigned_bytes[i] = static_cast<uint8_t>(byte(generator));
+        signed_bytes[i] = static_cast<int8_t>(unsigned_bytes[i]);
+    }
+    Histogram from_signed, from_signed_ints, from_unsigned,
+        from_unsigned_ints;
+    from_signed.add(signed_bytes.data(), signed_bytes.size());
+    vector<int> ints(signed_bytes.begin(), signed_bytes.end());
+    from_signed_ints.add(ints.data(), ints.size());
+    assert(same_histogram(from_signed, from_signed_ints));
+    assert(from_signed.min() == -128 && from_signed.max() == 127);
+    from_unsigned.add(unsigned_bytes.data(), unsigned_bytes.size());
+    ints.assign(unsigned_bytes.begin(), unsigned_bytes.end());
+    from_unsigned_ints.add(ints.data(), ints.size());
+    assert(same_histogram(from_unsigned, from_unsigned_ints));
+
+    // a masked column of a row-major matrix, against a gathered copy;
+    // integer values so that sums don't depend on the blocking
+    const size_t kRows = Histogram::kChunkSize + 4321, kColumns = 3;
+    uniform_int_distribution<int> value(-1000, 1000);
+    vector<double> matrix(kRows * kColumns);
+    for (auto& v : matrix) v = value(generator);
+    vector<int8_t> byte_matrix(matrix.begin(), matrix.end());
+    vector<uint8_t> mask(kRows);
+    for (auto& m : mask) m = byte(generator) % 3 != 0;
+    vector<double> column, masked;
+    vector<int8_t> byte_column;
+    for (size_t r = 0; r < kRows; ++r) {
+        column.push_back(matrix[r * kColumns + 1]);
+        if (mask[r]) {
+            masked.push_back(matrix[r * kColumns + 1]);
+            byte_column.push_back(byte_matrix[r * kColumns + 1]);
+        }
+    }
+    HistogramView<double> column_view(matrix.data() + 1, kRows, kColumns);
+    HistogramView<double> masked_view(matrix.data() + 1, kRows, kColumns,
+                                      mask.data());
+    Histogram strided, gathered;
+    strided.add(column_view);
+    gathered.add(column.data(), column.size());
+    assert(same_histogram(strided, gathered));
+    strided.clear();
+    gathered.clear();
+    strided.add(masked_view);
+    gathered.add(masked.data(), masked.size());
+    assert(same_histogram(strided, gathered));
+    assert(strided.num() == masked.size());
+    strided.clear();
+    gathered.clear();
+    strided.add(HistogramView<int8_t>(byte_matrix.data() + 1, kRows, kColumns,
+                                      mask.data()));
+    gathered.add(byte_column.data(), byte_column.size());
+    assert(same_histogram(strided, gathered));
+
+    // chunks of a view add up to the whole
+    Histogram chunked, whole;
+    for (size_t c = 0; c < Histogram::num_chunks(kRows); ++c) {
+        Histogram chunk;
+        chunk.add_chunk(masked_view, c);
+        chunked.merge(chunk);
+    }
+    whole.add(masked_view);
+    assert(same_histogram(chunked, whole));
+
+    {
+        TensorBoardLogger logger(log_file,
+                                 TensorBoardLoggerOptions().num_threads(2));
+        logger.add_histogram("masked", 1, masked_view);
+        logger.add_histogram("masked", 1, masked);
+        logger.add_histograms(1, {{"masked", masked_view}});
+        logger.begin_step(1).histogram("masked", masked_view);
+        logger.add_histogram("halves", 1, halves);
+        logger.add_histogram("halves", 1, expected);
+    }
+    auto events = read_events(log_file);
+    assert(events.size() == 6);
+    for (int i = 1; i < 4; ++i) {
+        assert(events[i].summary().value(0).histo().SerializeAsString() ==
+               events[0].summary().value(0).histo().SerializeAsString());
+    }
+    assert(events[4].summary().value(0).histo().SerializeAsString() ==
+           events[5].summary().value(0).histo().SerializeAsString());
+
+    return 0;
+}
+
+// An event framed the way event files store it.
+string framed_event(const tensorflow::Event& event) {
+    string data = event.SerializeAsString();
+    uint64_t len = data.size();
+    uint32_t len_crc = masked_crc32c(reinterpret_cast<const char*>(&len),
+                                     sizeof(len));
+    uint32_t data_crc = masked_crc32c(data.data(), data.size());
+    string record(reinterpret_cast<const char*>(&len), sizeof(len));
+    record.append(reinterpret_cast<const char*>(&len_crc), sizeof(len_crc));
+    record += data;
+    record.append(reinterpret_cast<const char*>(&data_crc), sizeof(data_crc));
+    return record;
+}
+
+int test_event_compactor(const string& log_file) {
+    cout << "test event compactor" << endl;
+    const string first = log_file + ".first", restart = log_file + ".restart";
+    {
+        TensorBoardLogger logger(first);
+        for (int step = 0; step < 10; ++step) {
+            if (step == 7) {
+                logger.begin_step(step).scalar("loss", step).scalar("acc", 0.5);
+            } else {
+                logger.add_scalar("loss", step, 1.0 * step);
+            }
+            logger.add_histogram("w", step, vector<float>{1.0f * step, 2.0f});
+        }
+        logger.add_text("note", 0, "first");
+        // superseded by a value without the metadata of the tag
+        tensorflow::Event event;
+        event.set_step(0);
+        event.set_wall_time(1e12);
+        auto* value = event.mutable_summary()->add_value();
+        value->set_tag("note");
+        value->mutable_tensor()->set_dtype(tensorflow::DataType::DT_STRING);
+        value->mutable_tensor()->add_string_val("second");
+        string record = framed_event(event);
+        logger.write_records(record.data(), record.size());
+    }
+    {
+        TensorBoardLogger logger(restart);
+        for (int step = 5; step < 15; ++step) {
+            logger.add_scalar("loss", step, 100.0 + step);
+        }
+    }
+
+    {
+        TensorBoardLogger logger(log_file);
+        auto stats = compact_event_files({first, restart}, logger,
+                                         CompactOptions().num_threads(2));
+        assert(stats.errors.empty());
+        assert(stats.records_read == 32);
+        assert(stats.values_read == 33);
+        assert(stats.duplicates == 6);
+        assert(stats.decimated == 0);
+        assert(stats.records_written == 27);
+        assert(stats.records_rewritten == 2);
+    }
+    auto events = read_events(log_file);
+    assert(events.size() == 27);
+    map<string, map<int64_t, const tensorflow::Summary::Value*>> points;
+    for (size_t i = 0; i < events.size(); ++i) {
+        assert(i == 0 || events[i - 1].step() <= events[i].step());
+        for (const auto& value : events[i].summary().value()) {
+            auto& point = points[value.tag()][events[i].step()];
+            assert(point == nullptr);
+            point = &value;
+        }
+    }
+    assert(points["loss"].size() == 15 && points["w"].size() == 10);
+    for (const auto& point : points["loss"]) {
+        float expected = point.first < 5 ? point.first : 100 + point.first;
+        assert(point.second->simple_value() == expected);
+    }
+    assert(points["acc"].size() == 1 && points["acc"].count(7) == 1);
+    const auto* note = points["note"][0];
+    assert(note->tensor().string_val(0) == "second");
+    assert(note->metadata().plugin_data().plugin_name() == "text");
+
+    {
+        TensorBoardLogger logger(log_file);
+        auto stats = compact_event_files({first, restart}, logger,
+                                         CompactOptions().max_points(4));
+        // 11 of the 15 losses, 6 of the 10 histograms, text is kept
+        assert(stats.decimated == 17);
+    }
+    events = read_events(log_file);
+    vector<int64_t> loss_steps;
+    for (const auto& event : events) {
+        for (const auto& value : event.summary().value()) {
+            if (value.tag() == "loss") loss_steps.push_back(event.step());
+        }
+    }
+    assert((loss_steps == vector<int64_t>{0, 5, 9, 14}));
+
+    // a NaN wall time counts as the earliest
+    const string nan_times = log_file + ".nan";
+    {
+        TensorBoardLogger logger(nan_times);
+        for (double wall_time : {5.0, nan(""), 3.0, nan("")}) {
+            tensorflow::Event event;
+            event.set_step(3);
+            event.set_wall_time(wall_time);
+            auto* value = event.mutable_summary()->add_value();
+            value->set_tag("nan");
+            value->set_simple_value(static_cast<float>(wall_time));
+            string record = framed_event(event);
+            logger.write_records(record.data(), record.size());
+        }
+    }
+    {
+        TensorBoardLogger logger(log_file);
+        auto stats = compact_event_files({nan_times}, logger);
+        assert(stats.duplicates == 3 && stats.records_written == 1);
+    }
+    events = read_events(log_file);
+    assert(events.size() == 1);
+    assert(events[0].summary().value(0).simple_value() == 5.0f);
+
+    // the same output when the index spills, in far more runs than are
+    // merged at once
+    const string many = log_file + ".many";
+    {
+        TensorBoardLogger logger(many);
+        for (int step = 3000; step-- > 0;) {
+            logger.begin_step(step).scalar("a", step).scalar("b", -step);
+            logger.add_text("c", step % 100, "c");
+        }
+    }
+    for (size_t max_points : {0, 50}) {
+        const string in_memory = log_file + ".in_memory";
+        CompactStats expected, spilled;
+        {
+            TensorBoardLogger logger(in_memory);
+            expected = compact_event_files(
+                {many, first, restart}, logger,
+                CompactOptions().max_points(max_points));
+        }
+        {
+            TensorBoardLogger logger(log_file);
+            spilled = compact_event_files({many, first, restart}, logger,
+                                          CompactOptions()
+                                              .max_points(max_points)
+                                              .memory_bytes(1)
+                                              .num_threads(3));
+        }
+        assert(spilled.duplicates == expected.duplicates);
+        assert(spilled.decimated == expected.decimated);
+        assert(spilled.records_written == expected.records_written);
+        assert(spilled.records_rewritten == expected.records_rewritten);
+        auto a = read_events(in_memory), b = read_events(log_file);
+        assert(a.size() == b.size() && a.size() == expected.records_written);
+        for (size_t i = 0; i < a.size(); ++i) {
+            assert(a[i].SerializeAsString() == b[i].SerializeAsString());
+        }
+    }
+
+    // a truncated input keeps what comes before the cut
+    string truncated = read_binary_file(restart);
+    ofstream(restart, ios::binary)
+        .write(truncated.data(), truncated.size() - 3);
+    {
+        TensorBoardLogger logger(log_file);
+        auto stats = compact_event_files({restart}, logger);
+        assert(stats.errors.size() == 1);
+        assert(stats.records_written == 9);
+    }
+
+    return 0;
+}
+
 int test_log(const char* log_file) {
     TensorBoardLogger logger(log_file);
 
@@ -168,7 +2244,84 @@ int test_log(const char* log_file) {
 int main(int argc, char* argv[]) {
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-    int ret = test_log("./demo/tfevents.pb");
+    int ret = test_crc32c();
+    assert(ret == 0);
+
+    ret = test_thread_pool();
+    assert(ret == 0);
+
+    ret = test_histogram_buckets();
+    assert(ret == 0);
+
+    ret = test_bulk_histograms("./demo/serial.tfevents.pb",
+                               "./demo/bulk.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_histogram_accumulator("./demo/accumulator.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_typed_histograms("./demo/typed_histograms.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_async_log("./demo/async.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_step_batch("./demo/batch.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_scalar_allocations("./demo/allocations.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_rotation("./demo/rotation.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_event_reader("./demo/reader.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_resume_repair("./demo/resume.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_scalar_policies("./demo/policies.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_scalar_handle("./demo/handle.tfevents.pb",
+                             "./demo/add_scalar.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_flush_and_close("./demo/flush.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_sinks("./demo/sinks.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_shm_ring("./demo/shm.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_embedding_writer("./demo/embedding/tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_png_images("./demo/png.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_audio_pcm("./demo/audio.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_streamed_payloads("./demo/payloads.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_quantile_sketch("./demo/sketch.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_pr_curve("./demo/pr_curve.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_logger_stats("./demo/stats.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_event_compactor("./demo/compact.tfevents.pb");
+    assert(ret == 0);
+
+    ret = test_log("./demo/tfevents.pb");
     assert(ret == 0);
 
     // Optional:  Delete all global objects allocated by libprotobuf.
@@ -0,0 +1,91 @@
+// Merges the event files of a run into one, in step order, keeping the
+// latest value of every tag and step (see compact_event_files()).
+//
+// Usage: tb_compact [--max-points=N] [--threads=N] [--memory-mb=N]
+//                   [--temp-dir=DIR] <output> <input>...
+//
+// --max-points keeps at most N points of each scalar and histogram tag.
+// --memory-mb bounds the index kept in memory, the rest spills to a
+// temporary file in --temp-dir.
+// The output must not be one of the inputs.
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "event_compactor.h"
+#include "tensorboard_logger.h"
+
+using namespace std;
+
+static bool same_file(const string& a, const string& b) {
+    struct stat sa, sb;
+    if (stat(a.c_str(), &sa) != 0 || stat(b.c_str(), &sb) != 0) return false;
+    return sa.st_dev == sb.st_dev && sa.st_ino == sb.st_ino;
+}
+
+int main(int argc, char* argv[]) {
+    CompactOptions options;
+    vector<string> paths;
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--max-points=", 13) == 0) {
+            options.max_points(strtoull(argv[i] + 13, nullptr, 10));
+        } else if (strncmp(argv[i], "--threads=", 10) == 0) {
+            options.num_threads(strtoull(argv[i] + 10, nullptr, 10));
+        } else if (strncmp(argv[i], "--memory-mb=", 12) == 0) {
+            options.memory_bytes(
+                static_cast<size_t>(strtoull(argv[i] + 12, nullptr, 10))
+                << 20);
+        } else if (strncmp(argv[i], "--temp-dir=", 11) == 0) {
+            options.temp_dir(argv[i] + 11);
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.size() < 2) {
+        fprintf(stderr,
+                "usage: %s [--max-points=N] [--threads=N] [--memory-mb=N] "
+                "[--temp-dir=DIR] <output> <input>...\n",
+                argv[0]);
+        return 2;
+    }
+    string output = paths[0];
+    vector<string> inputs(paths.begin() + 1, paths.end());
+    for (const auto& input : inputs) {
+        if (input == output || same_file(input, output)) {
+            fprintf(stderr, "%s is both an input and the output\n",
+                    output.c_str());
+            return 2;
+        }
+    }
+
+    try {
+        TensorBoardLogger logger(output);
+        auto stats = compact_event_files(inputs, logger, options);
+        logger.close();
+        for (const auto& error : stats.errors) {
+            fprintf(stderr, "warning: %s, the records before it are kept\n",
+                    error.c_str());
+        }
+        fprintf(stderr,
+                "%llu records with %llu values read, %llu duplicates and "
+                "%llu decimated values dropped, %llu records written "
+                "(%llu re-encoded)\n",
+                static_cast<unsigned long long>(stats.records_read),
+                static_cast<unsigned long long>(stats.values_read),
+                static_cast<unsigned long long>(stats.duplicates),
+                static_cast<unsigned long long>(stats.decimated),
+                static_cast<unsigned long long>(stats.records_written),
+                static_cast<unsigned long long>(stats.records_rewritten));
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Collects the records that worker processes log into a shared memory ring
+// (see ShmRing) into one event file, until interrupted.
+//
+// Usage: tb_shm_collector <shm_name> <event_file> [ring_mb] [--resume]
+//
+// The ring is created at startup and removed on exit; start the collector
+// before the workers.
+
+#include <signal.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "shm_ring.h"
+#include "tensorboard_logger.h"
+
+using namespace std;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void request_stop(int) { stop_requested = 1; }
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr,
+                "usage: %s <shm_name> <event_file> [ring_mb] [--resume]\n",
+                argv[0]);
+        return 2;
+    }
+    string shm_name = argv[1], event_file = argv[2];
+    size_t ring_mb = 64;
+    bool resume = false;
+    for (int i = 3; i < argc; ++i) {
+        if (strcmp(argv[i], "--resume") == 0) {
+            resume = true;
+        } else {
+            ring_mb = strtoull(argv[i], nullptr, 10);
+        }
+    }
+
+    signal(SIGINT, request_stop);
+    signal(SIGTERM, request_stop);
+
+    try {
+        auto ring = ShmRing::create(shm_name, ring_mb << 20);
+        TensorBoardLogger logger(
+            event_file, TensorBoardLoggerOptions()
+                            .resume(resume)
+                            .durability(Durability::kFlush)
+                            .durability_period_ms(1000));
+        uint64_t num_records;
+        {
+            ShmRingCollector collector(*ring, logger);
+            fprintf(stderr, "collecting %s into %s\n", shm_name.c_str(),
+                    event_file.c_str());
+            while (!stop_requested) {
+                this_thread::sleep_for(chrono::milliseconds(100));
+            }
+            collector.stop();
+            num_records = collector.num_records();
+        }
+        ring->unlink();
+        logger.close();
+        fprintf(stderr, "%llu records collected, %llu dropped by workers\n",
+                static_cast<unsigned long long>(num_records),
+                static_cast<unsigned long long>(ring->dropped()));
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}